@@ -17,6 +17,8 @@
 //------------------------------------------------------------------------------
 
 #include "constellation.hpp"
+#include "http/lock_profile_http_module.hpp"
+#include "http/metrics_http_module.hpp"
 #include "http/middleware/allow_origin.hpp"
 #include "ledger/chain/consensus/bad_miner.hpp"
 #include "ledger/chain/consensus/dummy_miner.hpp"
@@ -59,6 +61,7 @@ namespace {
 using LaneIndex = fetch::ledger::LaneIdentity::lane_type;
 
 static const std::size_t HTTP_THREADS{4};
+static const std::size_t HTTP_WORKER_THREADS{8};
 
 bool WaitForLaneServersToStart()
 {
@@ -122,6 +125,15 @@ ledger::ShardConfigs GenerateShardsConfig(uint32_t num_lanes, uint16_t start_por
   return configs;
 }
 
+std::shared_ptr<ledger::CompiledContractCache> CreateCompiledContractCache(
+    std::string const &storage_path)
+{
+  auto cache = std::make_shared<ledger::CompiledContractCache>();
+  cache->Load(storage_path);
+
+  return cache;
+}
+
 }  // namespace
 
 /**
@@ -157,9 +169,14 @@ Constellation::Constellation(CertificatePtr &&certificate, Config config)
   , storage_(std::make_shared<StorageUnitClient>(internal_muddle_.AsEndpoint(), shard_cfgs_,
                                                  cfg_.log2_num_lanes))
   , lane_control_(internal_muddle_.AsEndpoint(), shard_cfgs_, cfg_.log2_num_lanes)
+  , tx_feed_(internal_muddle_.AsEndpoint(), shard_cfgs_)
+  , compiled_contracts_{CreateCompiledContractCache(cfg_.db_prefix)}
+  , executable_cache_{std::make_shared<ExecutableCache>(ExecutableCache::DEFAULT_CAPACITY_BYTES,
+                                                        ExecutableCache::DEFAULT_LOG2_NUM_SHARDS,
+                                                        compiled_contracts_)}
   , execution_manager_{std::make_shared<ExecutionManager>(
         cfg_.num_executors, cfg_.log2_num_lanes, storage_,
-        [this] { return std::make_shared<Executor>(storage_); })}
+        [this] { return std::make_shared<Executor>(storage_, executable_cache_); })}
   , chain_{ledger::MainChain::Mode::LOAD_PERSISTENT_DB}
   , block_packer_{cfg_.log2_num_lanes}
   , block_coordinator_{chain_,
@@ -174,8 +191,13 @@ Constellation::Constellation(CertificatePtr &&certificate, Config config)
                        cfg_.block_difficulty}
   , main_chain_service_{std::make_shared<MainChainRpcService>(p2p_.AsEndpoint(), chain_, trust_,
                                                               cfg_.network_mode)}
-  , tx_processor_{*storage_, block_packer_, tx_status_cache_, cfg_.processor_threads}
-  , http_{http_network_manager_}
+  , tx_processor_{*storage_,
+                  block_packer_,
+                  tx_feed_,
+                  tx_status_cache_,
+                  cfg_.log2_num_lanes,
+                  cfg_.processor_threads}
+  , http_{http_network_manager_, HTTP_WORKER_THREADS}
   , http_modules_{
         std::make_shared<p2p::P2PHttpInterface>(
             cfg_.log2_num_lanes, chain_, muddle_, p2p_, trust_, block_packer_,
@@ -184,7 +206,9 @@ Constellation::Constellation(CertificatePtr &&certificate, Config config)
         std::make_shared<ledger::TxStatusHttpInterface>(tx_status_cache_),
         std::make_shared<ledger::TxQueryHttpInterface>(*storage_),
         std::make_shared<ledger::ContractHttpInterface>(*storage_, tx_processor_),
-        std::make_shared<HealthCheckHttpModule>(chain_, *main_chain_service_, block_coordinator_)}
+        std::make_shared<HealthCheckHttpModule>(chain_, *main_chain_service_, block_coordinator_),
+        std::make_shared<http::MetricsHttpModule>(),
+        std::make_shared<http::LockProfileHttpModule>()}
 {
   // print the start up log banner
   FETCH_LOG_INFO(LOGGING_NAME, "Constellation :: ", cfg_.interface_address, " E ",
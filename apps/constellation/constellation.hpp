@@ -24,6 +24,8 @@
 #include "ledger/chain/block_coordinator.hpp"
 #include "ledger/chain/consensus/consensus_miner_interface.hpp"
 #include "ledger/chain/main_chain.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "ledger/chaincode/executable_cache.hpp"
 #include "ledger/execution_manager.hpp"
 #include "ledger/protocols/main_chain_rpc_service.hpp"
 #include "ledger/storage_unit/lane_remote_control.hpp"
@@ -123,9 +125,14 @@ private:
   using HttpModulePtr          = std::shared_ptr<HttpModule>;
   using HttpModules            = std::vector<HttpModulePtr>;
   using TransactionProcessor   = ledger::TransactionProcessor;
+  using TransactionFeed        = ledger::TransactionFeedSubscriber;
   using TrustSystem            = p2p::P2PTrustBayRank<Muddle::Address>;
   using ShardConfigs           = ledger::ShardConfigs;
   using TxStatusCache          = ledger::TransactionStatusCache;
+  using CompiledContractCache  = ledger::CompiledContractCache;
+  using CompiledContractsPtr   = std::shared_ptr<CompiledContractCache>;
+  using ExecutableCache        = ledger::ExecutableCache;
+  using ExecutableCachePtr     = std::shared_ptr<ExecutableCache>;
 
   /// @name Configuration
   /// @{
@@ -155,11 +162,14 @@ private:
   LaneServices         lane_services_;    ///< The lane services
   StorageUnitClientPtr storage_;          ///< The storage client to the lane services
   LaneRemoteControl    lane_control_;     ///< The lane control client for the lane services
+  TransactionFeed      tx_feed_;          ///< The feed of new transactions from the lane services
   /// @}
 
   /// @name Block Processing
   /// @{
-  ExecutionManagerPtr execution_manager_;  ///< The transaction execution manager
+  CompiledContractsPtr compiled_contracts_;  ///< The persistent store of compiled contracts
+  ExecutableCachePtr   executable_cache_;    ///< The compiled contracts shared by all executors
+  ExecutionManagerPtr  execution_manager_;   ///< The transaction execution manager
   /// @}
 
   /// @name Blockchain and Mining
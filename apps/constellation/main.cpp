@@ -20,6 +20,7 @@
 #include "core/commandline/parameter_parser.hpp"
 #include "core/commandline/params.hpp"
 #include "core/json/document.hpp"
+#include "core/lock_profiler.hpp"
 #include "core/macros.hpp"
 #include "core/string/to_lower.hpp"
 #include "crypto/ecdsa.hpp"
@@ -668,6 +669,9 @@ int main(int argc, char **argv)
 
   fetch::commandline::DisplayCLIHeader("Constellation");
 
+  // keep formatting and writing of log output off the calling threads
+  fetch::logger.EnableAsync();
+
   if (!fetch::version::VALID)
   {
     FETCH_LOG_WARN(LOGGING_NAME, "Unsupported version - git working tree is dirty");
@@ -715,5 +719,12 @@ int main(int argc, char **argv)
     std::cerr << "Fatal Error: " << ex.what() << std::endl;
   }
 
+#ifndef NDEBUG
+  // report the most contended locks observed during the run
+  std::ostringstream lock_profile;
+  fetch::mutex::LockProfiler::Instance().Report(lock_profile);
+  FETCH_LOG_INFO(LOGGING_NAME, lock_profile.str());
+#endif
+
   return exit_code;
 }
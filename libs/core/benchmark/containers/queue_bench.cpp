@@ -0,0 +1,169 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/containers/mpmc_ring_queue.hpp"
+#include "core/containers/queue.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+constexpr std::size_t QUEUE_SIZE       = 1u << 12u;
+constexpr std::size_t ELEMENTS_PER_RUN = 1u << 17u;
+constexpr std::size_t BATCH_SIZE       = 64;
+constexpr auto        POP_TIMEOUT      = std::chrono::milliseconds{10};
+
+// shared pointers mirror the payload of the transaction queues
+using Element    = std::shared_ptr<uint64_t>;
+using Elements   = std::vector<Element>;
+using ThreadList = std::vector<std::thread>;
+
+using BlockingQueue = fetch::core::MPMCQueue<Element, QUEUE_SIZE>;
+using RingQueue     = fetch::core::MPMCRingQueue<Element, QUEUE_SIZE>;
+
+/**
+ * Interact with the queue one element at a time
+ */
+struct SingleElementOps
+{
+  template <typename Queue>
+  static void Produce(Queue &queue, Elements const &elements)
+  {
+    for (auto const &element : elements)
+    {
+      queue.Push(element);
+    }
+  }
+
+  template <typename Queue>
+  static std::size_t Consume(Queue &queue)
+  {
+    Element element;
+    return queue.Pop(element, POP_TIMEOUT) ? 1u : 0u;
+  }
+};
+
+/**
+ * Interact with the queue in batches of elements
+ */
+struct BatchOps
+{
+  template <typename Queue>
+  static void Produce(Queue &queue, Elements elements)
+  {
+    for (auto it = elements.begin(); it != elements.end();)
+    {
+      auto const count = std::min<std::ptrdiff_t>(BATCH_SIZE, elements.end() - it);
+      queue.Push(it, it + count);
+      it += count;
+    }
+  }
+
+  template <typename Queue>
+  static std::size_t Consume(Queue &queue)
+  {
+    Elements elements;
+    elements.reserve(BATCH_SIZE);
+    return queue.Pop(elements, BATCH_SIZE, POP_TIMEOUT);
+  }
+};
+
+/**
+ * Measure the throughput of passing elements through the queue with a given number of producer
+ * (range 0) and consumer (range 1) threads
+ */
+template <typename Queue, typename Ops>
+void Queue_Throughput(benchmark::State &state)
+{
+  auto const num_producers = static_cast<std::size_t>(state.range(0));
+  auto const num_consumers = static_cast<std::size_t>(state.range(1));
+
+  auto const elements_per_producer = ELEMENTS_PER_RUN / num_producers;
+
+  // generate the elements upfront so that only the queue interaction is measured
+  Elements elements(elements_per_producer);
+  for (std::size_t i = 0; i < elements.size(); ++i)
+  {
+    elements[i] = std::make_shared<uint64_t>(i);
+  }
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto                     queue = std::make_unique<Queue>();
+    std::atomic<std::size_t> remaining{elements_per_producer * num_producers};
+    state.ResumeTiming();
+
+    ThreadList threads;
+    for (std::size_t i = 0; i < num_producers; ++i)
+    {
+      threads.emplace_back([&queue, &elements]() { Ops::Produce(*queue, elements); });
+    }
+
+    for (std::size_t i = 0; i < num_consumers; ++i)
+    {
+      threads.emplace_back([&queue, &remaining]() {
+        while (remaining > 0)
+        {
+          remaining -= Ops::Consume(*queue);
+        }
+      });
+    }
+
+    for (auto &thread : threads)
+    {
+      thread.join();
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() *
+                          static_cast<int64_t>(elements_per_producer * num_producers));
+}
+
+void ProducerConsumerArgs(benchmark::internal::Benchmark *b)
+{
+  for (int producers : {1, 4, 16})
+  {
+    for (int consumers : {1, 4, 16})
+    {
+      b->Args({producers, consumers});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(Queue_Throughput, BlockingQueue, SingleElementOps)
+    ->Apply(ProducerConsumerArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(Queue_Throughput, RingQueue, SingleElementOps)
+    ->Apply(ProducerConsumerArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(Queue_Throughput, RingQueue, BatchOps)
+    ->Apply(ProducerConsumerArgs)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
@@ -0,0 +1,128 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/logger.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <iostream>
+#include <streambuf>
+
+namespace {
+
+using OverflowPolicy = fetch::log::AsyncLogger::OverflowPolicy;
+
+constexpr char const *LOGGING_NAME = "LoggerBench";
+
+/**
+ * Stream buffer which discards all output, so that the benchmarks measure the cost of logging
+ * rather than the cost of the terminal
+ */
+class NullBuffer : public std::streambuf
+{
+protected:
+  int overflow(int c) override
+  {
+    return c;
+  }
+
+  std::streamsize xsputn(char const *, std::streamsize count) override
+  {
+    return count;
+  }
+};
+
+NullBuffer      null_buffer;
+std::streambuf *original_buffer = nullptr;
+
+// the thread index is a data member in older releases of the benchmark library
+template <typename State>
+auto ThreadIndex(State const &state, int) -> decltype(state.thread_index())
+{
+  return state.thread_index();
+}
+
+template <typename State>
+int ThreadIndex(State const &state, long)
+{
+  return state.thread_index;
+}
+
+bool IsFirstThread(benchmark::State const &state)
+{
+  return ThreadIndex(state, 0) == 0;
+}
+
+void LogMessages(benchmark::State &state)
+{
+  uint64_t counter = 0;
+  for (auto _ : state)
+  {
+    fetch::logger.InfoWithName(LOGGING_NAME, "Processed block: ", counter, " transactions: ", 42,
+                               " duration: ", 1.25, "ms");
+    ++counter;
+  }
+
+  state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * Log through the synchronous logger where every caller formats and writes under a global lock
+ */
+void Logger_Sync(benchmark::State &state)
+{
+  if (IsFirstThread(state))
+  {
+    original_buffer = std::cout.rdbuf(&null_buffer);
+  }
+
+  LogMessages(state);
+
+  if (IsFirstThread(state))
+  {
+    std::cout.rdbuf(original_buffer);
+  }
+}
+
+/**
+ * Log through the asynchronous logger where callers only encode records into per-thread rings
+ */
+template <OverflowPolicy POLICY>
+void Logger_Async(benchmark::State &state)
+{
+  if (IsFirstThread(state))
+  {
+    original_buffer = std::cout.rdbuf(&null_buffer);
+    fetch::logger.EnableAsync(POLICY);
+  }
+
+  LogMessages(state);
+
+  if (IsFirstThread(state))
+  {
+    fetch::logger.DisableAsync();
+    std::cout.rdbuf(original_buffer);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Logger_Sync)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(Logger_Async, OverflowPolicy::DROP)->ThreadRange(1, 8)->UseRealTime();
+BENCHMARK_TEMPLATE(Logger_Async, OverflowPolicy::BLOCK)->ThreadRange(1, 8)->UseRealTime();
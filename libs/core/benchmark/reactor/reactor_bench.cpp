@@ -0,0 +1,200 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/reactor.hpp"
+#include "core/state_machine.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+namespace {
+
+using fetch::core::Reactor;
+using fetch::core::StateMachine;
+
+using Clock        = std::chrono::steady_clock;
+using Timepoint    = Clock::time_point;
+using Milliseconds = std::chrono::milliseconds;
+
+enum class State
+{
+  SYNCHRONISED,
+  WAIT_FOR_EXECUTION,
+};
+
+/**
+ * Emulates the block loop of a single mining node. Once the next block is due it is handed to an
+ * executor thread, and the state machine polls for its completion in the same way as the block
+ * coordinator.
+ */
+class BlockLoop
+{
+public:
+  using StateMachinePtr = std::shared_ptr<StateMachine<State>>;
+
+  BlockLoop(Milliseconds period, Milliseconds execution_time)
+    : period_{period}
+    , execution_time_{execution_time}
+  {
+    state_machine_->RegisterHandler(State::SYNCHRONISED, this, &BlockLoop::OnSynchronised);
+    state_machine_->RegisterHandler(State::WAIT_FOR_EXECUTION, this,
+                                    &BlockLoop::OnWaitForExecution);
+  }
+
+  ~BlockLoop()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      running_ = false;
+    }
+
+    cv_.notify_all();
+    executor_.join();
+  }
+
+  void WaitForBlocks(std::size_t count)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this, count]() { return blocks_ >= count; });
+  }
+
+  StateMachinePtr const &state_machine() const
+  {
+    return state_machine_;
+  }
+
+private:
+  State OnSynchronised()
+  {
+    auto const now = Clock::now();
+
+    if (now >= next_block_time_)
+    {
+      next_block_time_ = now + period_;
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        executing_ = true;
+      }
+
+      cv_.notify_all();
+
+      return State::WAIT_FOR_EXECUTION;
+    }
+
+    // nothing to do until the next block is due
+    state_machine_->Delay(next_block_time_ - now);
+
+    return State::SYNCHRONISED;
+  }
+
+  State OnWaitForExecution()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+
+      if (!executing_)
+      {
+        ++blocks_;
+        cv_.notify_all();
+
+        return State::SYNCHRONISED;
+      }
+    }
+
+    // the block coordinator polls the execution manager at this interval
+    state_machine_->Delay(Milliseconds{20});
+
+    return State::WAIT_FOR_EXECUTION;
+  }
+
+  void Execute()
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+
+    while (running_)
+    {
+      cv_.wait(lock, [this]() { return executing_ || !running_; });
+
+      if (executing_)
+      {
+        lock.unlock();
+        std::this_thread::sleep_for(execution_time_);
+        lock.lock();
+
+        executing_ = false;
+      }
+    }
+  }
+
+  Milliseconds const      period_;
+  Milliseconds const      execution_time_;
+  Timepoint               next_block_time_{};
+  std::mutex              mutex_;
+  std::condition_variable cv_;
+  bool                    running_{true};
+  bool                    executing_{false};
+  std::size_t             blocks_{0};
+  StateMachinePtr         state_machine_{
+      std::make_shared<StateMachine<State>>("BlockLoop", State::SYNCHRONISED)};
+  std::thread executor_{&BlockLoop::Execute, this};
+};
+
+/**
+ * Measure the interval between consecutive blocks. The arguments are the block period and the
+ * time taken to execute each block, both in milliseconds.
+ */
+void Reactor_BlockInterval(benchmark::State &state)
+{
+  BlockLoop loop{Milliseconds{state.range(0)}, Milliseconds{state.range(1)}};
+
+  Reactor reactor{"BlockLoop"};
+  reactor.Attach(loop.state_machine());
+  reactor.Start();
+
+  // the first block is produced as soon as the reactor starts
+  std::size_t blocks = 1;
+  loop.WaitForBlocks(blocks);
+
+  for (auto _ : state)
+  {
+    auto const start = Clock::now();
+    loop.WaitForBlocks(++blocks);
+
+    state.SetIterationTime(std::chrono::duration<double>(Clock::now() - start).count());
+  }
+
+  reactor.Stop();
+}
+
+}  // namespace
+
+BENCHMARK(Reactor_BlockInterval)
+    ->Args({0, 5})
+    ->Args({0, 50})
+    ->Args({100, 5})
+    ->Args({100, 50})
+    ->Iterations(50)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
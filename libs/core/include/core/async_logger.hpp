@@ -0,0 +1,311 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <ctime>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fetch {
+namespace log {
+
+enum class LogLevel
+{
+  ERROR     = 0,
+  WARNING   = 1,
+  INFO      = 2,
+  DEBUG     = 3,
+  HIGHLIGHT = 4
+};
+
+namespace detail {
+
+/**
+ * Encodes a single log record into a compact binary form. Primitive arguments are stored as
+ * tagged values so that the (comparatively) expensive text formatting can be deferred to the
+ * background writer. Any other argument type is formatted on the caller with its stream operator.
+ */
+class RecordEncoder
+{
+public:
+  enum class ArgType : uint8_t
+  {
+    BOOL,
+    CHAR,
+    SIGNED,
+    UNSIGNED,
+    FLOAT,
+    STRING
+  };
+
+  void Reset(LogLevel level, char const *name);
+
+  void Append(bool value)
+  {
+    Put(ArgType::BOOL);
+    Put(static_cast<uint8_t>(value));
+  }
+
+  void Append(char value)
+  {
+    Put(ArgType::CHAR);
+    Put(value);
+  }
+
+  void Append(signed char value)
+  {
+    Append(static_cast<char>(value));
+  }
+
+  void Append(unsigned char value)
+  {
+    Append(static_cast<char>(value));
+  }
+
+  void Append(short value)
+  {
+    AppendSigned(value);
+  }
+
+  void Append(int value)
+  {
+    AppendSigned(value);
+  }
+
+  void Append(long value)
+  {
+    AppendSigned(value);
+  }
+
+  void Append(long long value)
+  {
+    AppendSigned(value);
+  }
+
+  void Append(unsigned short value)
+  {
+    AppendUnsigned(value);
+  }
+
+  void Append(unsigned int value)
+  {
+    AppendUnsigned(value);
+  }
+
+  void Append(unsigned long value)
+  {
+    AppendUnsigned(value);
+  }
+
+  void Append(unsigned long long value)
+  {
+    AppendUnsigned(value);
+  }
+
+  void Append(float value)
+  {
+    Append(static_cast<double>(value));
+  }
+
+  void Append(double value)
+  {
+    Put(ArgType::FLOAT);
+    Put(value);
+  }
+
+  void Append(char const *value)
+  {
+    AppendString(value, std::char_traits<char>::length(value));
+  }
+
+  void Append(std::string const &value)
+  {
+    AppendString(value.data(), value.size());
+  }
+
+  template <typename T>
+  void Append(T const &value)
+  {
+    std::ostringstream oss;
+    oss << value;
+    Append(oss.str());
+  }
+
+  std::string const &record() const
+  {
+    return buffer_;
+  }
+
+private:
+  template <typename T>
+  void Put(T const &value)
+  {
+    buffer_.append(reinterpret_cast<char const *>(&value), sizeof(T));
+  }
+
+  void AppendSigned(int64_t value)
+  {
+    Put(ArgType::SIGNED);
+    Put(value);
+  }
+
+  void AppendUnsigned(uint64_t value)
+  {
+    Put(ArgType::UNSIGNED);
+    Put(value);
+  }
+
+  void AppendString(char const *data, std::size_t length);
+
+  std::string buffer_;
+};
+
+}  // namespace detail
+
+/**
+ * Asynchronous logging backend.
+ *
+ * Each producing thread owns a single-producer / single-consumer byte ring into which it writes
+ * pre-encoded records without taking any locks. A single background writer drains all the rings,
+ * orders the records by their timestamp, formats them and emits them to the output stream. When a
+ * ring is full the record is either dropped (and accounted for) or the producer waits for the
+ * writer to make space, depending on the configured overflow policy.
+ */
+class AsyncLogger
+{
+public:
+  enum class OverflowPolicy
+  {
+    DROP,
+    BLOCK
+  };
+
+  struct Statistics
+  {
+    uint64_t submitted = 0;  ///< The number of records placed into the rings
+    uint64_t dropped   = 0;  ///< The number of records dropped because a ring was full
+    uint64_t written   = 0;  ///< The number of records emitted by the writer
+  };
+
+  static constexpr std::size_t DEFAULT_RING_SIZE = 1u << 16u;
+
+  // Construction / Destruction
+  explicit AsyncLogger(OverflowPolicy policy = OverflowPolicy::DROP,
+                       std::size_t ring_size = DEFAULT_RING_SIZE, std::ostream &output = std::cout);
+  AsyncLogger(AsyncLogger const &) = delete;
+  AsyncLogger(AsyncLogger &&)      = delete;
+  ~AsyncLogger();
+
+  /// @name Writer Control
+  /// @{
+  void Start();
+  void Stop();
+  void Flush();
+  /// @}
+
+  /**
+   * Log a record from the calling thread
+   *
+   * @param level The level of the record
+   * @param name The logging name of the caller
+   * @param args The arguments which make up the message
+   * @return true if the record was handled (queued or dropped), false if the caller must log it
+   *         through the synchronous path (the record is too large or the logger has been stopped)
+   */
+  template <typename... Args>
+  bool Log(LogLevel level, char const *name, Args const &... args)
+  {
+    detail::RecordEncoder &encoder = Encoder();
+    encoder.Reset(level, name);
+    AppendAll(encoder, args...);
+
+    return Submit(encoder.record());
+  }
+
+  Statistics GetStatistics() const;
+
+  // Operators
+  AsyncLogger &operator=(AsyncLogger const &) = delete;
+  AsyncLogger &operator=(AsyncLogger &&) = delete;
+
+private:
+  class Ring;
+
+  using RingPtr  = std::shared_ptr<Ring>;
+  using RingList = std::vector<RingPtr>;
+  using Clock    = std::chrono::system_clock;
+
+  static detail::RecordEncoder &Encoder();
+
+  static void AppendAll(detail::RecordEncoder &)
+  {}
+
+  template <typename T, typename... Args>
+  static void AppendAll(detail::RecordEncoder &encoder, T const &value, Args const &... args)
+  {
+    encoder.Append(value);
+    AppendAll(encoder, args...);
+  }
+
+  bool     Submit(std::string const &record);
+  Ring &   LocalRing();
+  void     WakeWriter();
+  void     WriterLoop();
+  void     Drain();
+  void     Format(Ring const &ring, std::string const &record, std::ostringstream &out);
+  RingList SnapshotRings() const;
+
+  OverflowPolicy const policy_;
+  std::size_t const    ring_size_;
+  std::ostream &       output_;
+  uint64_t const       instance_id_;
+
+  mutable std::mutex registry_lock_;
+  RingList           rings_;
+
+  std::mutex              wake_lock_;
+  std::condition_variable wake_;
+  std::condition_variable drained_;
+
+  std::atomic<bool>            running_{false};
+  std::atomic<bool>            stopped_{false};
+  std::unique_ptr<std::thread> writer_;
+
+  std::atomic<uint64_t> retired_submitted_{0};
+  std::atomic<uint64_t> dropped_{0};
+  std::atomic<uint64_t> written_{0};
+
+  // drain state (only accessed by the thread holding the drain lock)
+  std::mutex  drain_lock_;
+  std::time_t last_second_{0};
+  std::string time_prefix_;
+};
+
+}  // namespace log
+}  // namespace fetch
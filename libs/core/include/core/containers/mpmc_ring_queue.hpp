@@ -0,0 +1,808 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "meta/log2.hpp"
+#include "meta/type_traits.hpp"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace fetch {
+namespace core {
+
+/**
+ * Bounded, lock-free, multiple producer / multiple consumer ring queue
+ *
+ * Each slot of the ring carries a sequence number which encodes whether it is ready to be written
+ * to or read from for a given lap of the ring. Producers and consumers claim slots by advancing
+ * the tail and head counters with a single compare-and-swap (a batch claims a contiguous range of
+ * slots in one operation) and then hand the slot over by publishing its sequence number. No lock
+ * is taken on the fast path.
+ *
+ * The blocking operations spin for a configurable number of attempts before parking the calling
+ * thread on a condition variable. The park / wake up path is only entered when the queue is empty
+ * (or full), producers and consumers only signal when there are threads actually parked.
+ *
+ * The interface mirrors that of core::Queue so that it can be used as a drop in replacement.
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam SIZE The max size of the queue
+ */
+template <typename T, std::size_t SIZE>
+class MPMCRingQueue
+{
+public:
+  static constexpr std::size_t QUEUE_LENGTH       = SIZE;
+  static constexpr std::size_t DEFAULT_SPIN_COUNT = 128;
+
+  using Element = T;
+
+  static_assert(std::is_move_assignable<T>::value, "T must be move assignable");
+  static_assert(std::is_default_constructible<T>::value, "T must be default constructable");
+
+  // Construction / Destruction
+  explicit MPMCRingQueue(std::size_t spin_count = DEFAULT_SPIN_COUNT);
+  MPMCRingQueue(MPMCRingQueue const &) = delete;
+  MPMCRingQueue(MPMCRingQueue &&)      = delete;
+  ~MPMCRingQueue()                     = default;
+
+  /// @name Queue Interaction
+  /// @{
+  T Pop();
+  template <typename R, typename P>
+  bool Pop(T &value, std::chrono::duration<R, P> const &duration);
+  template <typename U>
+  meta::EnableIfSame<T, meta::Decay<U>> Push(U &&element);
+  template <typename U>
+  meta::EnableIfSame<T, meta::Decay<U>> Push(U &&element, std::size_t &count);
+  template <typename U, typename R, typename P>
+  meta::EnableIfSame<T, meta::Decay<U>, bool> Push(U &&element, std::size_t &count,
+                                                   std::chrono::duration<R, P> const &duration);
+  /// @}
+
+  /// @name Non-blocking Interaction
+  /// @{
+  bool TryPop(T &value);
+  template <typename U>
+  meta::EnableIfSame<T, meta::Decay<U>, bool> TryPush(U &&element);
+  /// @}
+
+  /// @name Batch Interaction
+  /// @{
+  template <typename R, typename P>
+  std::size_t Pop(std::vector<T> &values, std::size_t max_count,
+                  std::chrono::duration<R, P> const &duration);
+  std::size_t TryPop(std::vector<T> &values, std::size_t max_count);
+  template <typename Iterator>
+  void Push(Iterator begin, Iterator end);
+  /// @}
+
+  /// @name Queue State
+  /// @{
+  std::size_t size() const;
+  bool        empty() const;
+  /// @}
+
+  // Operators
+  MPMCRingQueue &operator=(MPMCRingQueue const &) = delete;
+  MPMCRingQueue &operator=(MPMCRingQueue &&) = delete;
+
+private:
+  static constexpr std::size_t MASK            = SIZE - 1;
+  static constexpr std::size_t CACHE_LINE_SIZE = 64;
+  static constexpr std::size_t YIELD_THRESHOLD = 16;
+
+  using Counter   = std::atomic<std::size_t>;
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  /**
+   * A single slot in the ring
+   */
+  struct Slot
+  {
+    Counter sequence{0};  ///< The lap dependent sequence number of the slot
+    T       value{};      ///< The stored element
+  };
+
+  /**
+   * The set of threads parked waiting for the queue to change state
+   */
+  struct ParkingLot
+  {
+    std::mutex              lock;
+    std::condition_variable condition;
+    Counter                 waiting{0};
+  };
+
+  /**
+   * A counter padded to occupy its own cache line
+   */
+  struct PaddedCounter
+  {
+    Counter value{0};
+    char    padding[CACHE_LINE_SIZE - sizeof(Counter)];
+  };
+
+  using Slots = std::array<Slot, SIZE>;
+
+  template <typename U>
+  bool        PushElement(U &&element);
+  bool        PopElement(T &value);
+  std::size_t PopElements(std::vector<T> &values, std::size_t max_count);
+  std::size_t ClaimForWrite(std::size_t max_count, std::size_t &position);
+  std::size_t ClaimForRead(std::size_t max_count, std::size_t &position);
+  void        WriteSlot(std::size_t position, T &&value);
+  void        ReadSlot(std::size_t position, T &value);
+
+  template <typename Operation>
+  bool Wait(ParkingLot &lot, Operation &&operation, Timepoint const *deadline);
+  void Wake(ParkingLot &lot, bool all);
+
+  std::size_t const spin_count_;
+
+  PaddedCounter head_;       ///< The position of the next slot to be read
+  PaddedCounter tail_;       ///< The position of the next slot to be written
+  Slots         slots_;      ///< The ring of slots
+  ParkingLot    not_empty_;  ///< Consumers waiting for an element to become available
+  ParkingLot    not_full_;   ///< Producers waiting for a slot to become available
+
+  // static asserts
+  static_assert(meta::IsLog2(SIZE), "Queue size must be a valid power of 2");
+};
+
+/**
+ * Construct the queue
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @param spin_count The number of attempts a blocking call makes before parking the thread
+ */
+template <typename T, std::size_t N>
+MPMCRingQueue<T, N>::MPMCRingQueue(std::size_t spin_count)
+  : spin_count_{spin_count}
+{
+  for (std::size_t i = 0; i < N; ++i)
+  {
+    slots_[i].sequence.store(i, std::memory_order_relaxed);
+  }
+}
+
+/**
+ * Pop an element from the queue
+ *
+ * If no element is available then the function will block until an element
+ * is available.
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @return The element retrieved from the queue
+ */
+template <typename T, std::size_t N>
+T MPMCRingQueue<T, N>::Pop()
+{
+  T value;
+  Wait(not_empty_, [this, &value]() { return PopElement(value); }, nullptr);
+  Wake(not_full_, false);
+
+  return value;
+}
+
+/**
+ * Pop an element from the queue with a specified maximum wait duration
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam Rep The tick representation for the duration
+ * @tparam Per The tick period for the duration
+ * @param value The reference to the value to be populated
+ * @param duration The maximum amount of time to wait for an element
+ * @return true if an element was extracted, otherwise false
+ */
+template <typename T, std::size_t N>
+template <typename Rep, typename Per>
+bool MPMCRingQueue<T, N>::Pop(T &value, std::chrono::duration<Rep, Per> const &duration)
+{
+  Timepoint const deadline = Clock::now() + duration;
+  if (!Wait(not_empty_, [this, &value]() { return PopElement(value); }, &deadline))
+  {
+    return false;
+  }
+
+  Wake(not_full_, false);
+  return true;
+}
+
+/**
+ * Push an element onto the queue
+ *
+ * If the queue is full this function will block until an element can be added
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam U Inferred element type (to leverage universal references)
+ * @param element The universal reference to the element
+ */
+template <typename T, std::size_t N>
+template <typename U>
+meta::EnableIfSame<T, meta::Decay<U>> MPMCRingQueue<T, N>::Push(U &&element)
+{
+  Wait(not_full_, [this, &element]() { return PushElement(std::forward<U>(element)); }, nullptr);
+  Wake(not_empty_, false);
+}
+
+/**
+ * Push an element onto the queue
+ *
+ * If the queue is full this function will block until an element can be added
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam U Inferred element type (to leverage universal references)
+ * @param element The universal reference to the element
+ * @param count Number of enqueued elements still waiting in the queue to be processed.
+ */
+template <typename T, std::size_t N>
+template <typename U>
+meta::EnableIfSame<T, meta::Decay<U>> MPMCRingQueue<T, N>::Push(U &&element, std::size_t &count)
+{
+  Push(std::forward<U>(element));
+  count = size();
+}
+
+/**
+ * Push an element onto the queue
+ *
+ * If the queue is full this function will block until an element can be added
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam U Inferred element type (to leverage universal references)
+ * @param element The universal reference to the element
+ * @param count Number of enqueued elements still waiting in the queue to be processed.
+ * @param duration The maximum amount of time to wait for being able to insert the element
+ * @return true if an element was inserted in given timeout, otherwise false
+ */
+template <typename T, std::size_t N>
+template <typename U, typename Rep, typename Per>
+meta::EnableIfSame<T, meta::Decay<U>, bool> MPMCRingQueue<T, N>::Push(
+    U &&element, std::size_t &count, std::chrono::duration<Rep, Per> const &duration)
+{
+  Timepoint const deadline = Clock::now() + duration;
+  if (!Wait(not_full_, [this, &element]() { return PushElement(std::forward<U>(element)); },
+            &deadline))
+  {
+    return false;
+  }
+
+  Wake(not_empty_, false);
+
+  count = size();
+  return true;
+}
+
+/**
+ * Attempt to pop an element from the queue without blocking
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @param value The reference to the value to be populated
+ * @return true if an element was extracted, otherwise false
+ */
+template <typename T, std::size_t N>
+bool MPMCRingQueue<T, N>::TryPop(T &value)
+{
+  if (!PopElement(value))
+  {
+    return false;
+  }
+
+  Wake(not_full_, false);
+  return true;
+}
+
+/**
+ * Attempt to push an element onto the queue without blocking
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam U Inferred element type (to leverage universal references)
+ * @param element The universal reference to the element
+ * @return true if the element was added, otherwise false (the queue is full)
+ */
+template <typename T, std::size_t N>
+template <typename U>
+meta::EnableIfSame<T, meta::Decay<U>, bool> MPMCRingQueue<T, N>::TryPush(U &&element)
+{
+  if (!PushElement(std::forward<U>(element)))
+  {
+    return false;
+  }
+
+  Wake(not_empty_, false);
+  return true;
+}
+
+/**
+ * Internal: Claim and read a single element from the queue without waking any parked producers
+ *
+ * @param value The reference to the value to be populated
+ * @return true if an element was extracted, otherwise false
+ */
+template <typename T, std::size_t N>
+bool MPMCRingQueue<T, N>::PopElement(T &value)
+{
+  std::size_t position = head_.value.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    Slot &slot = slots_[position & MASK];
+
+    auto const sequence = slot.sequence.load(std::memory_order_acquire);
+    auto const delta    = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position + 1);
+
+    if (delta == 0)
+    {
+      // the slot has been written for this lap, attempt to claim it
+      if (head_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (delta < 0)
+    {
+      // the queue is empty
+      return false;
+    }
+    else
+    {
+      position = head_.value.load(std::memory_order_relaxed);
+    }
+  }
+
+  ReadSlot(position, value);
+
+  return true;
+}
+
+/**
+ * Internal: Claim and write a single element to the queue without waking any parked consumers
+ *
+ * @param element The universal reference to the element
+ * @return true if the element was added, otherwise false (the queue is full)
+ */
+template <typename T, std::size_t N>
+template <typename U>
+bool MPMCRingQueue<T, N>::PushElement(U &&element)
+{
+  std::size_t position = tail_.value.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    Slot &slot = slots_[position & MASK];
+
+    auto const sequence = slot.sequence.load(std::memory_order_acquire);
+    auto const delta    = static_cast<intptr_t>(sequence) - static_cast<intptr_t>(position);
+
+    if (delta == 0)
+    {
+      // the slot has been read for the previous lap, attempt to claim it
+      if (tail_.value.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+      {
+        break;
+      }
+    }
+    else if (delta < 0)
+    {
+      // the queue is full
+      return false;
+    }
+    else
+    {
+      position = tail_.value.load(std::memory_order_relaxed);
+    }
+  }
+
+  T value(std::forward<U>(element));
+  WriteSlot(position, std::move(value));
+
+  return true;
+}
+
+/**
+ * Pop a batch of elements from the queue, waiting for up to the specified duration for the first
+ * element to become available.
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam Rep The tick representation for the duration
+ * @tparam Per The tick period for the duration
+ * @param values The vector to which the elements will be appended
+ * @param max_count The maximum number of elements to extract
+ * @param duration The maximum amount of time to wait for an element
+ * @return The number of elements extracted
+ */
+template <typename T, std::size_t N>
+template <typename Rep, typename Per>
+std::size_t MPMCRingQueue<T, N>::Pop(std::vector<T> &values, std::size_t max_count,
+                                     std::chrono::duration<Rep, Per> const &duration)
+{
+  Timepoint const deadline = Clock::now() + duration;
+
+  std::size_t count{0};
+  if (Wait(not_empty_,
+           [this, &values, &count, max_count]() {
+             count = PopElements(values, max_count);
+             return count > 0;
+           },
+           &deadline))
+  {
+    Wake(not_full_, true);
+  }
+
+  return count;
+}
+
+/**
+ * Attempt to pop a batch of elements from the queue without blocking. The slots are claimed as a
+ * single contiguous range.
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @param values The vector to which the elements will be appended
+ * @param max_count The maximum number of elements to extract
+ * @return The number of elements extracted
+ */
+template <typename T, std::size_t N>
+std::size_t MPMCRingQueue<T, N>::TryPop(std::vector<T> &values, std::size_t max_count)
+{
+  std::size_t const count = PopElements(values, max_count);
+
+  if (count > 0)
+  {
+    Wake(not_full_, true);
+  }
+
+  return count;
+}
+
+/**
+ * Internal: Claim and read a contiguous range of elements from the queue without waking any
+ * parked producers
+ *
+ * @param values The vector to which the elements will be appended
+ * @param max_count The maximum number of elements to extract
+ * @return The number of elements extracted
+ */
+template <typename T, std::size_t N>
+std::size_t MPMCRingQueue<T, N>::PopElements(std::vector<T> &values, std::size_t max_count)
+{
+  std::size_t       position{0};
+  std::size_t const count = ClaimForRead(max_count, position);
+
+  if (count > 0)
+  {
+    values.resize(values.size() + count);
+
+    auto it = values.end() - static_cast<std::ptrdiff_t>(count);
+    for (std::size_t i = 0; i < count; ++i, ++it)
+    {
+      ReadSlot(position + i, *it);
+    }
+  }
+
+  return count;
+}
+
+/**
+ * Push a range of elements onto the queue, moving them out of the range. The slots for the
+ * elements are claimed in contiguous blocks, blocking while the queue is full.
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @tparam Iterator The iterator type of the range
+ * @param begin The start of the range of elements
+ * @param end The end of the range of elements
+ */
+template <typename T, std::size_t N>
+template <typename Iterator>
+void MPMCRingQueue<T, N>::Push(Iterator begin, Iterator end)
+{
+  while (begin != end)
+  {
+    auto const remaining = static_cast<std::size_t>(std::distance(begin, end));
+
+    std::size_t count{0};
+    std::size_t position{0};
+    Wait(not_full_,
+         [this, &count, &position, remaining]() {
+           count = ClaimForWrite(remaining, position);
+           return count > 0;
+         },
+         nullptr);
+
+    for (std::size_t i = 0; i < count; ++i, ++begin)
+    {
+      WriteSlot(position + i, std::move(*begin));
+    }
+
+    Wake(not_empty_, true);
+  }
+}
+
+/**
+ * Get the (approximate) number of elements in the queue
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @return The number of elements
+ */
+template <typename T, std::size_t N>
+std::size_t MPMCRingQueue<T, N>::size() const
+{
+  std::size_t const head = head_.value.load(std::memory_order_acquire);
+  std::size_t const tail = tail_.value.load(std::memory_order_acquire);
+
+  return (tail > head) ? (tail - head) : 0;
+}
+
+/**
+ * Determine if the queue is (approximately) empty
+ *
+ * @tparam T The type of element to be stored in the queue
+ * @tparam N The max size of the queue
+ * @return true if the queue is empty, otherwise false
+ */
+template <typename T, std::size_t N>
+bool MPMCRingQueue<T, N>::empty() const
+{
+  return size() == 0;
+}
+
+/**
+ * Internal: Claim a contiguous range of slots to be written to
+ *
+ * Only slots which have already been claimed by a consumer on the previous lap are claimed, so the
+ * wait for any of them to become writable is bounded by that consumer completing its read.
+ *
+ * @param max_count The maximum number of slots to claim
+ * @param position The position of the first claimed slot
+ * @return The number of slots claimed
+ */
+template <typename T, std::size_t N>
+std::size_t MPMCRingQueue<T, N>::ClaimForWrite(std::size_t max_count, std::size_t &position)
+{
+  position = tail_.value.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    std::size_t const head = head_.value.load(std::memory_order_acquire);
+    std::size_t const used = position - head;
+
+    // the head can be observed to be ahead of a stale tail
+    if (used > N)
+    {
+      position = tail_.value.load(std::memory_order_relaxed);
+      continue;
+    }
+
+    std::size_t const count = std::min(max_count, N - used);
+    if (count == 0)
+    {
+      return 0;
+    }
+
+    if (tail_.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+    {
+      return count;
+    }
+  }
+}
+
+/**
+ * Internal: Claim a contiguous range of slots to be read from
+ *
+ * Only slots which have already been claimed by a producer are claimed, so the wait for any of
+ * them to become readable is bounded by that producer completing its write.
+ *
+ * @param max_count The maximum number of slots to claim
+ * @param position The position of the first claimed slot
+ * @return The number of slots claimed
+ */
+template <typename T, std::size_t N>
+std::size_t MPMCRingQueue<T, N>::ClaimForRead(std::size_t max_count, std::size_t &position)
+{
+  position = head_.value.load(std::memory_order_relaxed);
+
+  for (;;)
+  {
+    std::size_t const tail      = tail_.value.load(std::memory_order_acquire);
+    std::size_t const available = tail - position;
+
+    // the tail can be observed to be behind a more recent head
+    if (available > N)
+    {
+      position = head_.value.load(std::memory_order_relaxed);
+      continue;
+    }
+
+    std::size_t const count = std::min(max_count, available);
+    if (count == 0)
+    {
+      return 0;
+    }
+
+    if (head_.value.compare_exchange_weak(position, position + count, std::memory_order_relaxed))
+    {
+      return count;
+    }
+  }
+}
+
+/**
+ * Internal: Write an element into a claimed slot and publish it to the consumers
+ *
+ * @param position The position of the slot
+ * @param value The element to be written
+ */
+template <typename T, std::size_t N>
+void MPMCRingQueue<T, N>::WriteSlot(std::size_t position, T &&value)
+{
+  Slot &slot = slots_[position & MASK];
+
+  // wait for the consumer of the previous lap to finish with the slot
+  for (std::size_t spin = 0; slot.sequence.load(std::memory_order_acquire) != position; ++spin)
+  {
+    if (spin >= YIELD_THRESHOLD)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  slot.value = std::move(value);
+  slot.sequence.store(position + 1, std::memory_order_release);
+}
+
+/**
+ * Internal: Read an element from a claimed slot and release the slot to the producers
+ *
+ * @param position The position of the slot
+ * @param value The reference to the value to be populated
+ */
+template <typename T, std::size_t N>
+void MPMCRingQueue<T, N>::ReadSlot(std::size_t position, T &value)
+{
+  Slot &slot = slots_[position & MASK];
+
+  // wait for the producer to finish writing to the slot
+  for (std::size_t spin = 0; slot.sequence.load(std::memory_order_acquire) != position + 1;
+       ++spin)
+  {
+    if (spin >= YIELD_THRESHOLD)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  value = std::move(slot.value);
+
+  // ensure that resources held by the element are not kept alive by the queue
+  slot.value = T{};
+  slot.sequence.store(position + N, std::memory_order_release);
+}
+
+/**
+ * Internal: Repeatedly attempt an operation, spinning and then parking the thread until it
+ * succeeds or the optional deadline expires.
+ *
+ * The operation is run while the lock of the parking lot is held, it must therefore never wake
+ * (lock) any of the other parking lots.
+ *
+ * @param lot The set of waiting threads to park on
+ * @param operation The operation to be attempted, returning true on success
+ * @param deadline The optional deadline for the operation (nullptr if no deadline)
+ * @return true if the operation succeeded, otherwise false
+ */
+template <typename T, std::size_t N>
+template <typename Operation>
+bool MPMCRingQueue<T, N>::Wait(ParkingLot &lot, Operation &&operation, Timepoint const *deadline)
+{
+  // fast path: spin on the operation
+  for (std::size_t spin = 0; spin <= spin_count_; ++spin)
+  {
+    if (operation())
+    {
+      return true;
+    }
+
+    if (spin >= YIELD_THRESHOLD)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  // slow path: park the thread until signalled
+  std::unique_lock<std::mutex> lock(lot.lock);
+  lot.waiting.fetch_add(1, std::memory_order_seq_cst);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  bool success = operation();
+  while (!success)
+  {
+    if (deadline)
+    {
+      if (lot.condition.wait_until(lock, *deadline) == std::cv_status::timeout)
+      {
+        success = operation();
+        break;
+      }
+    }
+    else
+    {
+      lot.condition.wait(lock);
+    }
+
+    success = operation();
+  }
+
+  lot.waiting.fetch_sub(1, std::memory_order_relaxed);
+
+  return success;
+}
+
+/**
+ * Internal: Wake the threads (if any) that are parked waiting for the queue to change state
+ *
+ * @param lot The set of waiting threads
+ * @param all Flag to signal if all or only one of the threads should be woken
+ */
+template <typename T, std::size_t N>
+void MPMCRingQueue<T, N>::Wake(ParkingLot &lot, bool all)
+{
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (lot.waiting.load(std::memory_order_relaxed) > 0)
+  {
+    {
+      std::lock_guard<std::mutex> lock(lot.lock);
+    }
+
+    if (all)
+    {
+      lot.condition.notify_all();
+    }
+    else
+    {
+      lot.condition.notify_one();
+    }
+  }
+}
+
+}  // namespace core
+}  // namespace fetch
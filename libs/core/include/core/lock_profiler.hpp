@@ -0,0 +1,156 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/abstract_mutex.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+namespace fetch {
+namespace mutex {
+
+/**
+ * Contention statistics for all the mutexes constructed at a given site (file:line)
+ */
+struct LockSite
+{
+  std::string const file;
+  int const         line;
+
+  std::atomic<uint64_t> acquisitions{0};  ///< The number of times the lock was acquired
+  std::atomic<uint64_t> contentions{0};   ///< The number of acquisitions that had to wait
+  std::atomic<uint64_t> wait_ns{0};       ///< The total time spent waiting to acquire the lock
+  std::atomic<uint64_t> max_wait_ns{0};   ///< The longest wait to acquire the lock
+  std::atomic<uint64_t> hold_ns{0};       ///< The total time the lock was held
+  std::atomic<uint64_t> max_hold_ns{0};   ///< The longest time the lock was held
+
+  LockSite(std::string file_name, int line_number)
+    : file{std::move(file_name)}
+    , line{line_number}
+  {}
+};
+
+/**
+ * Per mutex instance state which is tracked by the profiler
+ */
+class MonitoredLock
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  // Construction / Destruction
+  MonitoredLock(AbstractMutex &mutex, std::string const &file, int line);
+  MonitoredLock(MonitoredLock const &) = delete;
+  MonitoredLock(MonitoredLock &&)      = delete;
+  ~MonitoredLock();
+
+  void Acquired(Timepoint const &started, Timepoint const &acquired, bool contended);
+  void Released(Timepoint const &released);
+
+  // Operators
+  MonitoredLock &operator=(MonitoredLock const &) = delete;
+  MonitoredLock &operator=(MonitoredLock &&) = delete;
+
+private:
+  AbstractMutex &       mutex_;
+  LockSite &            site_;
+  std::atomic<uint64_t> held_since_ns_{0};  ///< Time at which the lock was acquired (0 if free)
+  uint64_t              reported_ns_{0};    ///< The acquisition last reported by the watchdog
+
+  friend class LockProfiler;
+};
+
+/**
+ * Process wide lock profiler.
+ *
+ * Collects the wait and hold times of all the monitored mutexes aggregated by their construction
+ * site and runs a single watchdog thread which detects locks that have been held for longer than
+ * the deadlock timeout.
+ */
+class LockProfiler
+{
+public:
+  using Clock    = MonitoredLock::Clock;
+  using Duration = Clock::duration;
+
+  static constexpr std::size_t DEFAULT_REPORT_SIZE = 20;
+
+  struct HeldLock
+  {
+    std::string     description;
+    std::thread::id thread_id;
+  };
+
+  using HeldLocks = std::vector<HeldLock>;
+
+  // Singleton instance
+  static LockProfiler &Instance();
+
+  // Construction / Destruction
+  LockProfiler(LockProfiler const &) = delete;
+  LockProfiler(LockProfiler &&)      = delete;
+
+  void      SetTimeout(Duration const &timeout);
+  HeldLocks GetHeldLocks() const;
+  void      Report(std::ostream &stream, std::size_t max = DEFAULT_REPORT_SIZE) const;
+
+  // Operators
+  LockProfiler &operator=(LockProfiler const &) = delete;
+  LockProfiler &operator=(LockProfiler &&) = delete;
+
+private:
+  using SitePtr      = std::unique_ptr<LockSite>;
+  using SiteMap      = std::map<std::pair<std::string, int>, SitePtr>;
+  using MonitoredSet = std::unordered_set<MonitoredLock *>;
+
+  LockProfiler();
+  ~LockProfiler() = default;
+
+  LockSite &LookupSite(std::string const &file, int line);
+  void      Attach(MonitoredLock &lock);
+  void      Detach(MonitoredLock &lock);
+  void      Watchdog();
+
+  mutable std::mutex sites_lock_;
+  SiteMap            sites_;
+
+  mutable std::mutex monitored_lock_;
+  MonitoredSet       monitored_;
+
+  std::atomic<uint64_t> timeout_ns_;
+  std::once_flag        watchdog_started_;
+
+  friend class MonitoredLock;
+};
+
+}  // namespace mutex
+}  // namespace fetch
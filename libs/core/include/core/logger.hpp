@@ -18,7 +18,10 @@
 //------------------------------------------------------------------------------
 
 #include "core/abstract_mutex.hpp"
+#include "core/async_logger.hpp"
 #include "core/commandline/vt100.hpp"
+#include "core/lock_profiler.hpp"
+#include "core/macros.hpp"
 #include <atomic>
 #include <chrono>
 #include <ctime>
@@ -180,14 +183,7 @@ public:
   DefaultLogger()          = default;
   virtual ~DefaultLogger() = default;
 
-  enum class Level
-  {
-    ERROR     = 0,
-    WARNING   = 1,
-    INFO      = 2,
-    DEBUG     = 3,
-    HIGHLIGHT = 4
-  };
+  using Level = LogLevel;
 
   virtual void StartEntry(Level level, char const *name, shared_context_type ctx)
   {
@@ -301,6 +297,8 @@ public:
 
   ~LogWrapper()
   {
+    DisableAsync();
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (log_)
     {
@@ -310,12 +308,53 @@ public:
 
   void DisableLogger()
   {
+    DisableAsync();
+
     if (log_)
     {
       log_.reset();
     }
   }
 
+  /**
+   * Route subsequent named log records (i.e. the FETCH_LOG_* macros) through an asynchronous
+   * writer so that callers no longer format and emit output while holding the logger lock
+   *
+   * @param policy The behaviour when a thread's ring is full
+   * @param ring_size The size in bytes of each per-thread ring
+   */
+  void EnableAsync(AsyncLogger::OverflowPolicy policy    = AsyncLogger::OverflowPolicy::DROP,
+                   std::size_t                 ring_size = AsyncLogger::DEFAULT_RING_SIZE)
+  {
+#ifndef FETCH_DISABLE_COUT_LOGGING
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (async_ == nullptr)
+    {
+      // previous instances are never destroyed since other threads might still be using them
+      async_owners_.emplace_back(std::make_unique<AsyncLogger>(policy, ring_size));
+      async_owners_.back()->Start();
+      async_ = async_owners_.back().get();
+    }
+#else
+    FETCH_UNUSED(policy);
+    FETCH_UNUSED(ring_size);
+#endif
+  }
+
+  /**
+   * Revert to synchronous logging, writing any records which are still queued
+   */
+  void DisableAsync()
+  {
+    AsyncLogger *async = async_.exchange(nullptr);
+    if (async != nullptr)
+    {
+      // the instance is retained since other threads might still be submitting to it, any such
+      // records are rejected and logged through the synchronous path instead
+      async->Stop();
+    }
+  }
+
   template <typename... Args>
   void Info(Args &&... args)
   {
@@ -331,6 +370,11 @@ public:
   template <typename... Args>
   void InfoWithName(char const *name, Args &&... args)
   {
+    if (LogAsync(DefaultLogger::Level::INFO, name, args...))
+    {
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (this->log_ != nullptr)
     {
@@ -355,6 +399,11 @@ public:
   template <typename... Args>
   void WarnWithName(char const *name, Args &&... args)
   {
+    if (LogAsync(DefaultLogger::Level::WARNING, name, args...))
+    {
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (this->log_ != nullptr)
     {
@@ -379,6 +428,11 @@ public:
   template <typename... Args>
   void HighlightWithName(char const *name, Args &&... args)
   {
+    if (LogAsync(DefaultLogger::Level::HIGHLIGHT, name, args...))
+    {
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (this->log_ != nullptr)
     {
@@ -407,6 +461,24 @@ public:
   template <typename... Args>
   void ErrorWithName(char const *name, Args &&... args)
   {
+    if (LogAsync(DefaultLogger::Level::ERROR, name, args...))
+    {
+      // ensure the record has been emitted before the trace is printed
+      AsyncLogger *async = async_;
+      if (async != nullptr)
+      {
+        async->Flush();
+      }
+
+      std::lock_guard<std::mutex> lock(mutex_);
+      if (this->log_ != nullptr)
+      {
+        StackTrace();
+      }
+
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (this->log_ != nullptr)
     {
@@ -435,6 +507,11 @@ public:
   template <typename... Args>
   void DebugWithName(char const *name, Args const &... args)
   {
+    if (LogAsync(DefaultLogger::Level::DEBUG, name, args...))
+    {
+      return;
+    }
+
     std::lock_guard<std::mutex> lock(mutex_);
     if (this->log_ != nullptr)
     {
@@ -474,51 +551,6 @@ public:
     return TopContextImpl();
   }
 
-  void RegisterLock(fetch::mutex::AbstractMutex *ptr)
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (this->log_ != nullptr)
-    {
-      active_locks_.insert(ptr);
-    }
-  }
-
-  void RegisterUnlock(fetch::mutex::AbstractMutex *ptr, double spent_time,
-                      const std::string &filename, int line)
-  {
-    std::lock_guard<std::mutex> lock(mutex_);
-    if (this->log_ != nullptr)
-    {
-      std::stringstream ss;
-      ss << filename << line;
-      std::string s = ss.str();
-      if (mutex_timings_.find(s) == mutex_timings_.end())
-      {
-        TimingDetails t;
-        t.line     = line;
-        t.context  = "Mutex";
-        t.filename = filename;
-
-        mutex_timings_[s] = t;
-      }
-
-      auto &t = mutex_timings_[s];
-      t.total += spent_time;
-      if (t.peak < spent_time)
-      {
-        t.peak = spent_time;
-      }
-
-      ++t.calls;
-
-      auto it = active_locks_.find(ptr);
-      if (it != active_locks_.end())
-      {
-        active_locks_.erase(it);
-      }
-    }
-  }
-
   void StackTrace(shared_context_type ctx, uint32_t max = uint32_t(-1), bool show_locks = true,
                   std::string const &trace_name = "Stack trace")
   {
@@ -539,10 +571,10 @@ public:
 
       std::cout << std::endl;
       std::cout << "Active locks: " << std::endl;
-      for (auto &l : active_locks_)
+      for (auto const &l : fetch::mutex::LockProfiler::Instance().GetHeldLocks())
       {
-        std::cout << "  - " << l->AsString() << std::endl;
-        locked_threads.push_back(l->thread_id());
+        std::cout << "  - " << l.description << std::endl;
+        locked_threads.push_back(l.thread_id);
       }
       std::cout << std::endl;
       for (auto &id : locked_threads)
@@ -619,33 +651,7 @@ public:
 
   void PrintMutexTimings(std::size_t max = 50)
   {
-    std::lock_guard<std::mutex> lock2(mutex_);
-    std::lock_guard<std::mutex> lock(timing_mutex_);
-
-    std::vector<TimingDetails> all_timings;
-    for (auto &t : mutex_timings_)
-    {
-      all_timings.push_back(t.second);
-    }
-
-    std::sort(all_timings.begin(), all_timings.end(),
-              [](TimingDetails const &a, TimingDetails const &b) {
-                return (double(a.total) / double(a.calls)) > (double(b.total) / double(b.calls));
-              });
-    std::size_t N = std::min(max, all_timings.size());
-
-    std::cout << "Mutex timings: " << std::endl;
-    for (std::size_t i = 0; i < N; ++i)
-    {
-      std::cout << std::setw(3) << i << std::setw(20)
-                << double(all_timings[i].total) / double(all_timings[i].calls) << " ";
-      std::cout << std::setw(20) << all_timings[i].peak << " ";
-      std::cout << std::setw(20) << all_timings[i].calls << " ";
-      std::cout << std::setw(20) << all_timings[i].total << " ";
-      std::cout << all_timings[i].context << " " << all_timings[i].filename << " "
-                << all_timings[i].line;
-      std::cout << std::endl;
-    }
+    fetch::mutex::LockProfiler::Instance().Report(std::cout, max);
     std::cout << std::endl;
   }
 
@@ -660,9 +666,6 @@ private:
     std::string filename;
   };
 
-  std::unordered_set<fetch::mutex::AbstractMutex *> active_locks_;
-  std::unordered_map<std::string, TimingDetails>    mutex_timings_;
-
   std::unordered_map<std::string, TimingDetails> timings_;
 
   mutable std::mutex timing_mutex_;
@@ -687,6 +690,13 @@ private:
     return ret;
   }
 
+  template <typename... Args>
+  bool LogAsync(DefaultLogger::Level level, char const *name, Args const &... args)
+  {
+    AsyncLogger *async = async_.load(std::memory_order_acquire);
+    return (async != nullptr) && async->Log(level, name, args...);
+  }
+
   template <typename T, typename... Args>
   struct Unroll
   {
@@ -738,6 +748,8 @@ private:
   std::unique_ptr<DefaultLogger>                           log_;
   mutable std::mutex                                       mutex_;
   std::unordered_map<std::thread::id, shared_context_type> context_;
+  std::atomic<AsyncLogger *>                               async_{nullptr};
+  std::vector<std::unique_ptr<AsyncLogger>>                async_owners_;
 };
 }  // namespace details
 }  // namespace log
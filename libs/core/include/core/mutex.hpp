@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/lock_profiler.hpp"
 #include "core/logger.hpp"
 #include "core/macros.hpp"
 
@@ -43,85 +44,20 @@ public:
 /**
  * The debug mutex acts like a normal mutex but also contains several other checks. This code is
  * intended to be only used in software development.
+ *
+ * The wait and hold times of each acquisition are recorded by the lock profiler, whose watchdog
+ * terminates the system if the mutex is held for longer than the timeout.
  */
 class DebugMutex : public AbstractMutex
 {
-  using Clock     = std::chrono::high_resolution_clock;
-  using Timepoint = Clock::time_point;
-  using Duration  = Clock::duration;
-
-  static constexpr char const *LOGGING_NAME = "DebugMutex";
-
-  struct LockInfo
-  {
-    bool locked = true;
-  };
-
-  class MutexTimeout
-  {
-  public:
-    static constexpr std::size_t DEFAULT_TIMEOUT_MS = 3000;
-
-    MutexTimeout(std::string filename, int const &line, std::size_t timeout_ms = DEFAULT_TIMEOUT_MS)
-      : filename_(std::move(filename))
-      , line_(line)
-    {
-      LOG_STACK_TRACE_POINT;
-
-      thread_ = std::thread([=]() {
-        LOG_LAMBDA_STACK_TRACE_POINT;
-
-        // define the point at which the deadline has been reached
-        Timepoint const deadline = created_ + std::chrono::milliseconds(timeout_ms);
-
-        while (running_)
-        {
-          // exit waiting loop when the dead line has been reached
-          if (Clock::now() >= deadline)
-          {
-            break;
-          }
-
-          // wait
-          std::this_thread::sleep_for(std::chrono::milliseconds(1));
-        }
-
-        if (running_)
-        {
-          this->Eval();
-        }
-      });
-    }
-
-    ~MutexTimeout()
-    {
-      running_ = false;
-      thread_.join();
-    }
-
-    void Eval()
-    {
-      LOG_STACK_TRACE_POINT;
-      FETCH_LOG_ERROR(LOGGING_NAME, "The system will terminate, mutex timed out: ", filename_, " ",
-                      line_);
-
-      // Send a sigint to ourselves since we have a handler for this
-      kill(0, SIGINT);
-    }
-
-  private:
-    std::string       filename_;
-    int               line_;
-    std::thread       thread_;
-    Timepoint         created_ = Clock::now();
-    std::atomic<bool> running_{true};
-  };
+  using Clock = MonitoredLock::Clock;
 
 public:
   DebugMutex(int line, std::string file)
     : AbstractMutex()
     , line_(line)
     , file_(std::move(file))
+    , monitor_(*this, file_, line_)
   {}
 
   // TODO(ejf) No longer required?
@@ -131,32 +67,22 @@ public:
 
   void lock()
   {
-    LOG_STACK_TRACE_POINT;
-    lock_mutex_.lock();
-    locked_ = Clock::now();
-    lock_mutex_.unlock();
+    auto const started = Clock::now();
 
-    std::mutex::lock();
+    // only the contended path has to wait
+    bool const contended = !std::mutex::try_lock();
+    if (contended)
+    {
+      std::mutex::lock();
+    }
 
-    timeout_ = std::make_unique<MutexTimeout>(file_, line_);
-    fetch::logger.RegisterLock(this);
+    monitor_.Acquired(started, Clock::now(), contended);
     thread_id_ = std::this_thread::get_id();
   }
 
   void unlock()
   {
-    LOG_STACK_TRACE_POINT;
-
-    lock_mutex_.lock();
-    Timepoint const end_time   = Clock::now();
-    Duration const  delta_time = end_time - locked_;
-    double          total_time = static_cast<double>(
-        std::chrono::duration_cast<std::chrono::milliseconds>(delta_time).count());
-
-    lock_mutex_.unlock();
-
-    timeout_.reset(nullptr);
-    fetch::logger.RegisterUnlock(this, total_time, file_, line_);
+    monitor_.Released(Clock::now());
 
     std::mutex::unlock();
   }
@@ -185,13 +111,10 @@ public:
   }
 
 private:
-  std::mutex lock_mutex_;
-  Timepoint locked_ FETCH_GUARDED_BY(lock_mutex_);  ///< The time when the mutex was locked
-  std::thread::id   thread_id_;                     ///< The last thread to lock the mutex
-
-  int                           line_ = 0;   ///< The line number of the mutex
-  std::string                   file_ = "";  ///< The filename of the mutex
-  std::unique_ptr<MutexTimeout> timeout_;    ///< The timeout monitor for this mutex
+  std::thread::id thread_id_;  ///< The last thread to lock the mutex
+  int             line_ = 0;   ///< The line number of the mutex
+  std::string     file_ = "";  ///< The filename of the mutex
+  MonitoredLock   monitor_;    ///< The profiler state for this mutex
 };
 
 #ifdef NDEBUG
@@ -19,6 +19,7 @@
 
 #include "core/mutex.hpp"
 #include "core/runnable.hpp"
+#include "core/wakeup_signal.hpp"
 
 #include <atomic>
 #include <map>
@@ -54,6 +55,7 @@ private:
   using RunnableMap = std::map<Runnable const *, WeakRunnable>;
   using Flag        = std::atomic<bool>;
   using ThreadPtr   = std::unique_ptr<std::thread>;
+  using WakeupPtr   = Runnable::WakeupPtr;
 
   void StartWorker();
   void StopWorker();
@@ -61,6 +63,7 @@ private:
 
   std::string const name_;
   Flag              running_{false};
+  WakeupPtr         wakeup_{std::make_shared<WakeupSignal>()};
 
   Mutex       work_map_mutex_{__LINE__, __FILE__};
   RunnableMap work_map_{};
@@ -17,7 +17,11 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/wakeup_signal.hpp"
+
+#include <chrono>
 #include <memory>
+#include <mutex>
 
 namespace fetch {
 namespace core {
@@ -28,6 +32,10 @@ namespace core {
 class Runnable
 {
 public:
+  using Clock     = WakeupSignal::Clock;
+  using Timepoint = WakeupSignal::Timepoint;
+  using WakeupPtr = std::shared_ptr<WakeupSignal>;
+
   // Construction / Destruction
   Runnable()          = default;
   virtual ~Runnable() = default;
@@ -38,14 +46,49 @@ public:
   {
     return true;
   }
+
+  /**
+   * The earliest point at which the runnable will become ready (if it is not ready now). Runnables
+   * which return Timepoint::max() become ready only when Notify() is called.
+   */
+  virtual Timepoint GetNextExecutionTime() const
+  {
+    return Timepoint::max();
+  }
+
   virtual void Execute() = 0;
   /// @}
 
+  /**
+   * Signal that the runnable might have become ready, waking the reactor it is attached to
+   */
+  virtual void Notify()
+  {
+    std::lock_guard<std::mutex> lock(wakeup_mutex_);
+
+    auto wakeup = wakeup_.lock();
+    if (wakeup)
+    {
+      wakeup->Signal();
+    }
+  }
+
+  /// Called by the reactor when the runnable is attached
+  void SetWakeup(WakeupPtr const &wakeup)
+  {
+    std::lock_guard<std::mutex> lock(wakeup_mutex_);
+    wakeup_ = wakeup;
+  }
+
   // Helper operators
   void operator()()
   {
     Execute();
   }
+
+private:
+  std::mutex                  wakeup_mutex_;
+  std::weak_ptr<WakeupSignal> wakeup_;
 };
 
 using WeakRunnable = std::weak_ptr<Runnable>;
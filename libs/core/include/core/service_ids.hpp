@@ -42,6 +42,10 @@ static constexpr uint16_t CHANNEL_ROUTING = 1;
 // Main Chain Service Channels
 static constexpr uint16_t CHANNEL_BLOCKS = 2;
 
+// Lane Control Service Channels
+static constexpr uint16_t CHANNEL_TX_FEED        = 2;
+static constexpr uint16_t CHANNEL_TX_FEED_CREDIT = 3;
+
 // RPC Protocol identifiers
 static constexpr uint64_t RPC_MAIN_CHAIN = 128;
 
@@ -82,8 +82,10 @@ public:
 
   /// @name Runnable Interface
   /// @{
-  bool IsReadyToExecute() const override;
-  void Execute() override;
+  bool      IsReadyToExecute() const override;
+  Timepoint GetNextExecutionTime() const override;
+  void      Execute() override;
+  void      Notify() override;
   /// @}
 
   State state() const
@@ -99,8 +101,6 @@ public:
   StateMachine &operator=(StateMachine &&) = delete;
 
 private:
-  using Clock       = std::chrono::steady_clock;
-  using Timepoint   = Clock::time_point;
   using Duration    = Clock::duration;
   using CallbackMap = std::unordered_map<State, Callback>;
   using Mutex       = std::mutex;
@@ -114,6 +114,7 @@ private:
   std::atomic<State>  current_state_;
   std::atomic<State>  previous_state_{current_state_.load()};
   Timepoint           next_execution_{};
+  std::atomic<bool>   notified_{false};
   StateChangeCallback state_change_callback_{};
 };
 
@@ -282,7 +283,7 @@ bool StateMachine<S>::IsReadyToExecute() const
 {
   bool ready{true};
 
-  if (next_execution_.time_since_epoch().count())
+  if (!notified_ && next_execution_.time_since_epoch().count())
   {
     ready = (Clock::now() >= next_execution_);
   }
@@ -290,6 +291,23 @@ bool StateMachine<S>::IsReadyToExecute() const
   return ready;
 }
 
+/**
+ * Determine the point at which the state machine should be next executed
+ *
+ * @tparam S The state enum type
+ * @return The time of the next execution (in the past if the state machine is ready now)
+ */
+template <typename S>
+typename StateMachine<S>::Timepoint StateMachine<S>::GetNextExecutionTime() const
+{
+  if (notified_)
+  {
+    return Timepoint{};
+  }
+
+  return next_execution_;
+}
+
 /**
  * Execute the state machine (called from the reactor)
  *
@@ -300,6 +318,9 @@ void StateMachine<S>::Execute()
 {
   FETCH_LOCK(callbacks_mutex_);
 
+  // clear any notification before running the handler so that one raised during it is not lost
+  notified_ = false;
+
   // loop up the current state event callback map
   auto it = callbacks_.find(current_state_);
   if (it != callbacks_.end())
@@ -323,6 +344,23 @@ void StateMachine<S>::Execute()
   }
 }
 
+/**
+ * Cut short any pending delay and wake the reactor so that the state machine is executed promptly
+ *
+ * Note: Can be called from any thread
+ *
+ * @tparam S The state enum type
+ */
+template <typename S>
+void StateMachine<S>::Notify()
+{
+  // only the first notification needs to wake the reactor
+  if (!notified_.exchange(true))
+  {
+    Runnable::Notify();
+  }
+}
+
 /**
  * Configure the next execution of the state machine for a future point
  *
@@ -0,0 +1,84 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace fetch {
+namespace core {
+
+/**
+ * A latching wakeup signal (similar to an eventfd). Signals raised while nobody is waiting are
+ * remembered so that the next wait returns immediately, multiple signals collapse into one.
+ */
+class WakeupSignal
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  // Construction / Destruction
+  WakeupSignal()                     = default;
+  WakeupSignal(WakeupSignal const &) = delete;
+  WakeupSignal(WakeupSignal &&)      = delete;
+  ~WakeupSignal()                    = default;
+
+  /**
+   * Raise the signal, waking the waiter if there is one
+   */
+  void Signal()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      pending_ = true;
+    }
+
+    condition_.notify_one();
+  }
+
+  /**
+   * Wait until the signal is raised or the deadline has been reached. The signal is cleared.
+   *
+   * @param deadline The latest point at which to return
+   * @return true if the signal was raised, otherwise false
+   */
+  bool WaitUntil(Timepoint const &deadline)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait_until(lock, deadline, [this]() { return pending_; });
+
+    bool const signalled = pending_;
+    pending_             = false;
+
+    return signalled;
+  }
+
+  // Operators
+  WakeupSignal &operator=(WakeupSignal const &) = delete;
+  WakeupSignal &operator=(WakeupSignal &&) = delete;
+
+private:
+  std::mutex              mutex_;
+  std::condition_variable condition_;
+  bool                    pending_{false};
+};
+
+}  // namespace core
+}  // namespace fetch
@@ -0,0 +1,657 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/async_logger.hpp"
+#include "core/commandline/vt100.hpp"
+#include "core/logger.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <iomanip>
+#include <limits>
+#include <utility>
+
+namespace fetch {
+namespace log {
+namespace {
+
+using fetch::commandline::VT100::DefaultAttributes;
+using fetch::commandline::VT100::GetColor;
+
+using RecordLength = uint32_t;
+
+constexpr char const *LOGGING_NAME    = "AsyncLogger";
+constexpr auto        WRITER_INTERVAL = std::chrono::milliseconds{10};
+constexpr auto        WAIT_INTERVAL   = std::chrono::milliseconds{1};
+
+std::atomic<uint64_t> next_instance_id{1};
+
+struct LevelFormat
+{
+  char const *name;
+  int         color;
+  int         bg_color;
+};
+
+/**
+ * Determine the name and colours used when displaying a given level. Mirrors the layout of the
+ * default (synchronous) logger.
+ */
+LevelFormat GetLevelFormat(LogLevel level)
+{
+  switch (level)
+  {
+  case LogLevel::INFO:
+    return {"INFO  ", 3, 9};
+  case LogLevel::WARNING:
+    return {"WARN  ", 6, 9};
+  case LogLevel::ERROR:
+    return {"ERROR ", 1, 9};
+  case LogLevel::DEBUG:
+    return {"DEBUG ", 7, 9};
+  case LogLevel::HIGHLIGHT:
+    return {"HLIGHT", 7, 4};
+  }
+
+  return {"UNKNWN", 9, 9};
+}
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value)
+{
+  std::size_t size = 1;
+  while (size < value)
+  {
+    size <<= 1u;
+  }
+  return size;
+}
+
+template <typename T>
+T Extract(std::string const &record, std::size_t &offset)
+{
+  T value;
+  std::memcpy(&value, record.data() + offset, sizeof(T));
+  offset += sizeof(T);
+  return value;
+}
+
+}  // namespace
+
+namespace detail {
+
+void RecordEncoder::Reset(LogLevel level, char const *name)
+{
+  using Clock = std::chrono::system_clock;
+
+  auto const timestamp = static_cast<uint64_t>(
+      std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now().time_since_epoch())
+          .count());
+  auto const name_length =
+      static_cast<uint16_t>((name != nullptr) ? std::char_traits<char>::length(name) : 0);
+
+  buffer_.clear();
+  Put(static_cast<uint8_t>(level));
+  Put(timestamp);
+  Put(name_length);
+  buffer_.append(name, name_length);
+}
+
+void RecordEncoder::AppendString(char const *data, std::size_t length)
+{
+  Put(ArgType::STRING);
+  Put(static_cast<RecordLength>(length));
+  buffer_.append(data, length);
+}
+
+}  // namespace detail
+
+/**
+ * Single-producer / single-consumer byte ring owned by one logging thread. Records are stored as a
+ * length prefix followed by the encoded record, and may wrap around the end of the buffer.
+ */
+class AsyncLogger::Ring
+{
+public:
+  Ring(std::size_t size, int thread_number)
+    : buffer_(RoundUpToPowerOfTwo(size))
+    , mask_(buffer_.size() - 1)
+    , thread_number_(thread_number)
+  {}
+
+  // producer side
+  bool Fits(std::size_t length) const
+  {
+    return (sizeof(RecordLength) + length) <= buffer_.size();
+  }
+
+  bool TryWrite(std::string const &record)
+  {
+    auto const length   = static_cast<RecordLength>(record.size());
+    auto const required = sizeof(RecordLength) + record.size();
+    auto const head     = head_.load(std::memory_order_relaxed);
+    auto const tail     = tail_.load(std::memory_order_acquire);
+
+    if (required > (buffer_.size() - (head - tail)))
+    {
+      return false;
+    }
+
+    Copy(head, &length, sizeof(length));
+    Copy(head + sizeof(length), record.data(), record.size());
+    head_.store(head + required, std::memory_order_release);
+
+    submitted_.store(submitted_.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    return true;
+  }
+
+  void RecordDrop()
+  {
+    pending_drops_.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  bool MoreThanHalfFull() const
+  {
+    auto const used = head_.load(std::memory_order_relaxed) - tail_.load(std::memory_order_relaxed);
+    return (used * 2) >= buffer_.size();
+  }
+
+  void Close()
+  {
+    closed_ = true;
+  }
+
+  // consumer side
+  uint64_t head() const
+  {
+    return head_.load(std::memory_order_acquire);
+  }
+
+  uint64_t tail() const
+  {
+    return tail_.load(std::memory_order_relaxed);
+  }
+
+  uint64_t ReadRecord(uint64_t position, std::string &record) const
+  {
+    RecordLength length = 0;
+    Read(position, &length, sizeof(length));
+
+    record.resize(length);
+    Read(position + sizeof(length), &record[0], length);
+
+    return position + sizeof(length) + length;
+  }
+
+  void Release(uint64_t position)
+  {
+    tail_.store(position, std::memory_order_release);
+  }
+
+  uint64_t TakeDrops()
+  {
+    return pending_drops_.exchange(0, std::memory_order_relaxed);
+  }
+
+  bool IsRetired() const
+  {
+    return closed_ && (head() == tail());
+  }
+
+  uint64_t submitted() const
+  {
+    return submitted_.load(std::memory_order_relaxed);
+  }
+
+  int thread_number() const
+  {
+    return thread_number_;
+  }
+
+private:
+  void Copy(uint64_t position, void const *data, std::size_t length)
+  {
+    auto const offset = static_cast<std::size_t>(position & mask_);
+    auto const first  = std::min(length, buffer_.size() - offset);
+    auto const input  = reinterpret_cast<char const *>(data);
+
+    std::memcpy(&buffer_[offset], input, first);
+    std::memcpy(&buffer_[0], input + first, length - first);
+  }
+
+  void Read(uint64_t position, void *data, std::size_t length) const
+  {
+    auto const offset = static_cast<std::size_t>(position & mask_);
+    auto const first  = std::min(length, buffer_.size() - offset);
+    auto const output = reinterpret_cast<char *>(data);
+
+    std::memcpy(output, &buffer_[offset], first);
+    std::memcpy(output + first, &buffer_[0], length - first);
+  }
+
+  std::vector<char> buffer_;
+  uint64_t const    mask_;
+  int const         thread_number_;
+  std::atomic<bool> closed_{false};
+
+  // producer and consumer indices are kept on separate cache lines
+  alignas(64) std::atomic<uint64_t> head_{0};
+  std::atomic<uint64_t> submitted_{0};
+  std::atomic<uint64_t> pending_drops_{0};
+  alignas(64) std::atomic<uint64_t> tail_{0};
+};
+
+/**
+ * Construct an asynchronous logger. The writer is not started until Start() is called, however
+ * records may be queued beforehand.
+ *
+ * @param policy The behaviour when a producer's ring is full
+ * @param ring_size The size in bytes of each of the per-thread rings
+ * @param output The stream to which the formatted records are written
+ */
+AsyncLogger::AsyncLogger(OverflowPolicy policy, std::size_t ring_size, std::ostream &output)
+  : policy_{policy}
+  , ring_size_{ring_size}
+  , output_(output)
+  , instance_id_{next_instance_id++}
+{}
+
+AsyncLogger::~AsyncLogger()
+{
+  Stop();
+}
+
+/**
+ * Start the background writer thread
+ */
+void AsyncLogger::Start()
+{
+  stopped_ = false;
+
+  if (!running_.exchange(true))
+  {
+    writer_ = std::make_unique<std::thread>(&AsyncLogger::WriterLoop, this);
+  }
+}
+
+/**
+ * Stop the background writer, emitting all the records which have been queued so far. Records
+ * logged after this point are rejected.
+ */
+void AsyncLogger::Stop()
+{
+  stopped_ = true;
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+
+  if (running_.exchange(false))
+  {
+    WakeWriter();
+    writer_->join();
+    writer_.reset();
+  }
+
+  Drain();
+}
+
+/**
+ * Block until all records queued (by any thread) before this call have been written
+ */
+void AsyncLogger::Flush()
+{
+  if (!running_)
+  {
+    Drain();
+    return;
+  }
+
+  std::vector<std::pair<RingPtr, uint64_t>> targets;
+  for (auto const &ring : SnapshotRings())
+  {
+    targets.emplace_back(ring, ring->head());
+  }
+
+  auto const is_flushed = [&targets]() {
+    return std::all_of(targets.begin(), targets.end(), [](auto const &target) {
+      return target.first->tail() >= target.second;
+    });
+  };
+
+  std::unique_lock<std::mutex> lock(wake_lock_);
+  while (running_ && !is_flushed())
+  {
+    wake_.notify_one();
+    drained_.wait_for(lock, WAIT_INTERVAL);
+  }
+}
+
+/**
+ * Get a snapshot of the logger statistics
+ *
+ * @return The current statistics
+ */
+AsyncLogger::Statistics AsyncLogger::GetStatistics() const
+{
+  Statistics stats;
+  stats.submitted = retired_submitted_;
+  stats.dropped   = dropped_;
+  stats.written   = written_;
+
+  for (auto const &ring : SnapshotRings())
+  {
+    stats.submitted += ring->submitted();
+  }
+
+  return stats;
+}
+
+detail::RecordEncoder &AsyncLogger::Encoder()
+{
+  thread_local detail::RecordEncoder encoder;
+  return encoder;
+}
+
+/**
+ * Place an encoded record into the calling thread's ring
+ *
+ * @param record The encoded record
+ * @return true if the record was handled, false if it is too large to ever fit into the ring
+ */
+bool AsyncLogger::Submit(std::string const &record)
+{
+  if (stopped_)
+  {
+    return false;
+  }
+
+  Ring &ring = LocalRing();
+
+  if (!ring.Fits(record.size()))
+  {
+    return false;
+  }
+
+  while (!ring.TryWrite(record))
+  {
+    // when configured to block the producer can only make progress while the writer is running
+    if ((policy_ == OverflowPolicy::DROP) || !running_)
+    {
+      ring.RecordDrop();
+      dropped_.fetch_add(1, std::memory_order_relaxed);
+      return true;
+    }
+
+    std::unique_lock<std::mutex> lock(wake_lock_);
+    wake_.notify_one();
+    drained_.wait_for(lock, WAIT_INTERVAL);
+  }
+
+  // the logger might have been stopped (and drained) while the record was being written, in which
+  // case nothing else will emit it
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (stopped_)
+  {
+    Drain();
+  }
+  else if (ring.MoreThanHalfFull())
+  {
+    // prompt the writer early rather than waiting for its next interval when the ring fills up
+    WakeWriter();
+  }
+
+  return true;
+}
+
+/**
+ * Lookup (creating if necessary) the ring belonging to the calling thread. The ring is marked as
+ * closed when the thread exits, after which the writer discards it once drained.
+ *
+ * @return The ring for the calling thread
+ */
+AsyncLogger::Ring &AsyncLogger::LocalRing()
+{
+  struct LocalHandle
+  {
+    RingPtr  ring;
+    uint64_t owner{0};
+
+    ~LocalHandle()
+    {
+      if (ring)
+      {
+        ring->Close();
+      }
+    }
+  };
+
+  thread_local LocalHandle handle;
+
+  if (handle.owner != instance_id_)
+  {
+    // the thread was previously logging to a different instance
+    if (handle.ring)
+    {
+      handle.ring->Close();
+    }
+
+    handle.ring  = std::make_shared<Ring>(ring_size_,
+                                         ReadableThread::GetThreadID(std::this_thread::get_id()));
+    handle.owner = instance_id_;
+
+    std::lock_guard<std::mutex> lock(registry_lock_);
+    rings_.push_back(handle.ring);
+  }
+
+  return *handle.ring;
+}
+
+void AsyncLogger::WakeWriter()
+{
+  wake_.notify_one();
+}
+
+void AsyncLogger::WriterLoop()
+{
+  while (running_)
+  {
+    {
+      std::unique_lock<std::mutex> lock(wake_lock_);
+      wake_.wait_for(lock, WRITER_INTERVAL);
+    }
+
+    Drain();
+  }
+}
+
+/**
+ * Emit all the records currently queued in the rings, ordered by their timestamp. Ring space is
+ * only released once the records have been written.
+ */
+void AsyncLogger::Drain()
+{
+  struct Entry
+  {
+    uint64_t    timestamp;
+    std::string text;
+  };
+
+  std::lock_guard<std::mutex> guard(drain_lock_);
+
+  auto const rings = SnapshotRings();
+
+  std::vector<Entry>                       entries;
+  std::vector<std::pair<Ring *, uint64_t>> positions;
+  std::string                              record;
+  std::ostringstream                       text;
+  uint64_t                                 num_records = 0;
+
+  for (auto const &ring : rings)
+  {
+    auto const head     = ring->head();
+    auto       position = ring->tail();
+
+    while (position < head)
+    {
+      position = ring->ReadRecord(position, record);
+
+      text.str({});
+      Format(*ring, record, text);
+
+      std::size_t offset = sizeof(uint8_t);
+      entries.push_back({Extract<uint64_t>(record, offset), text.str()});
+      ++num_records;
+    }
+
+    // report any records which could not be queued
+    auto const drops = ring->TakeDrops();
+    if (drops != 0)
+    {
+      detail::RecordEncoder notice;
+      notice.Reset(LogLevel::WARNING, LOGGING_NAME);
+      notice.Append("Dropped ");
+      notice.Append(drops);
+      notice.Append(" log records (ring full)");
+
+      text.str({});
+      Format(*ring, notice.record(), text);
+
+      std::size_t offset = sizeof(uint8_t);
+      entries.push_back({Extract<uint64_t>(notice.record(), offset), text.str()});
+    }
+
+    positions.emplace_back(ring.get(), head);
+  }
+
+  if (!entries.empty())
+  {
+    std::stable_sort(entries.begin(), entries.end(), [](Entry const &a, Entry const &b) {
+      return a.timestamp < b.timestamp;
+    });
+
+    for (auto const &entry : entries)
+    {
+      output_ << entry.text;
+    }
+    output_.flush();
+  }
+
+  for (auto const &position : positions)
+  {
+    position.first->Release(position.second);
+  }
+
+  written_.fetch_add(num_records, std::memory_order_relaxed);
+
+  // discard the rings of threads which have exited
+  {
+    std::lock_guard<std::mutex> lock(registry_lock_);
+    auto const it = std::remove_if(rings_.begin(), rings_.end(), [this](RingPtr const &ring) {
+      if (ring->IsRetired())
+      {
+        retired_submitted_ += ring->submitted();
+        return true;
+      }
+      return false;
+    });
+    rings_.erase(it, rings_.end());
+  }
+
+  drained_.notify_all();
+}
+
+/**
+ * Format an encoded record in the layout of the default logger
+ *
+ * @param ring The ring from which the record was read
+ * @param record The encoded record
+ * @param out The stream to be populated
+ */
+void AsyncLogger::Format(Ring const &ring, std::string const &record, std::ostringstream &out)
+{
+  using RecordEncoder = detail::RecordEncoder;
+
+  std::size_t offset      = 0;
+  auto const  level       = static_cast<LogLevel>(Extract<uint8_t>(record, offset));
+  auto const  timestamp   = Extract<uint64_t>(record, offset);
+  auto const  name_length = Extract<uint16_t>(record, offset);
+  auto const  format      = GetLevelFormat(level);
+
+  // the time string only changes once a second so it is cached between records
+  auto const seconds = static_cast<std::time_t>(timestamp / 1000000000ull);
+  auto const millis  = (timestamp / 1000000ull) % 1000ull;
+  if (time_prefix_.empty() || (seconds != last_second_))
+  {
+    std::tm local_time{};
+    localtime_r(&seconds, &local_time);
+
+    char buffer[32];
+    std::strftime(buffer, sizeof(buffer), "%F %T", &local_time);
+
+    last_second_ = seconds;
+    time_prefix_ = buffer;
+  }
+
+  auto const colour = GetColor(format.color, format.bg_color);
+
+  out << "[ " << colour << time_prefix_ << "." << std::setw(3) << millis << DefaultAttributes();
+  out << ", #" << std::setw(2) << ring.thread_number() << ' ' << format.name;
+  out << ": " << std::setw(35) << record.substr(offset, name_length) << " ] " << colour;
+  offset += name_length;
+
+  while (offset < record.size())
+  {
+    switch (static_cast<RecordEncoder::ArgType>(Extract<uint8_t>(record, offset)))
+    {
+    case RecordEncoder::ArgType::BOOL:
+      out << static_cast<bool>(Extract<uint8_t>(record, offset));
+      break;
+    case RecordEncoder::ArgType::CHAR:
+      out << Extract<char>(record, offset);
+      break;
+    case RecordEncoder::ArgType::SIGNED:
+      out << Extract<int64_t>(record, offset);
+      break;
+    case RecordEncoder::ArgType::UNSIGNED:
+      out << Extract<uint64_t>(record, offset);
+      break;
+    case RecordEncoder::ArgType::FLOAT:
+      out << Extract<double>(record, offset);
+      break;
+    case RecordEncoder::ArgType::STRING:
+    {
+      auto const length = Extract<RecordLength>(record, offset);
+      out.write(record.data() + offset, static_cast<std::streamsize>(length));
+      offset += length;
+      break;
+    }
+    default:
+      // unknown argument, the remainder of the record can not be decoded
+      offset = record.size();
+      break;
+    }
+  }
+
+  out << DefaultAttributes() << '\n';
+}
+
+AsyncLogger::RingList AsyncLogger::SnapshotRings() const
+{
+  std::lock_guard<std::mutex> lock(registry_lock_);
+  return rings_;
+}
+
+}  // namespace log
+}  // namespace fetch
@@ -0,0 +1,284 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/lock_profiler.hpp"
+#include "core/logger.hpp"
+#include "core/macros.hpp"
+
+#include <algorithm>
+#include <iomanip>
+#include <ostream>
+#include <signal.h>
+
+namespace fetch {
+namespace mutex {
+namespace {
+
+using std::chrono::duration_cast;
+using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
+
+constexpr char const *LOGGING_NAME      = "LockProfiler";
+constexpr auto        DEFAULT_TIMEOUT   = milliseconds{3000};
+constexpr auto        WATCHDOG_INTERVAL = milliseconds{100};
+
+uint64_t ToNanoseconds(MonitoredLock::Timepoint const &timepoint)
+{
+  auto const value = duration_cast<nanoseconds>(timepoint.time_since_epoch()).count();
+
+  // zero is reserved to signal that the lock is not held
+  return std::max<uint64_t>(static_cast<uint64_t>(value), 1);
+}
+
+void UpdateMaximum(std::atomic<uint64_t> &maximum, uint64_t value)
+{
+  uint64_t current = maximum.load(std::memory_order_relaxed);
+  while ((value > current) &&
+         !maximum.compare_exchange_weak(current, value, std::memory_order_relaxed))
+  {
+  }
+}
+
+double ToMilliseconds(uint64_t value)
+{
+  return static_cast<double>(value) / 1e6;
+}
+
+}  // namespace
+
+/**
+ * Register a mutex instance with the profiler
+ *
+ * @param mutex The mutex being monitored
+ * @param file The file in which the mutex was constructed
+ * @param line The line at which the mutex was constructed
+ */
+MonitoredLock::MonitoredLock(AbstractMutex &mutex, std::string const &file, int line)
+  : mutex_{mutex}
+  , site_{LockProfiler::Instance().LookupSite(file, line)}
+{
+  LockProfiler::Instance().Attach(*this);
+}
+
+MonitoredLock::~MonitoredLock()
+{
+  LockProfiler::Instance().Detach(*this);
+}
+
+/**
+ * Record that the mutex has been acquired
+ *
+ * @param started The time at which the caller started to acquire the mutex
+ * @param acquired The time at which the mutex was acquired
+ * @param contended Flag to signal if the caller had to wait for another holder
+ */
+void MonitoredLock::Acquired(Timepoint const &started, Timepoint const &acquired, bool contended)
+{
+  held_since_ns_.store(ToNanoseconds(acquired), std::memory_order_relaxed);
+
+  site_.acquisitions.fetch_add(1, std::memory_order_relaxed);
+
+  if (contended)
+  {
+    auto const waited =
+        static_cast<uint64_t>(duration_cast<nanoseconds>(acquired - started).count());
+
+    site_.contentions.fetch_add(1, std::memory_order_relaxed);
+    site_.wait_ns.fetch_add(waited, std::memory_order_relaxed);
+    UpdateMaximum(site_.max_wait_ns, waited);
+  }
+}
+
+/**
+ * Record that the mutex is about to be released
+ *
+ * @param released The time at which the mutex is released
+ */
+void MonitoredLock::Released(Timepoint const &released)
+{
+  uint64_t const held_since = held_since_ns_.exchange(0, std::memory_order_relaxed);
+  if (held_since == 0)
+  {
+    return;
+  }
+
+  uint64_t const now  = ToNanoseconds(released);
+  uint64_t const held = (now > held_since) ? (now - held_since) : 0;
+
+  site_.hold_ns.fetch_add(held, std::memory_order_relaxed);
+  UpdateMaximum(site_.max_hold_ns, held);
+}
+
+LockProfiler &LockProfiler::Instance()
+{
+  // intentionally never destroyed since mutexes with static storage duration might be
+  // destructed after this instance
+  static LockProfiler *instance = new LockProfiler;
+  return *instance;
+}
+
+LockProfiler::LockProfiler()
+  : timeout_ns_{static_cast<uint64_t>(duration_cast<nanoseconds>(DEFAULT_TIMEOUT).count())}
+{}
+
+/**
+ * Set the maximum time a lock can be held before the system is terminated
+ *
+ * @param timeout The timeout duration
+ */
+void LockProfiler::SetTimeout(Duration const &timeout)
+{
+  timeout_ns_ = static_cast<uint64_t>(duration_cast<nanoseconds>(timeout).count());
+}
+
+/**
+ * Get the details of all the locks which are currently held
+ *
+ * @return The list of held locks
+ */
+LockProfiler::HeldLocks LockProfiler::GetHeldLocks() const
+{
+  HeldLocks locks;
+
+  std::lock_guard<std::mutex> guard(monitored_lock_);
+  for (auto const *lock : monitored_)
+  {
+    if (lock->held_since_ns_.load(std::memory_order_relaxed) != 0)
+    {
+      locks.push_back({lock->mutex_.AsString(), lock->mutex_.thread_id()});
+    }
+  }
+
+  return locks;
+}
+
+/**
+ * Write a summary of the most contended lock sites (ordered by total wait time) to the stream
+ *
+ * @param stream The output stream
+ * @param max The maximum number of sites to report
+ */
+void LockProfiler::Report(std::ostream &stream, std::size_t max) const
+{
+  std::vector<LockSite const *> sites;
+
+  {
+    std::lock_guard<std::mutex> guard(sites_lock_);
+    for (auto const &element : sites_)
+    {
+      sites.push_back(element.second.get());
+    }
+  }
+
+  std::sort(sites.begin(), sites.end(), [](LockSite const *a, LockSite const *b) {
+    return a->wait_ns.load() > b->wait_ns.load();
+  });
+  sites.resize(std::min(max, sites.size()));
+
+  stream << "Lock contention profile (" << sites.size() << " sites):\n";
+  stream << std::setw(12) << "acquired" << std::setw(12) << "contended" << std::setw(14)
+         << "wait ms" << std::setw(14) << "max wait ms" << std::setw(14) << "hold ms"
+         << std::setw(14) << "max hold ms"
+         << "  site\n";
+
+  for (auto const *site : sites)
+  {
+    stream << std::setw(12) << site->acquisitions.load() << std::setw(12)
+           << site->contentions.load() << std::setw(14) << ToMilliseconds(site->wait_ns.load())
+           << std::setw(14) << ToMilliseconds(site->max_wait_ns.load()) << std::setw(14)
+           << ToMilliseconds(site->hold_ns.load()) << std::setw(14)
+           << ToMilliseconds(site->max_hold_ns.load()) << "  " << site->file << ':' << site->line
+           << '\n';
+  }
+}
+
+LockSite &LockProfiler::LookupSite(std::string const &file, int line)
+{
+  std::lock_guard<std::mutex> guard(sites_lock_);
+
+  auto &site = sites_[std::make_pair(file, line)];
+  if (!site)
+  {
+    site = std::make_unique<LockSite>(file, line);
+  }
+
+  return *site;
+}
+
+void LockProfiler::Attach(MonitoredLock &lock)
+{
+  // the watchdog is only started once the first lock is monitored
+  std::call_once(watchdog_started_,
+                 [this]() { std::thread(&LockProfiler::Watchdog, this).detach(); });
+
+  std::lock_guard<std::mutex> guard(monitored_lock_);
+  monitored_.insert(&lock);
+}
+
+void LockProfiler::Detach(MonitoredLock &lock)
+{
+  std::lock_guard<std::mutex> guard(monitored_lock_);
+  monitored_.erase(&lock);
+}
+
+/**
+ * Single watchdog thread which periodically checks all the monitored locks, terminating the system
+ * when one has been held for longer than the timeout (a likely deadlock)
+ */
+void LockProfiler::Watchdog()
+{
+  for (;;)
+  {
+    std::this_thread::sleep_for(WATCHDOG_INTERVAL);
+
+    uint64_t const now     = ToNanoseconds(Clock::now());
+    uint64_t const timeout = timeout_ns_;
+
+    std::vector<std::string> expired;
+
+    {
+      std::lock_guard<std::mutex> guard(monitored_lock_);
+      for (auto *lock : monitored_)
+      {
+        uint64_t const held_since = lock->held_since_ns_.load(std::memory_order_relaxed);
+        if ((held_since != 0) && (held_since != lock->reported_ns_) &&
+            ((now - std::min(now, held_since)) >= timeout))
+        {
+          lock->reported_ns_ = held_since;
+          expired.push_back(lock->site_.file + " " + std::to_string(lock->site_.line));
+        }
+      }
+    }
+
+    // the logger must not be called with the monitored lock held since it queries the held locks
+    for (auto const &site : expired)
+    {
+      FETCH_UNUSED(site);  // when logging is compiled out
+      FETCH_LOG_ERROR(LOGGING_NAME, "The system will terminate, mutex timed out: ", site);
+    }
+
+    if (!expired.empty())
+    {
+      // Send a sigint to ourselves since we have a handler for this
+      kill(0, SIGINT);
+    }
+  }
+}
+
+}  // namespace mutex
+}  // namespace fetch
@@ -21,10 +21,13 @@
 #include "core/runnable.hpp"
 #include "core/threading.hpp"
 
+#include <algorithm>
 #include <chrono>
 #include <deque>
 
-static const std::chrono::milliseconds POLL_INTERVAL{15};
+// Upper bound on the idle wait, only relevant for runnables which neither report a deadline nor
+// notify the reactor when they become ready
+static const std::chrono::milliseconds MAX_WAIT_INTERVAL{100};
 
 using WorkQueue = std::deque<fetch::core::WeakRunnable>;
 
@@ -52,6 +55,14 @@ bool Reactor::Attach(WeakRunnable runnable)
     success = result.second;
   }
 
+  if (success)
+  {
+    concrete_runnable->SetWakeup(wakeup_);
+
+    // ensure the new runnable is evaluated promptly
+    wakeup_->Signal();
+  }
+
   return success;
 }
 
@@ -96,6 +107,7 @@ void Reactor::StartWorker()
 void Reactor::StopWorker()
 {
   running_ = false;
+  wakeup_->Signal();
 
   if (worker_)
   {
@@ -113,6 +125,8 @@ void Reactor::Monitor()
 
   while (running_)
   {
+    Runnable::Timepoint next_deadline = Runnable::Timepoint::max();
+
     // Step 1. If we have run out of work to execute then gather all the runnables that are ready
     if (work_queue.empty())
     {
@@ -132,6 +146,11 @@ void Reactor::Monitor()
           {
             work_queue.emplace_back(it->second);
           }
+          else
+          {
+            // otherwise track the earliest point at which one of the runnables becomes ready
+            next_deadline = std::min(next_deadline, concrete_runnable->GetNextExecutionTime());
+          }
 
           // advance to the next element in the map
           ++it;
@@ -144,10 +163,11 @@ void Reactor::Monitor()
       }
     }
 
-    // If the work queue is still empty then there is no work to do. Sleep the worker and try again
+    // If the work queue is still empty then there is no work to do. Sleep the worker until the
+    // next deadline or until one of the runnables is notified
     if (work_queue.empty())
     {
-      std::this_thread::sleep_for(POLL_INTERVAL);
+      wakeup_->WaitUntil(std::min(next_deadline, Runnable::Clock::now() + MAX_WAIT_INTERVAL));
       continue;
     }
 
@@ -0,0 +1,237 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/containers/mpmc_ring_queue.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::core::MPMCRingQueue;
+
+class MPMCRingQueueTests : public ::testing::Test
+{
+protected:
+  static constexpr std::size_t QUEUE_SIZE = 1024;
+
+  using Queue      = MPMCRingQueue<uint64_t, QUEUE_SIZE>;
+  using ThreadPtr  = std::unique_ptr<std::thread>;
+  using ThreadList = std::vector<ThreadPtr>;
+  using Counters   = std::vector<std::size_t>;
+
+  /**
+   * Run a set of producers and consumers over the queue and check that every element is
+   * received exactly once.
+   *
+   * @param num_producers The number of producer threads
+   * @param num_consumers The number of consumer threads
+   * @param batch_size The size of the batches to push and pop (1 uses the single element calls)
+   */
+  void ProducerConsumerTest(std::size_t num_producers, std::size_t num_consumers,
+                            std::size_t batch_size)
+  {
+    static constexpr std::size_t NUM_ELEMENTS_PER_PRODUCER = QUEUE_SIZE * 50;
+
+    std::size_t const total = NUM_ELEMENTS_PER_PRODUCER * num_producers;
+
+    Queue      queue;
+    Counters   counters(total, 0);
+    std::mutex counters_lock;
+
+    ThreadList producers(num_producers);
+    for (std::size_t p = 0; p < num_producers; ++p)
+    {
+      producers[p] = std::make_unique<std::thread>([&queue, p, batch_size]() {
+        std::size_t const offset = p * NUM_ELEMENTS_PER_PRODUCER;
+
+        std::vector<uint64_t> batch;
+        for (std::size_t i = 0; i < NUM_ELEMENTS_PER_PRODUCER; ++i)
+        {
+          if (batch_size == 1)
+          {
+            queue.Push(uint64_t{offset + i});
+            continue;
+          }
+
+          batch.push_back(offset + i);
+          if (batch.size() == batch_size)
+          {
+            queue.Push(batch.begin(), batch.end());
+            batch.clear();
+          }
+        }
+
+        queue.Push(batch.begin(), batch.end());
+      });
+    }
+
+    std::atomic<std::size_t> remaining{total};
+
+    ThreadList consumers(num_consumers);
+    for (auto &consumer : consumers)
+    {
+      consumer = std::make_unique<std::thread>(
+          [&queue, &counters, &counters_lock, &remaining, batch_size]() {
+            std::vector<uint64_t> values;
+            while (remaining > 0)
+            {
+              values.clear();
+
+              if (batch_size == 1)
+              {
+                uint64_t value{0};
+                if (queue.Pop(value, std::chrono::milliseconds{10}))
+                {
+                  values.push_back(value);
+                }
+              }
+              else
+              {
+                queue.Pop(values, batch_size, std::chrono::milliseconds{10});
+              }
+
+              if (!values.empty())
+              {
+                std::lock_guard<std::mutex> lock(counters_lock);
+                for (auto const value : values)
+                {
+                  ++counters.at(value);
+                }
+              }
+
+              remaining -= values.size();
+            }
+          });
+    }
+
+    for (auto &thread : producers)
+    {
+      thread->join();
+    }
+
+    for (auto &thread : consumers)
+    {
+      thread->join();
+    }
+
+    EXPECT_TRUE(queue.empty());
+    EXPECT_TRUE(std::all_of(counters.begin(), counters.end(),
+                            [](std::size_t count) { return count == 1; }));
+  }
+};
+
+TEST_F(MPMCRingQueueTests, ProducerConsumer_1p_1c)
+{
+  ProducerConsumerTest(1, 1, 1);
+}
+
+TEST_F(MPMCRingQueueTests, ProducerConsumer_8p_8c)
+{
+  ProducerConsumerTest(8, 8, 1);
+}
+
+TEST_F(MPMCRingQueueTests, ProducerConsumer_8p_1c)
+{
+  ProducerConsumerTest(8, 1, 1);
+}
+
+TEST_F(MPMCRingQueueTests, ProducerConsumer_1p_8c)
+{
+  ProducerConsumerTest(1, 8, 1);
+}
+
+TEST_F(MPMCRingQueueTests, BatchProducerConsumer_8p_8c)
+{
+  ProducerConsumerTest(8, 8, 64);
+}
+
+TEST_F(MPMCRingQueueTests, BatchProducerConsumer_4p_2c_LargeBatches)
+{
+  // batches larger than the queue need to be pushed in several parts
+  ProducerConsumerTest(4, 2, QUEUE_SIZE * 3);
+}
+
+TEST_F(MPMCRingQueueTests, CheckFullAndEmpty)
+{
+  MPMCRingQueue<uint64_t, 4> queue;
+
+  uint64_t value{0};
+  EXPECT_FALSE(queue.TryPop(value));
+  EXPECT_FALSE(queue.Pop(value, std::chrono::milliseconds{10}));
+
+  for (uint64_t i = 0; i < 4; ++i)
+  {
+    EXPECT_TRUE(queue.TryPush(uint64_t{i}));
+  }
+
+  EXPECT_EQ(queue.size(), 4);
+  EXPECT_FALSE(queue.TryPush(uint64_t{4}));
+
+  std::size_t count{0};
+  EXPECT_FALSE(queue.Push(uint64_t{4}, count, std::chrono::milliseconds{10}));
+
+  // elements are returned in order
+  std::vector<uint64_t> values;
+  EXPECT_EQ(queue.TryPop(values, 3), 3);
+  EXPECT_EQ(values, (std::vector<uint64_t>{0, 1, 2}));
+
+  EXPECT_TRUE(queue.Push(uint64_t{4}, count, std::chrono::milliseconds{10}));
+  EXPECT_EQ(count, 2);
+
+  EXPECT_EQ(queue.Pop(), 3);
+  EXPECT_EQ(queue.Pop(), 4);
+  EXPECT_TRUE(queue.empty());
+}
+
+TEST_F(MPMCRingQueueTests, CheckElementsAreReleased)
+{
+  MPMCRingQueue<std::shared_ptr<int>, 8> queue;
+
+  auto element = std::make_shared<int>(42);
+  queue.Push(element);
+  EXPECT_EQ(element.use_count(), 2);
+
+  std::shared_ptr<int> value;
+  ASSERT_TRUE(queue.TryPop(value));
+  value.reset();
+
+  // the queue must not hold on to a reference once the element has been popped
+  EXPECT_EQ(element.use_count(), 1);
+}
+
+TEST_F(MPMCRingQueueTests, CheckParkedConsumerIsWoken)
+{
+  MPMCRingQueue<uint64_t, 8> queue{0};
+
+  std::thread consumer([&queue]() { EXPECT_EQ(queue.Pop(), 7); });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{50});
+  queue.Push(uint64_t{7});
+
+  consumer.join();
+}
+
+}  // namespace
@@ -0,0 +1,213 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/async_logger.hpp"
+#include "core/logger.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <cstddef>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::log::AsyncLogger;
+using fetch::log::LogLevel;
+using fetch::log::details::LogWrapper;
+
+using OverflowPolicy = AsyncLogger::OverflowPolicy;
+
+std::size_t CountOccurrences(std::string const &text, std::string const &pattern)
+{
+  std::size_t count  = 0;
+  std::size_t offset = text.find(pattern);
+  while (offset != std::string::npos)
+  {
+    ++count;
+    offset = text.find(pattern, offset + pattern.size());
+  }
+  return count;
+}
+
+TEST(AsyncLoggerTests, CheckRecordsAreFormatted)
+{
+  std::ostringstream output;
+
+  AsyncLogger logger{OverflowPolicy::BLOCK, 1024, output};
+  logger.Start();
+
+  EXPECT_TRUE(logger.Log(LogLevel::INFO, "Tester", "Value: ", 42, " ", -7, " ", 1.5, " ", true, ' ',
+                         'x', " ", std::string{"text"}, " ", 18446744073709551615ull));
+  EXPECT_TRUE(logger.Log(LogLevel::WARNING, "Tester", "Second"));
+  logger.Flush();
+
+  auto const text = output.str();
+  EXPECT_NE(text.find("Value: 42 -7 1.5 1 x text 18446744073709551615"), std::string::npos);
+  EXPECT_NE(text.find("INFO  "), std::string::npos);
+  EXPECT_NE(text.find("WARN  "), std::string::npos);
+  EXPECT_NE(text.find("Tester ]"), std::string::npos);
+
+  // records are emitted in the order they were logged
+  EXPECT_LT(text.find("Value: "), text.find("Second"));
+
+  auto const stats = logger.GetStatistics();
+  EXPECT_EQ(stats.submitted, 2u);
+  EXPECT_EQ(stats.written, 2u);
+  EXPECT_EQ(stats.dropped, 0u);
+}
+
+TEST(AsyncLoggerTests, CheckBlockingPolicyRetainsAllRecords)
+{
+  static constexpr std::size_t NUM_THREADS = 4;
+  static constexpr std::size_t NUM_RECORDS = 2000;
+
+  std::ostringstream output;
+
+  AsyncLogger logger{OverflowPolicy::BLOCK, 512, output};
+  logger.Start();
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([&logger, i]() {
+      for (std::size_t j = 0; j < NUM_RECORDS; ++j)
+      {
+        logger.Log(LogLevel::DEBUG, "Worker", "thread ", i, " record ", j);
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  logger.Stop();
+
+  auto const stats = logger.GetStatistics();
+  EXPECT_EQ(stats.submitted, NUM_THREADS * NUM_RECORDS);
+  EXPECT_EQ(stats.written, NUM_THREADS * NUM_RECORDS);
+  EXPECT_EQ(stats.dropped, 0u);
+  EXPECT_EQ(CountOccurrences(output.str(), "\n"), NUM_THREADS * NUM_RECORDS);
+}
+
+TEST(AsyncLoggerTests, CheckFullRingDropsRecords)
+{
+  static constexpr std::size_t NUM_RECORDS = 100;
+
+  std::ostringstream output;
+
+  // the writer is not started so the ring is guaranteed to fill up
+  AsyncLogger logger{OverflowPolicy::DROP, 256, output};
+  for (std::size_t i = 0; i < NUM_RECORDS; ++i)
+  {
+    EXPECT_TRUE(logger.Log(LogLevel::INFO, "Tester", "record ", i));
+  }
+
+  auto stats = logger.GetStatistics();
+  EXPECT_GT(stats.submitted, 0u);
+  EXPECT_GT(stats.dropped, 0u);
+  EXPECT_EQ(stats.submitted + stats.dropped, NUM_RECORDS);
+  EXPECT_EQ(stats.written, 0u);
+
+  logger.Flush();
+
+  stats = logger.GetStatistics();
+  EXPECT_EQ(stats.written, stats.submitted);
+
+  auto const text = output.str();
+  EXPECT_NE(text.find("record 0"), std::string::npos);
+  EXPECT_NE(text.find("Dropped " + std::to_string(stats.dropped) + " log records"),
+            std::string::npos);
+}
+
+TEST(AsyncLoggerTests, CheckOversizedRecordsAreRejected)
+{
+  std::ostringstream output;
+
+  AsyncLogger logger{OverflowPolicy::DROP, 256, output};
+  logger.Start();
+
+  EXPECT_FALSE(logger.Log(LogLevel::INFO, "Tester", std::string(1024, 'a')));
+
+  logger.Stop();
+
+  auto const stats = logger.GetStatistics();
+  EXPECT_EQ(stats.submitted, 0u);
+  EXPECT_EQ(stats.dropped, 0u);
+  EXPECT_TRUE(output.str().empty());
+}
+
+TEST(AsyncLoggerTests, CheckRecordsAfterStopAreRejected)
+{
+  std::ostringstream output;
+
+  AsyncLogger logger{OverflowPolicy::DROP, 256, output};
+  logger.Start();
+  logger.Stop();
+
+  // the writer has gone so the caller must log the record itself
+  EXPECT_FALSE(logger.Log(LogLevel::INFO, "Tester", "late record"));
+
+  auto const stats = logger.GetStatistics();
+  EXPECT_EQ(stats.submitted, 0u);
+  EXPECT_EQ(stats.dropped, 0u);
+  EXPECT_TRUE(output.str().empty());
+}
+
+TEST(AsyncLoggerTests, CheckReenablingWhileLogging)
+{
+  static constexpr std::size_t NUM_THREADS = 2;
+  static constexpr std::size_t NUM_TOGGLES = 20;
+
+  LogWrapper wrapper;
+  wrapper.EnableAsync();
+
+  std::atomic<bool>        running{true};
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([&wrapper, &running, i]() {
+      for (std::size_t j = 0; running; ++j)
+      {
+        wrapper.InfoWithName("Worker", "thread ", i, " record ", j);
+      }
+    });
+  }
+
+  // each cycle retires an instance which the workers might still be using
+  for (std::size_t i = 0; i < NUM_TOGGLES; ++i)
+  {
+    wrapper.DisableAsync();
+    wrapper.EnableAsync();
+  }
+
+  running = false;
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  wrapper.DisableAsync();
+}
+
+}  // namespace
@@ -0,0 +1,149 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/reactor.hpp"
+#include "core/state_machine.hpp"
+
+#include <gtest/gtest.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using fetch::core::Reactor;
+using fetch::core::StateMachine;
+
+using Clock = std::chrono::steady_clock;
+
+enum class State
+{
+  WAITING,
+};
+
+/**
+ * A service which waits (for a long time) between each execution unless it is notified
+ */
+class SleepyService
+{
+public:
+  using StateMachinePtr = std::shared_ptr<StateMachine<State>>;
+
+  SleepyService()
+  {
+    state_machine_->RegisterHandler(State::WAITING, this, &SleepyService::OnWaiting);
+  }
+
+  State OnWaiting()
+  {
+    // set the delay before counting the execution, so that once an execution has been observed
+    // the service is already waiting out its delay
+    state_machine_->Delay(delay);
+    ++executions;
+    return State::WAITING;
+  }
+
+  bool WaitForExecutions(std::size_t count, std::chrono::milliseconds timeout) const
+  {
+    auto const deadline = Clock::now() + timeout;
+    while (executions < count)
+    {
+      if (Clock::now() >= deadline)
+      {
+        return false;
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+  }
+
+  StateMachinePtr const &state_machine() const
+  {
+    return state_machine_;
+  }
+
+  std::atomic<std::size_t>  executions{0};
+  std::chrono::milliseconds delay{10000};
+
+private:
+  StateMachinePtr state_machine_{std::make_shared<StateMachine<State>>("Sleepy", State::WAITING)};
+};
+
+TEST(ReactorTests, CheckNotifyCutsDelayShort)
+{
+  SleepyService service;
+
+  Reactor reactor{"Reactor"};
+  reactor.Attach(service.state_machine());
+  reactor.Start();
+
+  // the first execution happens straight away, then the service is delayed
+  ASSERT_TRUE(service.WaitForExecutions(1, std::chrono::milliseconds{1000}));
+
+  for (std::size_t i = 2; i <= 5; ++i)
+  {
+    service.state_machine()->Notify();
+    EXPECT_TRUE(service.WaitForExecutions(i, std::chrono::milliseconds{1000}));
+  }
+
+  reactor.Stop();
+}
+
+TEST(ReactorTests, CheckDelayDeadlineIsHonoured)
+{
+  SleepyService service;
+  service.delay = std::chrono::milliseconds{50};
+
+  Reactor reactor{"Reactor"};
+  reactor.Attach(service.state_machine());
+
+  auto const start = Clock::now();
+  reactor.Start();
+
+  ASSERT_TRUE(service.WaitForExecutions(3, std::chrono::milliseconds{2000}));
+  auto const elapsed = Clock::now() - start;
+
+  // two full delays must have passed between the three executions
+  EXPECT_GE(elapsed, std::chrono::milliseconds{100});
+
+  reactor.Stop();
+}
+
+TEST(ReactorTests, CheckStopWakesIdleReactor)
+{
+  SleepyService service;
+
+  Reactor reactor{"Reactor"};
+  reactor.Attach(service.state_machine());
+  reactor.Start();
+
+  ASSERT_TRUE(service.WaitForExecutions(1, std::chrono::milliseconds{1000}));
+
+  auto const start = Clock::now();
+  reactor.Stop();
+
+  EXPECT_LT(Clock::now() - start, std::chrono::milliseconds{1000});
+  EXPECT_EQ(service.executions, 1u);
+}
+
+}  // namespace
@@ -0,0 +1,124 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/lock_profiler.hpp"
+#include "core/mutex.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <string>
+#include <thread>
+
+namespace {
+
+using fetch::mutex::DebugMutex;
+using fetch::mutex::LockProfiler;
+
+struct SiteRow
+{
+  uint64_t acquisitions{0};
+  uint64_t contentions{0};
+  double   wait_ms{0};
+  double   max_wait_ms{0};
+  double   hold_ms{0};
+  double   max_hold_ms{0};
+  bool     found{false};
+};
+
+/**
+ * Extract the profile of a given site from the profiler report
+ */
+SiteRow LookupSite(std::string const &site)
+{
+  std::ostringstream report;
+  LockProfiler::Instance().Report(report, std::size_t(-1));
+
+  SiteRow row{};
+
+  std::istringstream lines{report.str()};
+  std::string        line;
+  while (std::getline(lines, line))
+  {
+    bool const matches = (line.size() > site.size()) &&
+                         (line.compare(line.size() - site.size(), site.size(), site) == 0);
+    if (matches)
+    {
+      std::istringstream fields{line};
+      fields >> row.acquisitions >> row.contentions >> row.wait_ms >> row.max_wait_ms >>
+          row.hold_ms >> row.max_hold_ms;
+      row.found = true;
+    }
+  }
+
+  return row;
+}
+
+TEST(LockProfilerTests, CheckWaitAndHoldTimesAreRecorded)
+{
+  int const  line = __LINE__;
+  DebugMutex mutex{line, "lock_profiler_tests.cpp"};
+
+  std::string const site = "lock_profiler_tests.cpp:" + std::to_string(line);
+
+  mutex.lock();
+
+  // the second thread must wait for the lock to be released
+  std::thread waiter([&mutex]() {
+    mutex.lock();
+    mutex.unlock();
+  });
+
+  std::this_thread::sleep_for(std::chrono::milliseconds{50});
+  mutex.unlock();
+  waiter.join();
+
+  auto const row = LookupSite(site);
+  ASSERT_TRUE(row.found);
+  EXPECT_EQ(row.acquisitions, 2u);
+  EXPECT_EQ(row.contentions, 1u);
+  EXPECT_GE(row.wait_ms, 40.0);
+  EXPECT_GE(row.max_hold_ms, 40.0);
+  EXPECT_GE(row.hold_ms, row.max_hold_ms);
+}
+
+TEST(LockProfilerTests, CheckHeldLocksAreReported)
+{
+  DebugMutex mutex{__LINE__, "held_lock_tests.cpp"};
+
+  auto const is_held = []() {
+    auto const locks = LockProfiler::Instance().GetHeldLocks();
+    return std::any_of(locks.begin(), locks.end(), [](LockProfiler::HeldLock const &lock) {
+      return lock.description.find("held_lock_tests.cpp") != std::string::npos;
+    });
+  };
+
+  EXPECT_FALSE(is_held());
+
+  {
+    FETCH_LOCK(mutex);
+    EXPECT_TRUE(is_held());
+  }
+
+  EXPECT_FALSE(is_held());
+}
+
+}  // namespace
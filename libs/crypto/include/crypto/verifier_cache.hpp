@@ -0,0 +1,126 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "crypto/identity.hpp"
+#include "crypto/verifier.hpp"
+#include "metrics/counter.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Bounded, thread safe, least recently used cache of decoded public keys (verifiers)
+ *
+ * Building a verifier from the raw identity bytes requires the public key to be decoded into an
+ * EC point and an EC key allocated. Since the majority of the signature traffic is generated from
+ * a relatively small set of signers, caching the decoded verifiers removes this cost from the
+ * verification of every signature.
+ */
+class VerifierCache
+{
+public:
+  static constexpr char const *LOGGING_NAME     = "VerifierCache";
+  static constexpr std::size_t DEFAULT_CAPACITY = 4096;
+
+  using ConstByteArray = byte_array::ConstByteArray;
+  using VerifierPtr    = std::shared_ptr<Verifier>;
+
+  // Singleton instance
+  static VerifierCache &Default();
+
+  // Construction / Destruction
+  explicit VerifierCache(std::size_t capacity = DEFAULT_CAPACITY);
+  VerifierCache(VerifierCache const &) = delete;
+  VerifierCache(VerifierCache &&)      = delete;
+  ~VerifierCache()                     = default;
+
+  /// @name Lookup
+  /// @{
+  VerifierPtr Lookup(Identity const &identity);
+  bool        Verify(Identity const &identity, ConstByteArray const &data,
+                     ConstByteArray const &signature);
+  /// @}
+
+  /// @name Statistics
+  /// @{
+  std::size_t size() const;
+  std::size_t capacity() const;
+  uint64_t    hits() const;
+  uint64_t    misses() const;
+  /// @}
+
+  // Operators
+  VerifierCache &operator=(VerifierCache const &) = delete;
+  VerifierCache &operator=(VerifierCache &&) = delete;
+
+private:
+  using Mutex      = mutex::Mutex;
+  using Entry      = std::pair<Identity, VerifierPtr>;
+  using EntryList  = std::list<Entry>;
+  using EntryIndex = std::unordered_map<Identity, EntryList::iterator>;
+  using Counter    = metrics::Counter;
+
+  std::size_t const capacity_;
+  mutable Mutex     lock_{__LINE__, __FILE__};
+  EntryList         entries_{};  ///< Entries in most recently used order (front is the newest)
+  EntryIndex        index_{};    ///< Map of identity to entry in the list
+  Counter           hits_{"verifier_cache_hits_total", "Lookups served from the cache"};
+  Counter           misses_{"verifier_cache_misses_total", "Lookups which built a verifier"};
+};
+
+/**
+ * Get the maximum number of entries in the cache
+ *
+ * @return The capacity of the cache
+ */
+inline std::size_t VerifierCache::capacity() const
+{
+  return capacity_;
+}
+
+/**
+ * Get the total number of lookups that were served from the cache
+ *
+ * @return The number of hits
+ */
+inline uint64_t VerifierCache::hits() const
+{
+  return hits_.value();
+}
+
+/**
+ * Get the total number of lookups that required a public key to be decoded
+ *
+ * @return The number of misses
+ */
+inline uint64_t VerifierCache::misses() const
+{
+  return misses_.value();
+}
+
+}  // namespace crypto
+}  // namespace fetch
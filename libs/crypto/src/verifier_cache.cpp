@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/verifier_cache.hpp"
+
+#include <algorithm>
+
+namespace fetch {
+namespace crypto {
+
+/**
+ * Get the process wide verifier cache
+ *
+ * @return The reference to the shared cache
+ */
+VerifierCache &VerifierCache::Default()
+{
+  static VerifierCache instance;
+  return instance;
+}
+
+/**
+ * Construct a cache with a specified maximum number of entries
+ *
+ * @param capacity The maximum number of entries
+ */
+VerifierCache::VerifierCache(std::size_t capacity)
+  : capacity_{std::max<std::size_t>(capacity, 1)}
+{
+  index_.reserve(capacity_);
+}
+
+/**
+ * Lookup (or build) the verifier for the specified identity
+ *
+ * @param identity The identity of the signer
+ * @return The verifier for the identity
+ */
+VerifierCache::VerifierPtr VerifierCache::Lookup(Identity const &identity)
+{
+  {
+    FETCH_LOCK(lock_);
+
+    auto it = index_.find(identity);
+    if (it != index_.end())
+    {
+      // promote the entry to the most recently used position
+      entries_.splice(entries_.begin(), entries_, it->second);
+
+      hits_.Increment();
+
+      return it->second->second;
+    }
+  }
+
+  misses_.Increment();
+
+  // decode the public key outside of the lock since this is the expensive operation
+  VerifierPtr verifier{Verifier::Build(identity)};
+
+  FETCH_LOCK(lock_);
+
+  // another thread might have populated the entry in the meantime
+  auto it = index_.find(identity);
+  if (it != index_.end())
+  {
+    entries_.splice(entries_.begin(), entries_, it->second);
+    return it->second->second;
+  }
+
+  // evict the least recently used entry when the cache is full
+  if (entries_.size() >= capacity_)
+  {
+    index_.erase(entries_.back().first);
+    entries_.pop_back();
+  }
+
+  // take a deep copy of the identity so that the cache does not hold on to the (potentially much
+  // larger) buffer from which it was deserialised
+  Identity key{identity};
+  key.Clone();
+
+  entries_.emplace_front(key, verifier);
+  index_.emplace(std::move(key), entries_.begin());
+
+  return verifier;
+}
+
+/**
+ * Verify a specified signature from a data buffer and identity using a cached verifier
+ *
+ * @param identity The identity of the signer
+ * @param data The payload of the message
+ * @param signature The signature to verify
+ * @return true if the signature is valid for the payload, otherwise false
+ */
+bool VerifierCache::Verify(Identity const &identity, ConstByteArray const &data,
+                           ConstByteArray const &signature)
+{
+  return Lookup(identity)->Verify(data, signature);
+}
+
+/**
+ * Get the current number of entries in the cache
+ *
+ * @return The number of entries
+ */
+std::size_t VerifierCache::size() const
+{
+  FETCH_LOCK(lock_);
+  return entries_.size();
+}
+
+}  // namespace crypto
+}  // namespace fetch
@@ -0,0 +1,115 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/ecdsa.hpp"
+#include "crypto/verifier_cache.hpp"
+
+#include "gmock/gmock.h"
+
+#include <vector>
+
+namespace fetch {
+namespace crypto {
+namespace {
+
+using ConstByteArray = byte_array::ConstByteArray;
+
+constexpr std::size_t CACHE_CAPACITY = 4;
+
+ConstByteArray const TEST_DATA{"The quick brown fox jumps over the lazy dog"};
+
+class VerifierCacheTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    cache_ = std::make_unique<VerifierCache>(CACHE_CAPACITY);
+  }
+
+  void TearDown() override
+  {
+    cache_.reset();
+  }
+
+  std::unique_ptr<VerifierCache> cache_;
+};
+
+TEST_F(VerifierCacheTests, CheckRepeatedLookupIsServedFromCache)
+{
+  ECDSASigner signer{};
+  signer.GenerateKeys();
+
+  auto const signature = signer.Sign(TEST_DATA);
+
+  EXPECT_TRUE(cache_->Verify(signer.identity(), TEST_DATA, signature));
+  EXPECT_EQ(cache_->misses(), 1u);
+  EXPECT_EQ(cache_->hits(), 0u);
+
+  EXPECT_TRUE(cache_->Verify(signer.identity(), TEST_DATA, signature));
+  EXPECT_EQ(cache_->misses(), 1u);
+  EXPECT_EQ(cache_->hits(), 1u);
+  EXPECT_EQ(cache_->size(), 1u);
+}
+
+TEST_F(VerifierCacheTests, CheckInvalidSignatureIsRejected)
+{
+  ECDSASigner signer{};
+  signer.GenerateKeys();
+
+  ECDSASigner other{};
+  other.GenerateKeys();
+
+  auto const signature = other.Sign(TEST_DATA);
+
+  EXPECT_FALSE(cache_->Verify(signer.identity(), TEST_DATA, signature));
+}
+
+TEST_F(VerifierCacheTests, CheckLeastRecentlyUsedEntryIsEvicted)
+{
+  std::vector<ECDSASigner> signers(CACHE_CAPACITY + 1);
+  for (auto &signer : signers)
+  {
+    signer.GenerateKeys();
+  }
+
+  // populate the cache to capacity
+  for (std::size_t i = 0; i < CACHE_CAPACITY; ++i)
+  {
+    cache_->Lookup(signers[i].identity());
+  }
+  EXPECT_EQ(cache_->size(), CACHE_CAPACITY);
+
+  // refresh the first entry so that the second one becomes the oldest
+  cache_->Lookup(signers[0].identity());
+  EXPECT_EQ(cache_->hits(), 1u);
+
+  // adding a new entry should evict the second signer
+  cache_->Lookup(signers[CACHE_CAPACITY].identity());
+  EXPECT_EQ(cache_->size(), CACHE_CAPACITY);
+
+  cache_->Lookup(signers[0].identity());
+  EXPECT_EQ(cache_->hits(), 2u);
+
+  cache_->Lookup(signers[1].identity());
+  EXPECT_EQ(cache_->hits(), 2u);
+  EXPECT_EQ(cache_->misses(), CACHE_CAPACITY + 2);
+}
+
+}  // namespace
+}  // namespace crypto
+}  // namespace fetch
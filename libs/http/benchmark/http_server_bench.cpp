@@ -0,0 +1,239 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/server.hpp"
+#include "metrics/histogram.hpp"
+#include "network/fetch_asio.hpp"
+#include "network/management/network_manager.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::http::HTTPRequest;
+using fetch::http::HTTPResponse;
+using fetch::http::HTTPServer;
+using fetch::http::Method;
+using fetch::http::ViewParameters;
+using fetch::metrics::Histogram;
+using fetch::network::NetworkManager;
+
+using Clock     = std::chrono::high_resolution_clock;
+using Seconds   = std::chrono::duration<double>;
+using Threads   = std::vector<std::thread>;
+using tcp       = asio::ip::tcp;
+using ServerPtr = std::unique_ptr<HTTPServer>;
+
+constexpr std::size_t REQUESTS_PER_CLIENT = 250;
+constexpr uint16_t    BASE_PORT           = 8650;
+
+/**
+ * Minimal blocking HTTP/1.1 client which reuses a single (keep-alive) connection for all of its
+ * requests
+ */
+class LoadClient
+{
+public:
+  explicit LoadClient(uint16_t port)
+  {
+    // the server starts asynchronously so allow some time for it to start listening
+    for (std::size_t attempt = 0; attempt < 50; ++attempt)
+    {
+      std::error_code ec;
+      socket_.connect(tcp::endpoint(asio::ip::address_v4::loopback(), port), ec);
+      if (!ec)
+      {
+        socket_.set_option(tcp::no_delay(true));
+        return;
+      }
+
+      socket_.close(ec);
+      std::this_thread::sleep_for(std::chrono::milliseconds{20});
+    }
+
+    throw std::runtime_error("Unable to connect to the HTTP server");
+  }
+
+  void Get(std::string const &path)
+  {
+    std::string const request = "GET " + path + " HTTP/1.1\r\nHost: localhost\r\n\r\n";
+    asio::write(socket_, asio::buffer(request));
+
+    // read the header and determine the size of the body
+    std::size_t const header_length = asio::read_until(socket_, buffer_, "\r\n\r\n");
+
+    auto const        begin = asio::buffers_begin(buffer_.data());
+    std::string const header(begin, begin + static_cast<std::ptrdiff_t>(header_length));
+    buffer_.consume(header_length);
+
+    std::size_t       content_length = 0;
+    std::size_t const pos            = header.find("content-length: ");
+    if (pos != std::string::npos)
+    {
+      content_length = std::stoul(header.substr(pos + 16));
+    }
+
+    if (buffer_.size() < content_length)
+    {
+      asio::read(socket_, buffer_, asio::transfer_exactly(content_length - buffer_.size()));
+    }
+
+    buffer_.consume(content_length);
+  }
+
+private:
+  asio::io_service io_service_;
+  tcp::socket      socket_{io_service_};
+  asio::streambuf  buffer_;
+};
+
+ServerPtr CreateServer(NetworkManager &network_manager, uint16_t port)
+{
+  auto server = std::make_unique<HTTPServer>(network_manager);
+
+  server->AddView(Method::GET, "/api/status", [](ViewParameters const &, HTTPRequest const &) {
+    return HTTPResponse("{\"status\": \"ok\"}");
+  });
+
+  // emulates an expensive view e.g. a contract query
+  server->AddView(Method::GET, "/api/contract/query",
+                  [](ViewParameters const &, HTTPRequest const &) {
+                    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+                    return HTTPResponse("{\"result\": 42}");
+                  });
+
+  server->Start(port);
+
+  return server;
+}
+
+/**
+ * Load test of the HTTP server. A number of clients make requests to a fast view over persistent
+ * connections while a number of background clients continuously make requests to a slow view.
+ * The throughput and latency of the fast requests are reported.
+ */
+void HttpServer_KeepAliveLoad(benchmark::State &state)
+{
+  static uint16_t next_port = BASE_PORT;
+
+  auto const fast_clients = static_cast<std::size_t>(state.range(0));
+  auto const slow_clients = static_cast<std::size_t>(state.range(1));
+  auto const port         = next_port++;
+
+  NetworkManager network_manager{"HttpBench", 2};
+  network_manager.Start();
+
+  auto server = CreateServer(network_manager, port);
+
+  Histogram   latency{"http_bench_request_duration", "The latency of the fast requests"};
+  std::size_t total_requests{0};
+  Seconds     total_duration{0};
+
+  for (auto _ : state)
+  {
+    std::atomic<bool> running{true};
+
+    Threads background;
+    for (std::size_t i = 0; i < slow_clients; ++i)
+    {
+      background.emplace_back([port, &running] {
+        LoadClient client{port};
+        while (running)
+        {
+          client.Get("/api/contract/query");
+        }
+      });
+    }
+
+    // establish the connections before the measurement starts
+    std::vector<std::unique_ptr<LoadClient>> clients;
+    for (std::size_t i = 0; i < fast_clients; ++i)
+    {
+      clients.emplace_back(std::make_unique<LoadClient>(port));
+    }
+
+    auto const start = Clock::now();
+
+    Threads foreground;
+    for (auto &client : clients)
+    {
+      foreground.emplace_back([&client, &latency] {
+        for (std::size_t i = 0; i < REQUESTS_PER_CLIENT; ++i)
+        {
+          auto const request_start = Clock::now();
+          client->Get("/api/status");
+          latency.Record(Clock::now() - request_start);
+        }
+      });
+    }
+
+    for (auto &thread : foreground)
+    {
+      thread.join();
+    }
+
+    Seconds const duration = Clock::now() - start;
+
+    running = false;
+    for (auto &thread : background)
+    {
+      thread.join();
+    }
+
+    state.SetIterationTime(duration.count());
+    total_requests += fast_clients * REQUESTS_PER_CLIENT;
+    total_duration += duration;
+  }
+
+  auto const snapshot = latency.GetSnapshot();
+
+  state.counters["req_per_s"] = static_cast<double>(total_requests) / total_duration.count();
+  state.counters["p50_us"]    = static_cast<double>(snapshot.ValueAtPercentile(50.0)) / 1e3;
+  state.counters["p99_us"]    = static_cast<double>(snapshot.ValueAtPercentile(99.0)) / 1e3;
+
+  server.reset();
+  network_manager.Stop();
+}
+
+void LoadArguments(benchmark::internal::Benchmark *b)
+{
+  for (int64_t fast_clients : {1, 8, 32})
+  {
+    for (int64_t slow_clients : {0, 4})
+    {
+      b->Args({fast_clients, slow_clients});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(HttpServer_KeepAliveLoad)
+    ->Apply(LoadArguments)
+    ->UseManualTime()
+    ->Unit(benchmark::kMillisecond);
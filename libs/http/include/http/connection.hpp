@@ -20,7 +20,7 @@
 #include "core/assert.hpp"
 #include "core/byte_array/byte_array.hpp"
 #include "core/logger.hpp"
-#include "core/mutex.hpp"
+#include "core/string/to_lower.hpp"
 #include "http/abstract_connection.hpp"
 #include "http/http_connection_manager.hpp"
 #include "http/request.hpp"
@@ -33,6 +33,15 @@
 namespace fetch {
 namespace http {
 
+/**
+ * A (persistent) HTTP connection to a client.
+ *
+ * Requests are read one at a time. The next request on the connection is only read once the
+ * response to the current one has been queued, this ensures that responses are returned in order
+ * even though the server evaluates requests from different connections in parallel. All the
+ * socket operations of a connection are serialised on a strand since responses are submitted from
+ * the worker threads of the server.
+ */
 class HTTPConnection : public AbstractHTTPConnection,
                        public std::enable_shared_from_this<HTTPConnection>
 {
@@ -42,13 +51,16 @@ public:
   using handle_type         = HTTPConnectionManager::handle_type;
   using shared_request_type = std::shared_ptr<HTTPRequest>;
   using buffer_ptr_type     = std::shared_ptr<asio::streambuf>;
+  using strand_type         = asio::io_service::strand;
+  using strand_ptr_type     = std::shared_ptr<strand_type>;
 
   static constexpr char const *LOGGING_NAME = "HTTPConnection";
 
-  HTTPConnection(asio::ip::tcp::tcp::socket socket, HTTPConnectionManager &manager)
+  HTTPConnection(asio::ip::tcp::tcp::socket socket, strand_ptr_type strand,
+                 HTTPConnectionManager &manager)
     : socket_(std::move(socket))
+    , strand_(std::move(strand))
     , manager_(manager)
-    , write_mutex_(__LINE__, __FILE__)
   {
     LOG_STACK_TRACE_POINT;
 
@@ -71,7 +83,8 @@ public:
     handle_  = manager_.Join(shared_from_this());
     if (is_open_)
     {
-      ReadHeader();
+      auto self = shared_from_this();
+      strand_->dispatch([this, self] { ReadHeader(); });
     }
   }
 
@@ -79,15 +92,29 @@ public:
   {
     LOG_STACK_TRACE_POINT;
 
-    write_mutex_.lock();
-    bool write_in_progress = !write_queue_.empty();
-    write_queue_.push_back(response);
-    write_mutex_.unlock();
+    auto self = shared_from_this();
+    strand_->dispatch([this, self, response] {
+      bool const write_in_progress = !write_queue_.empty();
 
-    if (!write_in_progress)
-    {
-      Write();
-    }
+      write_queue_.push_back(response);
+      write_queue_.back().AddHeader("connection", keep_alive_ ? "keep-alive" : "close");
+
+      if (!write_in_progress)
+      {
+        Write();
+      }
+
+      // now that the response is queued it is safe to start processing the next request
+      if (awaiting_response_)
+      {
+        awaiting_response_ = false;
+
+        if (is_open_ && keep_alive_)
+        {
+          ReadHeader(read_buffer_);
+        }
+      }
+    });
   }
 
   std::string Address() override
@@ -140,7 +167,7 @@ public:
       }
     };
 
-    asio::async_read_until(socket_, *buffer_ptr, "\r\n\r\n", cb);
+    asio::async_read_until(socket_, *buffer_ptr, "\r\n\r\n", strand_->wrap(cb));
   }
 
   void ReadBody(buffer_ptr_type buffer_ptr, shared_request_type request)
@@ -158,13 +185,14 @@ public:
       auto const &remote_endpoint = socket_.remote_endpoint();
       request->SetOriginatingAddress(remote_endpoint.address().to_string(), remote_endpoint.port());
 
+      // the next request will be read once the response to this one has been queued (any data
+      // already received for it is retained in the buffer)
+      keep_alive_        = IsKeepAlive(*request);
+      awaiting_response_ = true;
+      read_buffer_       = buffer_ptr;
+
       // push the request to the main server
       manager_.PushRequest(handle_, *request);
-
-      if (is_open_)
-      {
-        ReadHeader(buffer_ptr);
-      }
       return;
     }
 
@@ -189,7 +217,8 @@ public:
     };
 
     asio::async_read(socket_, *buffer_ptr,
-                     asio::transfer_exactly(request->content_length() - buffer_ptr->size()), cb);
+                     asio::transfer_exactly(request->content_length() - buffer_ptr->size()),
+                     strand_->wrap(cb));
   }
 
   void HandleError(std::error_code const &ec, shared_request_type /*req*/)
@@ -209,22 +238,27 @@ public:
 
     buffer_ptr_type buffer_ptr =
         std::make_shared<asio::streambuf>(std::numeric_limits<std::size_t>::max());
-    write_mutex_.lock();
-    HTTPResponse res = write_queue_.front();
+
+    write_queue_.front().ToStream(*buffer_ptr);
     write_queue_.pop_front();
-    write_mutex_.unlock();
 
-    res.ToStream(*buffer_ptr);
     auto self = shared_from_this();
     auto cb   = [this, self, buffer_ptr](std::error_code ec, std::size_t) {
       if (!ec)
       {
-        write_mutex_.lock();
-        bool write_more = !write_queue_.empty();
-        write_mutex_.unlock();
-        if (is_open_ && write_more)
+        if (!write_queue_.empty())
+        {
+          if (is_open_)
+          {
+            Write();
+          }
+        }
+        else if (!keep_alive_ && !awaiting_response_)
         {
-          Write();
+          // the client has requested that the connection is closed after the response
+          std::error_code dummy;
+          socket_.shutdown(asio::ip::tcp::socket::shutdown_both, dummy);
+          Close();
         }
       }
       else
@@ -233,7 +267,7 @@ public:
       }
     };
 
-    asio::async_write(socket_, *buffer_ptr, cb);
+    asio::async_write(socket_, *buffer_ptr, strand_->wrap(cb));
   }
 
   void Close()
@@ -245,13 +279,36 @@ public:
   }
 
 private:
+  /**
+   * Determine if the connection should be kept open after responding to the request. This is the
+   * default for HTTP/1.1 while HTTP/1.0 clients must request it explicitly.
+   *
+   * @param request The request received on the connection
+   * @return true if the connection should persist, otherwise false
+   */
+  static bool IsKeepAlive(HTTPRequest const &request)
+  {
+    std::string connection{request.header()["connection"]};
+    string::ToLower(connection);
+
+    if (request.protocol() == "HTTP/1.0")
+    {
+      return connection == "keep-alive";
+    }
+
+    return connection != "close";
+  }
+
   asio::ip::tcp::tcp::socket socket_;
+  strand_ptr_type            strand_;
   HTTPConnectionManager &    manager_;
   response_queue_type        write_queue_;
-  fetch::mutex::Mutex        write_mutex_;
+  buffer_ptr_type            read_buffer_;
 
   handle_type handle_;
-  bool        is_open_ = false;
+  bool        is_open_           = false;
+  bool        keep_alive_        = true;
+  bool        awaiting_response_ = false;
 };
 }  // namespace http
 }  // namespace fetch
@@ -54,14 +54,23 @@ public:
   {
     LOG_STACK_TRACE_POINT;
 
-    std::lock_guard<fetch::mutex::Mutex> lock(clients_mutex_);
+    // the connection is released outside of the lock since this might well be the last reference to
+    // it (and the connection will leave the manager as part of its destruction)
+    connection_type connection;
 
-    if (clients_.find(handle) != clients_.end())
     {
-      FETCH_LOG_DEBUG(LOGGING_NAME, "Client ", handle, " is leaving");
-      // TODO(issue 35): Close socket!
-      clients_.erase(handle);
+      std::lock_guard<fetch::mutex::Mutex> lock(clients_mutex_);
+
+      auto it = clients_.find(handle);
+      if (it != clients_.end())
+      {
+        FETCH_LOG_DEBUG(LOGGING_NAME, "Client ", handle, " is leaving");
+        // TODO(issue 35): Close socket!
+        connection = std::move(it->second);
+        clients_.erase(it);
+      }
     }
+
     FETCH_LOG_DEBUG(LOGGING_NAME, "Client ", handle, " is leaving");
   }
 
@@ -69,24 +78,28 @@ public:
   {
     LOG_STACK_TRACE_POINT;
 
-    bool ret = true;
-    clients_mutex_.lock();
+    connection_type connection;
 
-    if (clients_.find(client) != clients_.end())
     {
-      auto c = clients_[client];
-      clients_mutex_.unlock();
-      c->Send(res);
-      FETCH_LOG_DEBUG(LOGGING_NAME, "Client manager did send message to ", client);
-      clients_mutex_.lock();
+      std::lock_guard<fetch::mutex::Mutex> lock(clients_mutex_);
+
+      auto it = clients_.find(client);
+      if (it != clients_.end())
+      {
+        connection = it->second;
+      }
     }
-    else
+
+    if (!connection)
     {
       FETCH_LOG_DEBUG(LOGGING_NAME, "Client not found.");
-      ret = false;
+      return false;
     }
-    clients_mutex_.unlock();
-    return ret;
+
+    connection->Send(res);
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Client manager did send message to ", client);
+
+    return true;
   }
 
   void PushRequest(handle_type client, HTTPRequest const &req)
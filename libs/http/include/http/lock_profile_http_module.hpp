@@ -0,0 +1,47 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/lock_profiler.hpp"
+#include "http/mime_types.hpp"
+#include "http/module.hpp"
+
+#include <sstream>
+
+namespace fetch {
+namespace http {
+
+/**
+ * Exposes the lock contention profile (only populated in debug builds)
+ */
+class LockProfileHttpModule : public HTTPModule
+{
+public:
+  LockProfileHttpModule()
+  {
+    Get("/api/debug/locks", [](ViewParameters const &, HTTPRequest const &) {
+      std::ostringstream body;
+      mutex::LockProfiler::Instance().Report(body);
+
+      return HTTPResponse(body.str(), mime_types::GetMimeTypeFromExtension(".txt"));
+    });
+  }
+};
+
+}  // namespace http
+}  // namespace fetch
@@ -0,0 +1,55 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/mime_types.hpp"
+#include "http/module.hpp"
+#include "metrics/registry.hpp"
+
+#include <sstream>
+
+namespace fetch {
+namespace http {
+
+/**
+ * Exposes the contents of a metrics registry in the Prometheus text format
+ */
+class MetricsHttpModule : public HTTPModule
+{
+public:
+  using Registry = metrics::Registry;
+
+  explicit MetricsHttpModule(Registry const &registry = Registry::Instance())
+    : registry_{registry}
+  {
+    Get("/metrics", [this](ViewParameters const &, HTTPRequest const &) {
+      static MimeType const exposition_type{".txt", "text/plain; version=0.0.4"};
+
+      std::ostringstream body;
+      registry_.Collect(body);
+
+      return HTTPResponse(body.str(), exposition_type);
+    });
+  }
+
+private:
+  Registry const &registry_;
+};
+
+}  // namespace http
+}  // namespace fetch
@@ -23,6 +23,7 @@
 #include "http/response.hpp"
 #include "http/view_parameters.hpp"
 
+#include <cstddef>
 #include <vector>
 namespace fetch {
 namespace http {
@@ -38,11 +39,15 @@ public:
 
   using view_type = std::function<HTTPResponse(ViewParameters, HTTPRequest)>;
 
+  /// Use the concurrency limit configured on the server
+  static constexpr std::size_t DEFAULT_CONCURRENCY = 0;
+
   struct UnmountedView
   {
     Method                method;
     byte_array::ByteArray route;
     view_type             view;
+    std::size_t           max_concurrency;
   };
 
   void Post(byte_array::ByteArray const &path, view_type const &view)
@@ -80,11 +85,21 @@ public:
     AddView(Method::DELETE, path, view);
   }
 
-  void AddView(Method method, byte_array::ByteArray const &path, view_type const &view)
+  /**
+   * Add a view to the module
+   *
+   * @param method The method of the view
+   * @param path The route of the view
+   * @param view The view handler
+   * @param max_concurrency The maximum number of requests for this view which the server will
+   *                        evaluate in parallel (or DEFAULT_CONCURRENCY)
+   */
+  void AddView(Method method, byte_array::ByteArray const &path, view_type const &view,
+               std::size_t max_concurrency = DEFAULT_CONCURRENCY)
   {
     LOG_STACK_TRACE_POINT;
 
-    views_.push_back({method, path, view});
+    views_.push_back({method, path, view, max_concurrency});
   }
 
   std::vector<UnmountedView> const &views() const
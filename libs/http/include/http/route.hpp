@@ -19,6 +19,7 @@
 
 #include "http/view_parameters.hpp"
 
+#include "core/assert.hpp"
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/logger.hpp"
@@ -36,14 +37,14 @@ class Route
 public:
   static constexpr char const *LOGGING_NAME = "HttpRoute";
 
-  bool Match(byte_array::ConstByteArray const &path, ViewParameters &params)
+  bool Match(byte_array::ConstByteArray const &path, ViewParameters &params) const
   {
     LOG_STACK_TRACE_POINT;
 
     std::size_t i = 0;
     params.Clear();
 
-    for (auto &m : match_)
+    for (auto const &m : match_)
     {
       if (!m(i, path, params))
       {
@@ -86,6 +87,12 @@ public:
         ++i;
         byte_array::ByteArray param_name = path.SubArray(i, j - i - 1);
 
+        if (!ret.has_parameters_)
+        {
+          ret.prefix_         = path.SubArray(0, i - 1);
+          ret.has_parameters_ = true;
+        }
+
         ret.AddMatch(match);
         ret.AddParameter(param_name);
         last = j;
@@ -99,9 +106,36 @@ public:
       ret.AddMatch(match);
     }
 
+    if (!ret.has_parameters_)
+    {
+      ret.prefix_ = path;
+    }
+
     return ret;
   }
 
+  /**
+   * The route as it was originally specified
+   */
+  byte_array::ConstByteArray const &original() const
+  {
+    return original_;
+  }
+
+  /**
+   * The literal part of the route which precedes the first parameter. For routes without any
+   * parameters this is the complete route.
+   */
+  byte_array::ConstByteArray const &prefix() const
+  {
+    return prefix_;
+  }
+
+  bool has_parameters() const
+  {
+    return has_parameters_;
+  }
+
 private:
   using match_function_type =
       std::function<bool(std::size_t &, byte_array::ByteArray const &, ViewParameters &)>;
@@ -165,6 +199,8 @@ private:
   }
 
   byte_array::ByteArray            original_;
+  byte_array::ByteArray            prefix_;
+  bool                             has_parameters_{false};
   std::vector<match_function_type> match_;
 };
 }  // namespace http
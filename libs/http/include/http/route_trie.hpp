@@ -0,0 +1,78 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "http/method.hpp"
+
+#include <cstddef>
+#include <map>
+#include <vector>
+
+namespace fetch {
+namespace http {
+
+class Route;
+
+/**
+ * Index of the mounted routes of a server, used to quickly reduce the set of routes which need to
+ * be evaluated for an incoming request.
+ *
+ * Routes are split into path segments and are stored (per method) in a trie. Each route is placed
+ * on the deepest node which is covered by the literal part of the route, i.e. the part before the
+ * first parameter. A lookup walks the segments of the requested path and collects the routes from
+ * each of the visited nodes. The candidates are returned in the order in which the routes were
+ * added so that the first matching route continues to take precedence.
+ */
+class RouteTrie
+{
+public:
+  using Index     = std::size_t;
+  using IndexList = std::vector<Index>;
+
+  void Add(Method method, Route const &route, Index index);
+  void Lookup(Method method, byte_array::ConstByteArray const &path, IndexList &candidates) const;
+
+  std::size_t size() const
+  {
+    return size_;
+  }
+
+private:
+  using Segment  = byte_array::ConstByteArray;
+  using Children = std::map<Segment, std::size_t>;
+
+  struct Node
+  {
+    IndexList routes;
+    Children  children;
+  };
+
+  using Nodes = std::vector<Node>;
+  using Roots = std::map<Method, std::size_t>;
+
+  std::size_t LookupChild(std::size_t node, Segment const &segment) const;
+  std::size_t InsertChild(std::size_t node, Segment const &segment);
+
+  Nodes       nodes_;
+  Roots       roots_;
+  std::size_t size_{0};
+};
+
+}  // namespace http
+}  // namespace fetch
@@ -17,15 +17,22 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/mutex.hpp"
 #include "http/connection.hpp"
 #include "http/http_connection_manager.hpp"
 #include "http/module.hpp"
 #include "http/route.hpp"
+#include "http/route_trie.hpp"
+#include "network/details/thread_pool.hpp"
 #include "network/management/network_manager.hpp"
 
+#include <algorithm>
+#include <cstddef>
 #include <deque>
+#include <exception>
 #include <functional>
 #include <map>
+#include <memory>
 #include <regex>
 #include <utility>
 #include <vector>
@@ -33,6 +40,15 @@
 namespace fetch {
 namespace http {
 
+/**
+ * HTTP server which evaluates the requests it receives on a pool of worker threads.
+ *
+ * Incoming requests are matched against the mounted views using a route trie (keyed by the method
+ * and the literal path segments of each route) and the matching view is evaluated on one of the
+ * workers. Each view has a limit on the number of requests which are evaluated in parallel,
+ * requests exceeding this limit are queued against the view. This prevents a single slow view
+ * from occupying all of the workers while not imposing any ordering between unrelated views.
+ */
 class HTTPServer : public AbstractHTTPServer
 {
 public:
@@ -49,15 +65,40 @@ public:
 
   static constexpr char const *LOGGING_NAME = "HTTPServer";
 
+  static constexpr std::size_t DEFAULT_NUM_THREADS  = 4;
+  static constexpr std::size_t MAX_PENDING_REQUESTS = 256;  ///< Per view queue limit
+
+  struct PendingRequest
+  {
+    handle_type    client;
+    HTTPRequest    request;
+    ViewParameters params;
+  };
+
   struct MountedView
   {
-    Method    method;
-    Route     route;
-    view_type view;
+    MountedView(Method m, Route r, view_type v, std::size_t limit)
+      : method{m}
+      , route{std::move(r)}
+      , view{std::move(v)}
+      , max_concurrency{limit}
+    {}
+
+    Method      method;
+    Route       route;
+    view_type   view;
+    std::size_t max_concurrency;
+
+    mutex::Mutex               lock{__LINE__, __FILE__};
+    std::size_t                active{0};  ///< The number of requests being evaluated
+    std::deque<PendingRequest> pending;    ///< The requests waiting for a free slot
   };
 
-  explicit HTTPServer(network_manager_type const &network_manager)
-    : networkManager_(network_manager)
+  explicit HTTPServer(network_manager_type const &network_manager,
+                      std::size_t                 num_threads = DEFAULT_NUM_THREADS)
+    : num_threads_{std::max<std::size_t>(num_threads, 1)}
+    , networkManager_(network_manager)
+    , thread_pool_{network::MakeThreadPool(num_threads_, "HTTP")}
   {
     LOG_STACK_TRACE_POINT;
   }
@@ -66,6 +107,8 @@ public:
   {
     LOG_STACK_TRACE_POINT;
 
+    thread_pool_->Stop();
+
     auto socketWeak = socket_;
     auto accepWeak  = acceptor_;
 
@@ -90,6 +133,8 @@ public:
 
   void Start(uint16_t port)
   {
+    thread_pool_->Start();
+
     std::shared_ptr<manager_type> manager   = manager_;
     std::weak_ptr<socket_type> &  socRef    = socket_;
     std::weak_ptr<acceptor_type> &accepRef  = acceptor_;
@@ -108,12 +153,14 @@ public:
       accepRef = accep;
 
       FETCH_LOG_DEBUG(LOGGING_NAME, "Starting HTTPServer Accept");
-      HTTPServer::Accept(soc, accep, manager);
+      HTTPServer::Accept(threadMan, soc, accep, manager);
     });
   }
 
   void Stop()
-  {}
+  {
+    thread_pool_->Stop();
+  }
 
   void PushRequest(handle_type client, HTTPRequest req) override
   {
@@ -134,48 +181,31 @@ public:
       return;
     }
 
-    // TODO(issue 28): improve such that it works for multiple threads.
-    eval_mutex_.lock();
-    for (auto &m : pre_view_middleware_)
-    {
-      m(req);
-    }
-
-    HTTPResponse   res("page not found", mime_types::GetMimeTypeFromExtension(".html"),
-                     Status::CLIENT_ERROR_NOT_FOUND);
-    ViewParameters params;
-
-    for (auto &v : views_)
-    {
-      if (v.route.Match(req.uri(), params))
-      {
-        res = v.view(params, req);
-        break;
-      }
-    }
-
-    for (auto &m : post_view_middleware_)
-    {
-      m(res, req);
-    }
-
-    eval_mutex_.unlock();
-
-    manager_->Send(client, res);
+    // evaluate the request on the worker pool so that the network threads are never held up by
+    // the views
+    thread_pool_->Post(
+        [this, client, request = std::move(req)]() mutable { ProcessRequest(client, request); });
   }
 
   // Accept static void to avoid having to create shared ptr to this class
-  static void Accept(std::shared_ptr<socket_type> soc, std::shared_ptr<acceptor_type> accep,
-                     std::shared_ptr<manager_type> manager)
+  static void Accept(network_manager_type network_manager, std::shared_ptr<socket_type> soc,
+                     std::shared_ptr<acceptor_type> accep, std::shared_ptr<manager_type> manager)
   {
     LOG_STACK_TRACE_POINT;
 
-    auto cb = [soc, accep, manager](std::error_code ec) {
+    auto cb = [network_manager, soc, accep, manager](std::error_code ec) mutable {
       // LOG_LAMBDA_STACK_TRACE_POINT; // TODO(issue 28) : sort this
 
       if (!ec)
       {
-        std::make_shared<HTTPConnection>(std::move(*soc), *manager)->Start();
+        auto strand = network_manager.CreateIO<HTTPConnection::strand_type>();
+        if (!strand)
+        {
+          FETCH_LOG_WARN(LOGGING_NAME, "Unable to create connection strand");
+          return;
+        }
+
+        std::make_shared<HTTPConnection>(std::move(*soc), std::move(strand), *manager)->Start();
       }
       else
       {
@@ -187,7 +217,7 @@ public:
       std::shared_ptr<acceptor_type> a = accep;
       std::shared_ptr<manager_type>  m = manager;
 
-      HTTPServer::Accept(s, a, m);
+      HTTPServer::Accept(network_manager, s, a, m);
     };
 
     FETCH_LOG_DEBUG(LOGGING_NAME, "Starting HTTPServer async accept");
@@ -196,17 +226,40 @@ public:
 
   void AddMiddleware(request_middleware_type const &middleware)
   {
-    pre_view_middleware_.push_back(middleware);
+    UpdateRoutes(
+        [&middleware](Routes &routes) { routes.pre_view_middleware.push_back(middleware); });
   }
 
   void AddMiddleware(response_middleware_type const &middleware)
   {
-    post_view_middleware_.push_back(middleware);
+    UpdateRoutes(
+        [&middleware](Routes &routes) { routes.post_view_middleware.push_back(middleware); });
   }
 
-  void AddView(Method method, byte_array::ByteArray const &path, view_type const &view)
+  /**
+   * Mount a view on the server
+   *
+   * @param method The method of the view
+   * @param path The route of the view
+   * @param view The view handler
+   * @param max_concurrency The maximum number of requests for this view which are evaluated in
+   *                        parallel. By default a view may occupy all but one of the workers.
+   */
+  void AddView(Method method, byte_array::ByteArray const &path, view_type const &view,
+               std::size_t max_concurrency = HTTPModule::DEFAULT_CONCURRENCY)
   {
-    views_.push_back({method, Route::FromString(path), view});
+    if (max_concurrency == HTTPModule::DEFAULT_CONCURRENCY)
+    {
+      max_concurrency = std::max<std::size_t>(num_threads_ - 1, 1);
+    }
+
+    auto mounted =
+        std::make_shared<MountedView>(method, Route::FromString(path), view, max_concurrency);
+
+    UpdateRoutes([&mounted](Routes &routes) {
+      routes.trie.Add(mounted->method, mounted->route, routes.views.size());
+      routes.views.push_back(mounted);
+    });
   }
 
   void AddModule(HTTPModule const &module)
@@ -214,19 +267,227 @@ public:
     LOG_STACK_TRACE_POINT;
     for (auto const &view : module.views())
     {
-      this->AddView(view.method, view.route, view.view);
+      this->AddView(view.method, view.route, view.view, view.max_concurrency);
     }
   }
 
 private:
-  std::mutex eval_mutex_;
+  using MountedViewPtr = std::shared_ptr<MountedView>;
+  using ThreadPool     = network::ThreadPool;
+
+  /**
+   * The mounted views and middleware. Once published, a set of routes is never modified so that
+   * the workers can evaluate requests against it without any locking.
+   */
+  struct Routes
+  {
+    std::vector<request_middleware_type>  pre_view_middleware;
+    std::vector<MountedViewPtr>           views;
+    std::vector<response_middleware_type> post_view_middleware;
+    RouteTrie                             trie;
+  };
+
+  using RoutesPtr      = std::shared_ptr<Routes const>;
+  using RoutesUpdateFn = std::function<void(Routes &)>;
+
+  RoutesPtr GetRoutes() const
+  {
+    return std::atomic_load(&routes_);
+  }
+
+  void UpdateRoutes(RoutesUpdateFn const &update)
+  {
+    FETCH_LOCK(routes_lock_);
+
+    auto routes = std::make_shared<Routes>(*routes_);
+    update(*routes);
+
+    std::atomic_store(&routes_, RoutesPtr{std::move(routes)});
+  }
+
+  /**
+   * Match the request to a view and evaluate it (executed on the worker pool)
+   *
+   * @param client The handle of the client connection
+   * @param req The request to be evaluated
+   */
+  void ProcessRequest(handle_type client, HTTPRequest &req)
+  {
+    LOG_STACK_TRACE_POINT;
+
+    auto const routes = GetRoutes();
+
+    try
+    {
+      for (auto const &m : routes->pre_view_middleware)
+      {
+        m(req);
+      }
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Exception raised by pre view middleware: ", ex.what());
+
+      SendResponse(*routes, client, req, InternalServerError());
+      return;
+    }
+
+    // lookup the matching view
+    RouteTrie::IndexList candidates;
+    routes->trie.Lookup(req.method(), req.uri(), candidates);
+
+    MountedViewPtr mounted;
+    ViewParameters params;
+    for (auto const index : candidates)
+    {
+      auto const &view = routes->views[index];
+      if (view->route.Match(req.uri(), params))
+      {
+        mounted = view;
+        break;
+      }
+    }
+
+    if (!mounted)
+    {
+      SendResponse(*routes, client, req,
+                   HTTPResponse("page not found", mime_types::GetMimeTypeFromExtension(".html"),
+                                Status::CLIENT_ERROR_NOT_FOUND));
+      return;
+    }
+
+    // determine if the view is able to accept another request at this point
+    bool rejected = false;
+    {
+      FETCH_LOCK(mounted->lock);
+
+      if (mounted->active >= mounted->max_concurrency)
+      {
+        if (mounted->pending.size() < MAX_PENDING_REQUESTS)
+        {
+          mounted->pending.push_back(PendingRequest{client, std::move(req), std::move(params)});
+          return;
+        }
+
+        rejected = true;
+      }
+      else
+      {
+        ++mounted->active;
+      }
+    }
+
+    if (rejected)
+    {
+      HTTPResponse res("service unavailable", mime_types::GetMimeTypeFromExtension(".html"),
+                       Status::SERVER_ERROR_SERVICE_UNAVAILABLE);
+      res.AddHeader("Retry-After", "1");
+
+      SendResponse(*routes, client, req, std::move(res));
+      return;
+    }
+
+    ExecuteView(*routes, *mounted, client, req, params);
+  }
+
+  /**
+   * Evaluate a view along with any requests which have been queued against it in the meantime
+   *
+   * @param routes The current set of routes
+   * @param mounted The view to evaluate, a slot must have been reserved for this request
+   * @param client The handle of the client connection
+   * @param req The request to be evaluated
+   * @param params The parameters extracted from the route
+   */
+  void ExecuteView(Routes const &routes, MountedView &mounted, handle_type client,
+                   HTTPRequest const &req, ViewParameters const &params)
+  {
+    PendingRequest next{client, req, params};
+
+    for (;;)
+    {
+      SendResponse(routes, next.client, next.request,
+                   EvaluateView(mounted, next.params, next.request));
+
+      // either hand the slot over to the next queued request or release it
+      FETCH_LOCK(mounted.lock);
+
+      if (mounted.pending.empty())
+      {
+        --mounted.active;
+        break;
+      }
+
+      next = std::move(mounted.pending.front());
+      mounted.pending.pop_front();
+    }
+  }
+
+  static HTTPResponse EvaluateView(MountedView const &mounted, ViewParameters const &params,
+                                   HTTPRequest const &req)
+  {
+    try
+    {
+      return mounted.view(params, req);
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Exception raised by view ", mounted.route.original(), ": ",
+                     ex.what());
+    }
+
+    return InternalServerError();
+  }
+
+  static HTTPResponse InternalServerError()
+  {
+    return HTTPResponse("internal server error", mime_types::GetMimeTypeFromExtension(".html"),
+                        Status::SERVER_ERROR_INTERNAL_SERVER_ERROR);
+  }
+
+  /**
+   * Apply the post view middleware and send the response to the client. This never throws, so
+   * that the client always receives a response and the callers can always release the view.
+   *
+   * @param routes The current set of routes
+   * @param client The handle of the client connection
+   * @param req The request being responded to
+   * @param res The response to be sent
+   */
+  void SendResponse(Routes const &routes, handle_type client, HTTPRequest const &req,
+                    HTTPResponse res)
+  {
+    try
+    {
+      for (auto const &m : routes.post_view_middleware)
+      {
+        m(res, req);
+      }
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Exception raised by post view middleware: ", ex.what());
+
+      res = InternalServerError();
+    }
+
+    try
+    {
+      manager_->Send(client, res);
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to send response: ", ex.what());
+    }
+  }
+
+  std::size_t const num_threads_;
 
-  std::vector<request_middleware_type>  pre_view_middleware_;
-  std::vector<MountedView>              views_;
-  std::vector<response_middleware_type> post_view_middleware_;
+  mutex::Mutex routes_lock_{__LINE__, __FILE__};  ///< Serialises updates to the routes
+  RoutesPtr    routes_{std::make_shared<Routes const>()};
 
   network_manager_type          networkManager_;
-  std::deque<HTTPRequest>       requests_;
+  ThreadPool                    thread_pool_;
   std::weak_ptr<acceptor_type>  acceptor_;
   std::weak_ptr<socket_type>    socket_;
   std::shared_ptr<manager_type> manager_{std::make_shared<manager_type>(*this)};
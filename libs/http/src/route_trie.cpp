@@ -0,0 +1,204 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/route_trie.hpp"
+#include "http/route.hpp"
+
+#include <algorithm>
+#include <limits>
+
+namespace fetch {
+namespace http {
+namespace {
+
+using byte_array::ConstByteArray;
+
+constexpr std::size_t INVALID_NODE = std::numeric_limits<std::size_t>::max();
+
+/**
+ * Determine the end of the path segment which starts at the specified position
+ *
+ * @param path The path being split
+ * @param start The start index of the segment
+ * @return The index of the next separator or the size of the path
+ */
+std::size_t SegmentEnd(ConstByteArray const &path, std::size_t start)
+{
+  std::size_t end = start;
+  while ((end < path.size()) && (path[end] != '/'))
+  {
+    ++end;
+  }
+
+  return end;
+}
+
+/**
+ * Split the literal part of a route into the path segments which a request must match exactly,
+ * i.e. "/api/contract/(name=.+)" -> {"api", "contract"} and "/api/status" -> {"api", "status"}
+ *
+ * @param route The route to be split
+ * @return The list of complete segments
+ */
+std::vector<ConstByteArray> CompleteSegments(Route const &route)
+{
+  std::vector<ConstByteArray> segments;
+
+  ConstByteArray const &prefix = route.prefix();
+  if (prefix.empty() || (prefix[0] != '/'))
+  {
+    return segments;
+  }
+
+  std::size_t start = 1;
+  for (;;)
+  {
+    std::size_t const end = SegmentEnd(prefix, start);
+
+    // the segment trailing the literal part of a route continues into the first parameter and
+    // therefore can not be used to index the route
+    if ((end == prefix.size()) && route.has_parameters())
+    {
+      break;
+    }
+
+    segments.push_back(prefix.SubArray(start, end - start));
+
+    if (end == prefix.size())
+    {
+      break;
+    }
+
+    start = end + 1;
+  }
+
+  return segments;
+}
+
+}  // namespace
+
+/**
+ * Add a route to the trie
+ *
+ * @param method The method of the route
+ * @param route The route being added
+ * @param index The index which identifies the route, expected to be increasing for each call
+ */
+void RouteTrie::Add(Method method, Route const &route, Index index)
+{
+  auto root_it = roots_.find(method);
+  if (root_it == roots_.end())
+  {
+    root_it = roots_.emplace(method, nodes_.size()).first;
+    nodes_.emplace_back();
+  }
+
+  std::size_t node = root_it->second;
+  for (auto const &segment : CompleteSegments(route))
+  {
+    node = InsertChild(node, segment);
+  }
+
+  nodes_[node].routes.push_back(index);
+  ++size_;
+}
+
+/**
+ * Lookup the routes which could potentially match the specified path
+ *
+ * @param method The method of the request
+ * @param path The path of the request
+ * @param candidates The output list of route indices in the order in which they were added
+ */
+void RouteTrie::Lookup(Method method, ConstByteArray const &path, IndexList &candidates) const
+{
+  candidates.clear();
+
+  auto const root_it = roots_.find(method);
+  if (root_it == roots_.end())
+  {
+    return;
+  }
+
+  std::size_t node = root_it->second;
+  candidates       = nodes_[node].routes;
+
+  if (path.empty() || (path[0] != '/'))
+  {
+    return;
+  }
+
+  bool        merged = false;
+  std::size_t start  = 1;
+  for (;;)
+  {
+    std::size_t const end = SegmentEnd(path, start);
+
+    node = LookupChild(node, path.SubArray(start, end - start));
+    if (node == INVALID_NODE)
+    {
+      break;
+    }
+
+    auto const &routes = nodes_[node].routes;
+    if (!routes.empty())
+    {
+      merged = merged || !candidates.empty();
+      candidates.insert(candidates.end(), routes.begin(), routes.end());
+    }
+
+    if (end == path.size())
+    {
+      break;
+    }
+
+    start = end + 1;
+  }
+
+  // restore the order in which the routes were added when they have been collected from several
+  // nodes of the trie
+  if (merged)
+  {
+    std::sort(candidates.begin(), candidates.end());
+  }
+}
+
+std::size_t RouteTrie::LookupChild(std::size_t node, Segment const &segment) const
+{
+  auto const &children = nodes_[node].children;
+  auto const  it       = children.find(segment);
+
+  return (it == children.end()) ? INVALID_NODE : it->second;
+}
+
+std::size_t RouteTrie::InsertChild(std::size_t node, Segment const &segment)
+{
+  std::size_t child = LookupChild(node, segment);
+
+  if (child == INVALID_NODE)
+  {
+    child = nodes_.size();
+    nodes_.emplace_back();
+    nodes_[node].children.emplace(segment.Copy(), child);
+  }
+
+  return child;
+}
+
+}  // namespace http
+}  // namespace fetch
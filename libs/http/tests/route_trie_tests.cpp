@@ -0,0 +1,122 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "http/route.hpp"
+#include "http/route_trie.hpp"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+namespace {
+
+using fetch::http::Method;
+using fetch::http::Route;
+using fetch::http::RouteTrie;
+using fetch::http::ViewParameters;
+
+using Routes    = std::vector<Route>;
+using IndexList = RouteTrie::IndexList;
+
+class RouteTrieTests : public ::testing::Test
+{
+protected:
+  void Add(Method method, char const *path)
+  {
+    routes_.emplace_back(Route::FromString(path));
+    trie_.Add(method, routes_.back(), routes_.size() - 1);
+  }
+
+  IndexList Lookup(Method method, char const *path)
+  {
+    IndexList candidates;
+    trie_.Lookup(method, path, candidates);
+    return candidates;
+  }
+
+  /// Evaluate the request the way the server does: the first matching candidate wins
+  int Match(Method method, char const *path)
+  {
+    ViewParameters params;
+    for (auto index : Lookup(method, path))
+    {
+      if (routes_[index].Match(path, params))
+      {
+        return static_cast<int>(index);
+      }
+    }
+
+    return -1;
+  }
+
+  Routes    routes_;
+  RouteTrie trie_;
+};
+
+TEST_F(RouteTrieTests, CheckLiteralPrefixes)
+{
+  EXPECT_EQ(Route::FromString("/api/status").prefix(), "/api/status");
+  EXPECT_FALSE(Route::FromString("/api/status").has_parameters());
+  EXPECT_EQ(Route::FromString("/api/tx/(digest=[a-f0-9]+)").prefix(), "/api/tx/");
+  EXPECT_TRUE(Route::FromString("/api/tx/(digest=[a-f0-9]+)").has_parameters());
+}
+
+TEST_F(RouteTrieTests, CheckCandidatesAreLimitedToThePath)
+{
+  Add(Method::GET, "/api/status");                 // 0
+  Add(Method::GET, "/api/status/chain");           // 1
+  Add(Method::POST, "/api/contract/submit");       // 2
+  Add(Method::GET, "/api/tx/(digest=[a-f0-9]+)");  // 3
+  Add(Method::GET, "/(anything=.+)");              // 4
+  Add(Method::GET, "/metrics");                    // 5
+
+  EXPECT_EQ(trie_.size(), 6u);
+
+  EXPECT_EQ(Lookup(Method::GET, "/api/status"), (IndexList{0, 4}));
+  EXPECT_EQ(Lookup(Method::GET, "/api/tx/abc"), (IndexList{3, 4}));
+  EXPECT_EQ(Lookup(Method::GET, "/metrics"), (IndexList{4, 5}));
+  EXPECT_EQ(Lookup(Method::POST, "/api/contract/submit"), (IndexList{2}));
+  EXPECT_EQ(Lookup(Method::POST, "/api/status"), (IndexList{}));
+  EXPECT_EQ(Lookup(Method::PUT, "/api/status"), (IndexList{}));
+}
+
+TEST_F(RouteTrieTests, CheckRegistrationOrderTakesPrecedence)
+{
+  Add(Method::GET, "/index");                    // 0
+  Add(Method::GET, "/pages");                    // 1
+  Add(Method::GET, "/pages/sub");                // 2
+  Add(Method::GET, "/pages/sub/");               // 3
+  Add(Method::GET, "/pages/(id=\\d+)");          // 4
+  Add(Method::GET, "/other/(name=\\w+)");        // 5
+  Add(Method::GET, "/(catch=.+)");               // 6
+  Add(Method::POST, "/pages");                   // 7
+  Add(Method::GET, "/pages/(name=[a-z]+)/sub");  // 8
+
+  EXPECT_EQ(Match(Method::GET, "/index"), 0);
+  EXPECT_EQ(Match(Method::GET, "/pages"), 1);
+  EXPECT_EQ(Match(Method::GET, "/pages/sub"), 2);
+  EXPECT_EQ(Match(Method::GET, "/pages/sub/"), 3);
+  EXPECT_EQ(Match(Method::GET, "/pages/42"), 4);
+  EXPECT_EQ(Match(Method::GET, "/other/name"), 5);
+  EXPECT_EQ(Match(Method::GET, "/unknown/path"), 6);
+  EXPECT_EQ(Match(Method::GET, "/pages/foo/sub"), 6);
+  EXPECT_EQ(Match(Method::POST, "/pages"), 7);
+  EXPECT_EQ(Match(Method::POST, "/pages/sub"), -1);
+}
+
+}  // namespace
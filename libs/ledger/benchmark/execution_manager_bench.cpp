@@ -0,0 +1,153 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/macros.hpp"
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
+#include "ledger/chain/block.hpp"
+#include "ledger/execution_manager.hpp"
+#include "ledger/executor_interface.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::byte_array::ByteArray;
+using fetch::crypto::Hash;
+using fetch::crypto::SHA256;
+using fetch::ledger::Address;
+using fetch::ledger::Block;
+using fetch::ledger::Digest;
+using fetch::ledger::ExecutionManager;
+using fetch::ledger::ExecutorInterface;
+using fetch::ledger::TransactionLayout;
+
+constexpr uint32_t    LOG2_NUM_LANES = 6;
+constexpr std::size_t NUM_LANES      = 1u << LOG2_NUM_LANES;
+constexpr std::size_t NUM_SLICES     = 16;
+
+/**
+ * A minimal executor which emulates the cost of a small transaction
+ */
+class DummyExecutor : public ExecutorInterface
+{
+public:
+  static constexpr std::size_t WORK_ROUNDS = 16;
+
+  Result Execute(Digest const &digest, BlockIndex, SliceIndex, BitVector const &) override
+  {
+    Digest value{digest};
+    for (std::size_t i = 0; i < WORK_ROUNDS; ++i)
+    {
+      value = Hash<SHA256>(value);
+    }
+
+    benchmark::DoNotOptimize(value);
+
+    return {Status::SUCCESS, 0, 0, 0};
+  }
+
+  void SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes) override
+  {
+    FETCH_UNUSED(miner);
+    FETCH_UNUSED(amount);
+    FETCH_UNUSED(log2_num_lanes);
+  }
+};
+
+Digest GenerateDigest(uint64_t index)
+{
+  ByteArray buffer;
+  buffer.Resize(sizeof(index));
+  std::memcpy(buffer.pointer(), &index, sizeof(index));
+
+  return Hash<SHA256>(buffer);
+}
+
+/**
+ * Generate a block where each slice is completely filled with single lane transactions
+ */
+Block::Body GenerateBlock()
+{
+  Block::Body block;
+  block.hash = GenerateDigest(0);
+  block.slices.resize(NUM_SLICES);
+
+  uint64_t index{1};
+  for (auto &slice : block.slices)
+  {
+    for (std::size_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+      BitVector mask{NUM_LANES};
+      mask.set(lane, 1);
+
+      slice.emplace_back(TransactionLayout{GenerateDigest(index++), mask, 1, 0, 100});
+    }
+  }
+
+  return block;
+}
+
+void ExecutionManager_ExecuteBlock(benchmark::State &state)
+{
+  auto const num_executors = static_cast<std::size_t>(state.range(0));
+  auto const block         = GenerateBlock();
+
+  auto manager = std::make_shared<ExecutionManager>(
+      num_executors, LOG2_NUM_LANES, nullptr, []() { return std::make_shared<DummyExecutor>(); });
+
+  manager->Start();
+
+  std::size_t const block_size = NUM_LANES * NUM_SLICES;
+  std::size_t       expected   = 0;
+
+  for (auto _ : state)
+  {
+    expected += block_size;
+
+    if (ExecutionManager::ScheduleStatus::SCHEDULED != manager->Execute(block))
+    {
+      state.SkipWithError("Unable to schedule block for execution");
+      break;
+    }
+
+    // wait for the block to be executed
+    while ((manager->completed_executions() < expected) ||
+           (ExecutionManager::State::IDLE != manager->GetState()))
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  manager->Stop();
+
+  state.counters["tx_per_sec"] = benchmark::Counter(
+      static_cast<double>(state.iterations() * block_size), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+BENCHMARK(ExecutionManager_ExecuteBlock)->RangeMultiplier(2)->Range(1, 64)->UseRealTime();
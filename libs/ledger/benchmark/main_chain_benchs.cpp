@@ -21,7 +21,10 @@
 
 #include <benchmark/benchmark.h>
 
+#include <atomic>
 #include <memory>
+#include <thread>
+#include <vector>
 
 namespace {
 
@@ -124,9 +127,60 @@ void MainChain_Persistent_AddBlocksOutOfOrder(benchmark::State &state)
   }
 }
 
+void MainChain_InMemory_AddBlocksWithConcurrentReaders(benchmark::State &state)
+{
+  static constexpr uint64_t READ_LIMIT = 100;
+
+  auto              array       = GenerateBlocks(state);
+  std::size_t const num_readers = static_cast<std::size_t>(state.range(0));
+
+  std::atomic<std::size_t> num_reads{0};
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto chain = std::make_unique<MainChain>(MainChain::Mode::IN_MEMORY_DB);
+
+    // create a series of readers which continually query the chain (like the HTTP interface or
+    // block sync would) while the blocks are being added
+    std::atomic<bool>        running{true};
+    std::vector<std::thread> readers{};
+    for (std::size_t i = 0; i < num_readers; ++i)
+    {
+      readers.emplace_back([&chain, &running, &num_reads]() {
+        while (running)
+        {
+          auto const blocks = chain->GetHeaviestChain(READ_LIMIT);
+          chain->GetBlock(blocks.back()->body.hash);
+
+          ++num_reads;
+        }
+      });
+    }
+    state.ResumeTiming();
+
+    for (std::size_t i = 1; i < array.size(); ++i)
+    {
+      chain->AddBlock(*array[i]);
+    }
+
+    state.PauseTiming();
+    running = false;
+    for (auto &reader : readers)
+    {
+      reader.join();
+    }
+    state.ResumeTiming();
+  }
+
+  state.counters["reads"] =
+      benchmark::Counter(static_cast<double>(num_reads.load()), benchmark::Counter::kAvgIterations);
+}
+
 }  // namespace
 
 BENCHMARK(MainChain_InMemory_AddBlocksSequentially);
 BENCHMARK(MainChain_Persistent_AddBlocksSequentially);
 BENCHMARK(MainChain_InMemory_AddBlocksOutOfOrder);
 BENCHMARK(MainChain_Persistent_AddBlocksOutOfOrder);
+BENCHMARK(MainChain_InMemory_AddBlocksWithConcurrentReaders)->Arg(0)->Arg(1)->Arg(2)->Arg(4);
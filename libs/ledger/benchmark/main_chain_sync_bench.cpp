@@ -0,0 +1,175 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/reactor.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/consensus/dummy_miner.hpp"
+#include "ledger/chain/main_chain.hpp"
+#include "ledger/protocols/main_chain_rpc_service.hpp"
+#include "ledger/testing/block_generator.hpp"
+#include "network/management/network_manager.hpp"
+#include "network/muddle/muddle.hpp"
+#include "network/p2pservice/p2ptrust.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::core::Reactor;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::MainChain;
+using fetch::ledger::MainChainRpcService;
+using fetch::ledger::consensus::DummyMiner;
+using fetch::ledger::testing::BlockGenerator;
+using fetch::muddle::Muddle;
+using fetch::muddle::NetworkId;
+using fetch::network::NetworkManager;
+
+using Address     = MainChainRpcService::Address;
+using TrustSystem = fetch::p2p::P2PTrust<Address>;
+using BlockArray  = std::vector<BlockGenerator::BlockPtr>;
+
+constexpr uint16_t SOURCE_PORT = 8120;
+
+/**
+ * A complete (in process) node containing a chain and the services required to sync it
+ */
+struct SyncNode
+{
+  using Mode = MainChainRpcService::Mode;
+
+  explicit SyncNode(Mode mode)
+    : muddle{NetworkId{"Sync"}, CreateIdentity(), manager}
+    , service{std::make_shared<MainChainRpcService>(muddle.AsEndpoint(), chain, trust, mode)}
+  {
+    manager.Start();
+  }
+
+  ~SyncNode()
+  {
+    muddle.Stop();
+    manager.Stop();
+  }
+
+  static Muddle::CertificatePtr CreateIdentity()
+  {
+    auto signer = std::make_shared<ECDSASigner>();
+    signer->GenerateKeys();
+    return signer;
+  }
+
+  NetworkManager                       manager{"NetMgr", 1};
+  Muddle                               muddle;
+  MainChain                            chain{MainChain::Mode::IN_MEMORY_DB};
+  TrustSystem                          trust{};
+  std::shared_ptr<MainChainRpcService> service;
+};
+
+BlockArray GenerateMinedBlocks(std::size_t num_blocks)
+{
+  static constexpr std::size_t NUM_LANES  = 1;
+  static constexpr std::size_t NUM_SLICES = 2;
+
+  BlockGenerator gen{NUM_LANES, NUM_SLICES};
+  DummyMiner     miner{};
+
+  BlockArray array(num_blocks + 1);
+
+  // genesis
+  array[0] = gen.Generate();
+
+  for (std::size_t i = 1; i < array.size(); ++i)
+  {
+    auto block = gen.Generate(array[i - 1]);
+
+    // the blocks need to have a valid (although trivial) proof in order to be synced
+    block->proof.SetTarget(1);
+    miner.Mine(*block);
+
+    array[i] = block;
+  }
+
+  return array;
+}
+
+void MainChainRpc_CatchUpFromLocalPeer(benchmark::State &state)
+{
+  using std::this_thread::sleep_for;
+  using std::chrono::milliseconds;
+
+  auto const num_blocks = static_cast<std::size_t>(state.range(0));
+  auto const blocks     = GenerateMinedBlocks(num_blocks);
+  auto const head       = blocks.back()->body.hash;
+
+  // create the node that is serving the blocks
+  SyncNode source{SyncNode::Mode::STANDALONE};
+  for (std::size_t i = 1; i < blocks.size(); ++i)
+  {
+    source.chain.AddBlock(*blocks[i]);
+  }
+  source.muddle.Start({SOURCE_PORT});
+
+  std::size_t total_blocks{0};
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+
+    // create the node that will be catching up and wait for it to connect to the source
+    SyncNode sync{SyncNode::Mode::PRIVATE_NETWORK};
+    sync.muddle.Start({}, {Muddle::Uri{"tcp://127.0.0.1:" + std::to_string(SOURCE_PORT)}});
+
+    while (sync.muddle.AsEndpoint().GetDirectlyConnectedPeers().empty())
+    {
+      sleep_for(milliseconds{10});
+    }
+
+    Reactor reactor{"Reactor"};
+    reactor.Attach(sync.service->GetWeakRunnable());
+
+    state.ResumeTiming();
+
+    reactor.Start();
+
+    // wait for the node to have completely synced the chain
+    while (sync.chain.GetHeaviestBlockHash() != head)
+    {
+      sleep_for(milliseconds{1});
+    }
+
+    state.PauseTiming();
+    reactor.Stop();
+    total_blocks += num_blocks;
+    state.ResumeTiming();
+  }
+
+  state.counters["blocks_per_sec"] =
+      benchmark::Counter(static_cast<double>(total_blocks), benchmark::Counter::kIsRate);
+}
+
+}  // namespace
+
+BENCHMARK(MainChainRpc_CatchUpFromLocalPeer)
+    ->Arg(1000)
+    ->Arg(10000)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
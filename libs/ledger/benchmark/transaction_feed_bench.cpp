@@ -0,0 +1,146 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/reactor.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_rpc_serializers.hpp"
+#include "ledger/shard_config.hpp"
+#include "ledger/storage_unit/transaction_feed.hpp"
+#include "network/management/network_manager.hpp"
+#include "network/muddle/muddle.hpp"
+#include "storage/resource_mapper.hpp"
+#include "storage/transient_object_store.hpp"
+#include "tx_generation.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <thread>
+
+namespace {
+
+using fetch::core::Reactor;
+using fetch::ledger::ShardConfig;
+using fetch::ledger::ShardConfigs;
+using fetch::ledger::TransactionFeedPublisher;
+using fetch::ledger::TransactionFeedSubscriber;
+using fetch::muddle::Muddle;
+using fetch::muddle::NetworkId;
+using fetch::network::NetworkManager;
+using fetch::storage::ResourceID;
+
+using TxStore = fetch::storage::TransientObjectStore<Transaction>;
+using Counter = std::atomic<std::size_t>;
+
+constexpr uint16_t LANE_PORT = 8140;
+
+Muddle::CertificatePtr CreateIdentity()
+{
+  auto signer = std::make_shared<ECDSASigner>();
+  signer->GenerateKeys();
+  return signer;
+}
+
+/**
+ * Stream transactions seen by a (single) lane to the node over the loopback interface. Each
+ * iteration submits a burst of transactions to the lane store and waits until all of them have
+ * been delivered to the miner side handler, i.e. the iteration time is the submit-to-queue latency
+ * of the last transaction of the burst.
+ */
+void TransactionFeed_SubmitToQueueLatency(benchmark::State &state)
+{
+  using std::this_thread::sleep_for;
+  using std::chrono::milliseconds;
+
+  auto const burst_size = static_cast<std::size_t>(state.range(0));
+
+  NetworkManager manager{"NetMgr", 2};
+  manager.Start();
+
+  // the lane
+  auto const lane_identity = CreateIdentity();
+  Muddle     lane_muddle{NetworkId{"Feed"}, lane_identity, manager};
+  TxStore    store{0};
+  store.New("transaction_feed_bench.db", "transaction_feed_bench_index.db", true);
+
+  TransactionFeedPublisher publisher{lane_muddle.AsEndpoint(), store};
+  Reactor                  reactor{"Reactor"};
+  reactor.Attach(publisher.GetWeakRunnable());
+  reactor.Start();
+
+  lane_muddle.Start({LANE_PORT});
+
+  // the node
+  ShardConfigs shards(1);
+  shards[0].internal_identity = lane_identity;
+
+  Muddle node_muddle{NetworkId{"Feed"}, CreateIdentity(), manager};
+  node_muddle.Start({}, {Muddle::Uri{"tcp://127.0.0.1:" + std::to_string(LANE_PORT)}});
+
+  while (node_muddle.AsEndpoint().GetDirectlyConnectedPeers().empty())
+  {
+    sleep_for(milliseconds{10});
+  }
+
+  Counter                   received{0};
+  TransactionFeedSubscriber feed{node_muddle.AsEndpoint(), shards};
+  feed.SetHandler([&received](TransactionFeedSubscriber::TxLayouts const &layouts) {
+    received += layouts.size();
+  });
+  feed.Refresh();
+
+  ECDSASigner signer{};
+  std::size_t expected{0};
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    auto const txs = GenerateTransactions(burst_size, signer);
+    state.ResumeTiming();
+
+    for (auto const &tx : txs)
+    {
+      store.Set(ResourceID{tx->digest()}, *tx, true);
+    }
+
+    expected += burst_size;
+    while (received < expected)
+    {
+      std::this_thread::yield();
+    }
+  }
+
+  state.SetItemsProcessed(static_cast<int64_t>(expected));
+
+  reactor.Stop();
+  node_muddle.Stop();
+  lane_muddle.Stop();
+  manager.Stop();
+}
+
+}  // namespace
+
+BENCHMARK(TransactionFeed_SubmitToQueueLatency)
+    ->Arg(1)
+    ->Arg(100)
+    ->Arg(1000)
+    ->Unit(benchmark::kMicrosecond)
+    ->UseRealTime();
@@ -70,7 +70,7 @@ public:
 void TransactionVerifierBench(benchmark::State &state)
 {
   //  std::cout << "Tx Verification - threads: " << state.range(0) << " num txs: " << state.range(1)
-  //  << std::endl;
+  //  << " batch size: " << state.range(2) << std::endl;
 
   // generate the transactions
   ECDSASigner signer;
@@ -84,7 +84,9 @@ void TransactionVerifierBench(benchmark::State &state)
     DummySink sink{txs.size()};
 
     // needs to be created on the heap because of memory use
-    auto verifier = std::make_unique<TransactionVerifier>(sink, state.range(0), "Verifier");
+    auto verifier = std::make_unique<TransactionVerifier>(
+        sink, static_cast<std::size_t>(state.range(0)), "Verifier",
+        static_cast<std::size_t>(state.range(2)));
 
     // front load the verifier
     for (auto const &tx : txs)
@@ -107,14 +109,18 @@ void CreateRanges(benchmark::internal::Benchmark *b)
 {
   int const max_threads = static_cast<int>(std::thread::hardware_concurrency());
 
-  for (int i = 1; i <= max_threads; ++i)
+  // compare the one-at-a-time verification path (batch size of 1) against the batched one
+  for (int batch_size : {1, 64})
   {
-    b->Args({i, 1});
-    b->Args({i, 10});
-    b->Args({i, 100});
-    b->Args({i, 1000});
-    b->Args({i, 10000});
-    b->Args({i, 100000});
+    for (int i = 1; i <= max_threads; ++i)
+    {
+      b->Args({i, 1, batch_size});
+      b->Args({i, 10, batch_size});
+      b->Args({i, 100, batch_size});
+      b->Args({i, 1000, batch_size});
+      b->Args({i, 10000, batch_size});
+      b->Args({i, 100000, batch_size});
+    }
   }
 }
 
@@ -19,13 +19,25 @@
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/const_byte_array.hpp"
 #include "core/random/lcg.hpp"
+#include "core/service_ids.hpp"
 #include "crypto/ecdsa.hpp"
 #include "ledger/chain/transaction_builder.hpp"
 #include "ledger/chain/transaction_rpc_serializers.hpp"
+#include "ledger/shard_config.hpp"
 #include "ledger/storage_unit/lane_service.hpp"
+#include "ledger/storage_unit/storage_unit_client.hpp"
+#include "network/management/network_manager.hpp"
+#include "network/muddle/muddle.hpp"
+#include "network/muddle/rpc/server.hpp"
+#include "storage/object_store_protocol.hpp"
 #include "storage/transient_object_store.hpp"
 
 #include <benchmark/benchmark.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
 #include <vector>
 
 namespace {
@@ -37,10 +49,17 @@ using fetch::ledger::TransactionBuilder;
 using fetch::ledger::Address;
 using fetch::crypto::ECDSASigner;
 using fetch::random::LinearCongruentialGenerator;
+using fetch::ledger::ShardConfigs;
+using fetch::ledger::StorageUnitClient;
+using fetch::muddle::Muddle;
+using fetch::muddle::NetworkId;
+using fetch::network::NetworkManager;
 
 using TransientStore   = fetch::storage::TransientObjectStore<Transaction>;
 using TransactionStore = fetch::storage::ObjectStore<Transaction>;
 using TransactionList  = std::vector<TransactionBuilder::TransactionPtr>;
+using TxStoreProtocol  = fetch::storage::ObjectStoreProtocol<Transaction>;
+using RpcServer        = fetch::muddle::rpc::Server;
 
 static constexpr uint32_t LOG2_NUM_LANES = 2;
 
@@ -210,8 +229,117 @@ void TransientStoreExpectedOperation(benchmark::State &state)
   }
 }
 
+/**
+ * A single lane transaction store served over the loopback interface, along with the storage unit
+ * client which the node uses to submit transactions to it
+ */
+class LoopbackLane
+{
+public:
+  explicit LoopbackLane(uint16_t port)
+  {
+    manager_.Start();
+
+    // the lane
+    auto lane_identity = std::make_shared<ECDSASigner>();
+    lane_identity->GenerateKeys();
+
+    lane_muddle_ = std::make_unique<Muddle>(NetworkId{"Subm"}, lane_identity, manager_);
+    store_.New("tx_submission_lane.db", "tx_submission_lane_index.db", true);
+
+    server_ = std::make_unique<RpcServer>(lane_muddle_->AsEndpoint(), fetch::SERVICE_LANE_CTRL,
+                                          fetch::CHANNEL_RPC);
+    server_->Add(fetch::RPC_TX_STORE, &protocol_);
+
+    lane_muddle_->Start({port});
+
+    // the node
+    auto node_identity = std::make_shared<ECDSASigner>();
+    node_identity->GenerateKeys();
+
+    ShardConfigs shards(1);
+    shards[0].internal_identity = lane_identity;
+
+    node_muddle_ = std::make_unique<Muddle>(NetworkId{"Subm"}, node_identity, manager_);
+    node_muddle_->Start({}, {Muddle::Uri{"tcp://127.0.0.1:" + std::to_string(port)}});
+
+    while (node_muddle_->AsEndpoint().GetDirectlyConnectedPeers().empty())
+    {
+      std::this_thread::sleep_for(std::chrono::milliseconds{10});
+    }
+
+    client_ = std::make_unique<StorageUnitClient>(node_muddle_->AsEndpoint(), shards, 0);
+  }
+
+  ~LoopbackLane()
+  {
+    client_.reset();
+    node_muddle_->Stop();
+    lane_muddle_->Stop();
+    server_.reset();
+    manager_.Stop();
+  }
+
+  StorageUnitClient &client()
+  {
+    return *client_;
+  }
+
+private:
+  NetworkManager                     manager_{"NetMgr", 2};
+  TransientStore                     store_{0};
+  TxStoreProtocol                    protocol_{&store_};
+  std::unique_ptr<Muddle>            lane_muddle_;
+  std::unique_ptr<RpcServer>         server_;
+  std::unique_ptr<Muddle>            node_muddle_;
+  std::unique_ptr<StorageUnitClient> client_;
+};
+
+void TxSubmitToLaneSingle(benchmark::State &state)
+{
+  LoopbackLane lane{8150};
+
+  auto const batch_size = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    TransactionList transactions = GenerateTransactions(batch_size, false);
+    state.ResumeTiming();
+
+    // one request per transaction
+    for (auto const &tx : transactions)
+    {
+      lane.client().AddTransaction(*tx);
+    }
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+void TxSubmitToLaneBatched(benchmark::State &state)
+{
+  LoopbackLane lane{8151};
+
+  auto const batch_size = static_cast<std::size_t>(state.range(0));
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    TransactionList transactions = GenerateTransactions(batch_size, false);
+    state.ResumeTiming();
+
+    // one request per lane
+    lane.client().AddTransactions(transactions);
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
 }  // namespace
 
+BENCHMARK(TxSubmitToLaneSingle)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
+BENCHMARK(TxSubmitToLaneBatched)->Arg(100)->Arg(1000)->Unit(benchmark::kMillisecond)->UseRealTime();
 BENCHMARK(TransientStoreExpectedOperation)->Range(10, 1000000);
 BENCHMARK(TxSubmitSingleSmallAlt);
 BENCHMARK(TxSubmitFixedLarge);
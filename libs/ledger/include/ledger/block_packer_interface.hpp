@@ -17,14 +17,16 @@
 //
 //------------------------------------------------------------------------------
 
+#include "ledger/chain/transaction_layout.hpp"
+
 #include <cstddef>
 #include <cstdint>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
 
 class Transaction;
-class TransactionLayout;
 class Block;
 class MainChain;
 
@@ -34,6 +36,8 @@ class MainChain;
 class BlockPackerInterface
 {
 public:
+  using TransactionLayouts = std::vector<TransactionLayout>;
+
   // Construction / Destruction
   BlockPackerInterface()          = default;
   virtual ~BlockPackerInterface() = default;
@@ -58,6 +62,22 @@ public:
    */
   virtual void EnqueueTransaction(TransactionLayout const &layout) = 0;
 
+  /**
+   * Add a series of transaction layouts to the internal queue
+   *
+   * The default implementation simply makes an EnqueueTransaction call for each of the layouts,
+   * packers which can amortise the cost of queuing across a batch should override it.
+   *
+   * @param layouts The layouts to be added to the queue
+   */
+  virtual void EnqueueTransactions(TransactionLayouts const &layouts)
+  {
+    for (auto const &layout : layouts)
+    {
+      EnqueueTransaction(layout);
+    }
+  }
+
   /**
    * Generate a new block based on the current queue of transactions
    *
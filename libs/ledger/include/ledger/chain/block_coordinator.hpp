@@ -314,11 +314,15 @@ void BlockCoordinator::SetBlockPeriod(std::chrono::duration<R, P> const &period)
 
   // signal that we are mining
   mining_ = true;
+  state_machine_->Notify();
 }
 
 inline void BlockCoordinator::EnableMining(bool enable)
 {
-  mining_enabled_ = enable;
+  if (mining_enabled_.exchange(enable) != enable)
+  {
+    state_machine_->Notify();
+  }
 }
 
 }  // namespace ledger
@@ -0,0 +1,67 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/digest.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Fixed size Bloom filter over digests
+ *
+ * Digests are (cryptographic) hashes so the bit positions are taken directly from the leading bytes
+ * of the digest using double hashing. A match means that the digest has probably been added, a
+ * miss means that it has definitely not been added.
+ */
+class DigestBloomFilter
+{
+public:
+  static constexpr std::size_t DEFAULT_LOG2_SIZE = 26;  ///< 64 Mbit (8 MiB) of filter
+  static constexpr std::size_t NUM_HASHES        = 4;
+
+  // Construction / Destruction
+  explicit DigestBloomFilter(std::size_t log2_size = DEFAULT_LOG2_SIZE);
+  DigestBloomFilter(DigestBloomFilter const &) = default;
+  DigestBloomFilter(DigestBloomFilter &&)      = default;
+  ~DigestBloomFilter()                         = default;
+
+  void Add(Digest const &digest);
+  bool Match(Digest const &digest) const;
+  void Reset();
+
+  // Operators
+  DigestBloomFilter &operator=(DigestBloomFilter const &) = default;
+  DigestBloomFilter &operator=(DigestBloomFilter &&) = default;
+
+private:
+  using Words = std::vector<uint64_t>;
+
+  template <typename Visitor>
+  void VisitBits(Digest const &digest, Visitor &&visitor) const;
+
+  Words    bits_;
+  uint64_t mask_;
+};
+
+}  // namespace ledger
+}  // namespace fetch
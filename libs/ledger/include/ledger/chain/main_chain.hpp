@@ -25,16 +25,20 @@
 #include "ledger/chain/consensus/proof_of_work.hpp"
 #include "ledger/chain/constants.hpp"
 #include "ledger/chain/digest.hpp"
+#include "ledger/chain/digest_bloom_filter.hpp"
 #include "ledger/chain/transaction_layout.hpp"
 #include "network/generics/milli_timer.hpp"
 #include "storage/object_store.hpp"
 #include "storage/resource_mapper.hpp"
 
 #include <fstream>
+#include <functional>
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <unordered_set>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -75,15 +79,27 @@ char const *ToString(BlockStatus status);
 class MainChain
 {
 public:
-  using BlockPtr             = std::shared_ptr<Block const>;
-  using Blocks               = std::vector<BlockPtr>;
-  using BlockHash            = Digest;
-  using BlockHashs           = std::vector<BlockHash>;
-  using BlockHashSet         = std::unordered_set<BlockHash>;
-  using TransactionLayoutSet = std::unordered_set<TransactionLayout>;
+  using BlockPtr              = std::shared_ptr<Block const>;
+  using Blocks                = std::vector<BlockPtr>;
+  using BlockHash             = Digest;
+  using BlockHashs            = std::vector<BlockHash>;
+  using BlockHashSet          = std::unordered_set<BlockHash>;
+  using TransactionLayoutSet  = std::unordered_set<TransactionLayout>;
+  using HeaviestChainCallback = std::function<void()>;
 
-  static constexpr char const *LOGGING_NAME = "MainChain";
-  static constexpr uint64_t    UPPER_BOUND  = 100000ull;
+  static constexpr char const *LOGGING_NAME            = "MainChain";
+  static constexpr uint64_t    UPPER_BOUND             = 100000ull;
+  static constexpr std::size_t CHAIN_VIEW_DEPTH        = 500;
+  static constexpr std::size_t CHAIN_VIEW_LOOKUP_DEPTH = 128;
+
+  /**
+   * Record of a (non-loose) block in which a given transaction has been included
+   */
+  struct TransactionRecord
+  {
+    uint64_t  block_number{0};
+    BlockHash block_hash;
+  };
 
   enum class Mode
   {
@@ -119,6 +135,7 @@ public:
   BlockPtr  GetHeaviestBlock() const;
   BlockHash GetHeaviestBlockHash() const;
   Blocks    GetHeaviestChain(uint64_t limit = UPPER_BOUND) const;
+  Blocks    GetHeaviestChainRange(uint64_t start, uint64_t end) const;
   Blocks    GetChainPreceding(BlockHash at, uint64_t limit = UPPER_BOUND) const;
   bool      GetPathToCommonAncestor(
            Blocks &blocks, BlockHash tip, BlockHash node, uint64_t limit = UPPER_BOUND,
@@ -140,8 +157,14 @@ public:
 
   /// @name Transaction Duplication Filtering
   /// @{
-  DigestSet DetectDuplicateTransactions(BlockHash        starting_hash,
-                                        DigestSet const &transactions) const;
+  DigestSet   DetectDuplicateTransactions(BlockHash        starting_hash,
+                                          DigestSet const &transactions) const;
+  std::size_t GetTransactionIndexSize() const;  // testing only
+  /// @}
+
+  /// @name Notifications
+  /// @{
+  void OnHeaviestChainUpdate(HeaviestChainCallback cb);
   /// @}
 
   // Operators
@@ -160,6 +183,29 @@ private:
   using RMutex        = std::recursive_mutex;
   using RLock         = std::unique_lock<RMutex>;
 
+  using TransactionIndex    = std::unordered_multimap<Digest, TransactionRecord, DigestHashAdapter>;
+  using TransactionStore    = fetch::storage::ObjectStore<TransactionRecord>;
+  using TransactionStorePtr = std::unique_ptr<TransactionStore>;
+  using DigestFilterPtr     = std::unique_ptr<DigestBloomFilter>;
+  using HeaviestChainIndex  = std::vector<BlockHash>;
+
+  /**
+   * Link in the published view of the most recent section of the heaviest chain. A new view is
+   * published every time the heaviest chain changes so that readers can access it without taking
+   * the chain lock. Links are never modified once published, so successive views share all of the
+   * links which they have in common
+   */
+  struct ChainLink
+  {
+    using ChainLinkPtr = std::shared_ptr<ChainLink const>;
+
+    BlockPtr     block;     ///< The block at this point in the chain
+    ChainLinkPtr previous;  ///< The link to the previous block (empty at the end of the view)
+    std::size_t  length;    ///< The number of links in the view, starting from this one
+  };
+
+  using ChainLinkPtr = ChainLink::ChainLinkPtr;
+
   struct HeaviestTip
   {
     uint64_t  weight{0};
@@ -199,6 +245,24 @@ private:
   bool DetermineHeaviestTip();
   /// @}
 
+  /// @name Transaction Index
+  /// @{
+  void IndexTransactions(Block const &block);
+  void RemoveIndexedTransactions(Block const &block);
+  void PersistIndexedTransactions(Block const &block);
+  void FilterStoredTransactions(Block const &block);
+  bool UpdateHeaviestChainIndex();
+  bool IsOnHeaviestChain(uint64_t block_number, BlockHash const &hash) const;
+  /// @}
+
+  /// @name Heaviest Chain View
+  /// @{
+  void         PublishHeaviestChainView();
+  ChainLinkPtr GetHeaviestChainView() const;
+  ChainLinkPtr LookupHeaviestChainView(BlockHash const &hash) const;
+  BlockPtr     GetStoredBlock(BlockHash hash) const;
+  /// @}
+
   static IntBlockPtr CreateGenesisBlock();
 
   BlockHash GetHeadHash();
@@ -212,7 +276,28 @@ private:
   TipsMap          tips_;          ///< Keep track of the tips
   HeaviestTip      heaviest_;      ///< Heaviest block/tip
   LooseBlockMap    loose_blocks_;  ///< Waiting (loose) blocks
+
+  TransactionIndex    tx_index_;        ///< Map of tx digest to the cached block(s) including it
+  TransactionStorePtr tx_store_;        ///< Map of tx digest to the stored block including it
+  DigestFilterPtr     tx_filter_;       ///< Filter of the tx digests in the stored index
+  HeaviestChainIndex  heaviest_chain_;  ///< Block hashes of the heaviest chain indexed by height
+
+  ChainLinkPtr chain_view_;  ///< Published view (only accessed with atomic load / store)
+
+  HeaviestChainCallback heaviest_chain_callback_;  ///< Called when the heaviest chain changes
 };
 
+template <typename T>
+void Serialize(T &serializer, MainChain::TransactionRecord const &record)
+{
+  serializer << record.block_number << record.block_hash;
+}
+
+template <typename T>
+void Deserialize(T &serializer, MainChain::TransactionRecord &record)
+{
+  serializer >> record.block_number >> record.block_hash;
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -20,10 +20,12 @@
 #include "core/bitvector.hpp"
 #include "core/byte_array/const_byte_array.hpp"
 #include "crypto/identity.hpp"
+#include "crypto/verifier.hpp"
 #include "ledger/chain/address.hpp"
 #include "ledger/chain/digest.hpp"
 
 #include <cstdint>
+#include <functional>
 #include <vector>
 
 namespace fetch {
@@ -81,8 +83,9 @@ public:
     INVALID,  ///< The transaction is invalid and should be dropped
   };
 
-  using Transfers   = std::vector<Transfer>;
-  using Signatories = std::vector<Signatory>;
+  using Transfers      = std::vector<Transfer>;
+  using Signatories    = std::vector<Signatory>;
+  using VerifierLookup = std::function<crypto::Verifier &(Identity const &)>;
 
   // Construction / Destruction
   Transaction()                    = default;
@@ -130,6 +133,7 @@ public:
   /// @name Validation / Verification
   /// @{
   bool Verify();
+  bool Verify(VerifierLookup const &lookup);
   bool IsVerified() const;
   bool IsSignedByFromAddress() const;
   /// @}
@@ -33,8 +33,13 @@ namespace ledger {
 class ChainCodeCache
 {
 public:
-  using ContractPtr = ChainCodeFactory::ContractPtr;
-  using StoragePtr  = ledger::StorageInterface;
+  using ContractPtr        = ChainCodeFactory::ContractPtr;
+  using StoragePtr         = ledger::StorageInterface;
+  using ExecutableCachePtr = ChainCodeFactory::ExecutableCachePtr;
+
+  // Construction / Destruction
+  explicit ChainCodeCache(ExecutableCachePtr executable_cache = {});
+  ~ChainCodeCache() = default;
 
   ContractPtr Lookup(Identifier const &contract_id, StorageInterface &storage);
 
@@ -66,7 +71,7 @@ private:
   ContractPtr FindInCache(Identifier const &name);
   void        RunMaintenance();
 
-  std::size_t      counter_;
+  std::size_t      counter_{0};
   UnderlyingCache  cache_;
   ChainCodeFactory factory_;
 
@@ -0,0 +1,102 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "storage/object_store.hpp"
+#include "vm/executable_serializer.hpp"
+#include "vm/generator.hpp"
+
+#include <atomic>
+#include <cstdint>
+#include <string>
+
+namespace fetch {
+namespace ledger {
+
+/**
+ * Persistent store of compiled smart contract executables, indexed by the digest of the contract
+ * source. This allows contracts to be loaded with a single deserialization rather than a full
+ * compilation when they are evicted from memory or the node is restarted.
+ *
+ * Each entry is tagged with the opcode table version of the VM which generated it. Entries with a
+ * mismatching version are treated as misses and will be replaced when the contract is recompiled.
+ */
+class CompiledContractCache
+{
+public:
+  using ConstByteArray = byte_array::ConstByteArray;
+  using Executable     = vm::Executable;
+
+  struct Entry
+  {
+    uint64_t   version{0};    ///< The opcode table version of the generating VM
+    Executable executable{};  ///< The compiled executable
+  };
+
+  struct Statistics
+  {
+    uint64_t hits{0};    ///< The number of executables loaded from the cache
+    uint64_t misses{0};  ///< The number of lookups which were not present in the cache
+    uint64_t stale{0};   ///< The number of entries rejected due to a version mismatch
+  };
+
+  static constexpr char const *LOGGING_NAME = "CompiledContractCache";
+
+  // Construction / Destruction
+  CompiledContractCache()                              = default;
+  CompiledContractCache(CompiledContractCache const &) = delete;
+  CompiledContractCache(CompiledContractCache &&)      = delete;
+  ~CompiledContractCache()                             = default;
+
+  void New(std::string const &prefix);
+  void Load(std::string const &prefix);
+
+  bool Get(ConstByteArray const &digest, uint64_t version, Executable &executable);
+  void Set(ConstByteArray const &digest, uint64_t version, Executable const &executable);
+
+  Statistics GetStatistics() const;
+
+  // Operators
+  CompiledContractCache &operator=(CompiledContractCache const &) = delete;
+  CompiledContractCache &operator=(CompiledContractCache &&) = delete;
+
+private:
+  using Store   = storage::ObjectStore<Entry>;
+  using Counter = std::atomic<uint64_t>;
+
+  Store   store_;
+  Counter hits_{0};
+  Counter misses_{0};
+  Counter stale_{0};
+};
+
+template <typename T>
+void Serialize(T &serializer, CompiledContractCache::Entry const &entry)
+{
+  serializer << entry.version << entry.executable;
+}
+
+template <typename T>
+void Deserialize(T &serializer, CompiledContractCache::Entry &entry)
+{
+  serializer >> entry.version >> entry.executable;
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -0,0 +1,108 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "vm/generator.hpp"
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+class CompiledContractCache;
+
+/**
+ * Process-wide cache of compiled smart contract executables, indexed by the digest of the
+ * contract source and shared between all the executors.
+ *
+ * Cached executables are immutable and are handed out as shared pointers so that any number of
+ * contract instances can run the same executable concurrently. The cache is split into a number of
+ * independently locked shards. Each shard is bounded by the estimated size in bytes of its
+ * entries and follows the W-TinyLFU policy: new entries are placed in a small LRU window and when
+ * they leave the window they are only admitted to the main segmented LRU if they have been
+ * accessed more often than the entry which would be evicted to make room for them. Access
+ * frequencies are tracked by a compact count-min sketch which is periodically aged.
+ *
+ * An optional persistent cache can be provided which is consulted on a miss and populated with
+ * every newly compiled executable.
+ */
+class ExecutableCache
+{
+public:
+  using ConstByteArray           = byte_array::ConstByteArray;
+  using Executable               = vm::Executable;
+  using ExecutablePtr            = std::shared_ptr<Executable const>;
+  using CompiledContractCachePtr = std::shared_ptr<CompiledContractCache>;
+
+  struct Statistics
+  {
+    uint64_t hits{0};            ///< The number of lookups served from memory
+    uint64_t misses{0};          ///< The number of lookups not present in memory
+    uint64_t loaded{0};          ///< The number of misses served by the persistent cache
+    uint64_t admitted{0};        ///< The number of entries admitted to the main segment
+    uint64_t rejected{0};        ///< The number of entries refused by the admission policy
+    uint64_t evicted{0};         ///< The number of entries evicted from the main segment
+    uint64_t entries{0};         ///< The number of entries currently held
+    uint64_t size_bytes{0};      ///< The estimated size of the entries currently held
+    uint64_t capacity_bytes{0};  ///< The configured capacity of the cache
+    double   hit_rate{0.0};      ///< The fraction of lookups served from memory
+  };
+
+  static constexpr std::size_t DEFAULT_CAPACITY_BYTES  = 64u * 1024u * 1024u;
+  static constexpr std::size_t DEFAULT_LOG2_NUM_SHARDS = 4;
+
+  // Construction / Destruction
+  explicit ExecutableCache(std::size_t              capacity_bytes  = DEFAULT_CAPACITY_BYTES,
+                           std::size_t              log2_num_shards = DEFAULT_LOG2_NUM_SHARDS,
+                           CompiledContractCachePtr persistent      = {});
+  ExecutableCache(ExecutableCache const &) = delete;
+  ExecutableCache(ExecutableCache &&)      = delete;
+  ~ExecutableCache();
+
+  ExecutablePtr Get(ConstByteArray const &digest, uint64_t version);
+  ExecutablePtr Set(ConstByteArray const &digest, uint64_t version, Executable executable);
+
+  Statistics GetStatistics() const;
+
+  static std::size_t EstimateSize(Executable const &executable);
+
+  // Operators
+  ExecutableCache &operator=(ExecutableCache const &) = delete;
+  ExecutableCache &operator=(ExecutableCache &&) = delete;
+
+private:
+  class Shard;
+
+  using ShardPtr   = std::unique_ptr<Shard>;
+  using ShardArray = std::vector<ShardPtr>;
+
+  Shard &LookupShard(ConstByteArray const &digest, std::size_t &hash) const;
+
+  std::size_t              capacity_bytes_;
+  ShardArray               shards_;
+  CompiledContractCachePtr persistent_;
+  std::atomic<uint64_t>    loaded_{0};
+};
+
+}  // namespace ledger
+}  // namespace fetch
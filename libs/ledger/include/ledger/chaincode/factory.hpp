@@ -29,17 +29,26 @@ namespace ledger {
 class Identifier;
 class Contract;
 class StorageInterface;
+class ExecutableCache;
 
 class ChainCodeFactory
 {
 public:
-  using ConstByteArray  = byte_array::ConstByteArray;
-  using ContractPtr     = std::shared_ptr<Contract>;
-  using ContractNameSet = std::unordered_set<ConstByteArray>;
+  using ConstByteArray     = byte_array::ConstByteArray;
+  using ContractPtr        = std::shared_ptr<Contract>;
+  using ContractNameSet    = std::unordered_set<ConstByteArray>;
+  using ExecutableCachePtr = std::shared_ptr<ExecutableCache>;
+
+  // Construction / Destruction
+  explicit ChainCodeFactory(ExecutableCachePtr executable_cache = {});
+  ~ChainCodeFactory() = default;
 
   ContractPtr Create(Identifier const &name, StorageInterface &storage) const;
 
   ContractNameSet const &GetChainCodeContracts() const;
+
+private:
+  ExecutableCachePtr executable_cache_;  ///< Optional shared cache of compiled contracts
 };
 
 }  // namespace ledger
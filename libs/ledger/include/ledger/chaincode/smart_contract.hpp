@@ -19,6 +19,7 @@
 
 #include "crypto/fnv.hpp"  // needed for std::hash<ConstByteArray> !!!
 #include "ledger/chaincode/contract.hpp"
+#include "vm/vm_pool.hpp"
 
 #include <memory>
 #include <string>
@@ -33,6 +34,7 @@ class Module;
 namespace ledger {
 
 class Address;
+class ExecutableCache;
 
 /**
  * Smart Contract instance.
@@ -44,12 +46,12 @@ class SmartContract : public Contract
 public:
   using ConstByteArray = byte_array::ConstByteArray;
   using Executable     = fetch::vm::Executable;
-  using ExecutablePtr  = std::shared_ptr<Executable>;
+  using ExecutablePtr  = std::shared_ptr<Executable const>;
 
   static constexpr char const *LOGGING_NAME = "SmartContract";
 
   // Construction / Destruction
-  explicit SmartContract(std::string const &source);
+  explicit SmartContract(std::string const &source, ExecutableCache *executable_cache = nullptr);
   ~SmartContract() override = default;
 
   ConstByteArray contract_digest() const
@@ -75,6 +77,7 @@ private:
   ConstByteArray digest_;         ///< The digest of the current contract
   ExecutablePtr  executable_;     ///< The internal script object of the parsed source
   ModulePtr      module_;         ///< The internal module instance for the contract
+  vm::VMPool     vm_pool_;        ///< The reusable VM instances bound to the module
   std::string    init_fn_name_;
 };
 
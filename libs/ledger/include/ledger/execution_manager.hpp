@@ -25,7 +25,6 @@
 #include "ledger/execution_manager_interface.hpp"
 #include "ledger/executor.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
-#include "network/details/thread_pool.hpp"
 #include "storage/object_store.hpp"
 
 #include "core/byte_array/encoders.hpp"
@@ -33,6 +32,7 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <deque>
 #include <future>
 #include <memory>
 #include <thread>
@@ -87,12 +87,11 @@ private:
   using ExecutionItemPtr  = std::unique_ptr<ExecutionItem>;
   using ExecutionItemList = std::vector<ExecutionItemPtr>;
   using ExecutionPlan     = std::vector<ExecutionItemList>;
-  using ThreadPool        = fetch::network::ThreadPool;
+  using WorkQueue         = std::deque<ExecutionItem *>;
   using Mutex             = std::mutex;
   using Counter           = std::atomic<std::size_t>;
   using Flag              = std::atomic<bool>;
   using StateHash         = StorageUnitInterface::Hash;
-  using ExecutorList      = std::vector<ExecutorPtr>;
   using StateHashCache    = storage::ObjectStore<StateHash>;
   using ThreadPtr         = std::unique_ptr<std::thread>;
   using BlockSliceList    = ledger::Block::Slices;
@@ -102,6 +101,25 @@ private:
   using SyncCounters      = SynchronisedState<Counters>;
   using SyncedState       = SynchronisedState<State>;
 
+  /**
+   * Each worker thread owns a single executor and a local queue of execution items. Idle workers
+   * will steal items from the back of the queues of other workers.
+   */
+  struct Worker
+  {
+    explicit Worker(ExecutorPtr e)
+      : executor(std::move(e))
+    {}
+
+    ExecutorPtr executor;  ///< The executor pinned to this worker
+    Mutex       lock;      ///< guards `queue`
+    WorkQueue   queue;     ///< The local queue of items for this worker
+    ThreadPtr   thread;    ///< The worker thread
+  };
+
+  using WorkerPtr  = std::unique_ptr<Worker>;
+  using WorkerList = std::vector<WorkerPtr>;
+
   uint32_t const log2_num_lanes_;
 
   Flag running_{false};
@@ -121,21 +139,27 @@ private:
   Condition monitor_wake_;
   Condition monitor_notify_;
 
-  Mutex        idle_executors_lock_;  ///< guards `idle_executors`
-  ExecutorList idle_executors_;
+  WorkerList workers_;
+
+  Mutex     work_lock_;       ///< guards the signalling of `work_available_`
+  Condition work_available_;  ///< Signalled when a new slice has been scheduled
+  Counter   pending_items_{0};
 
   Counter completed_executions_{0};
   Counter num_slices_{0};
 
   SyncCounters counters_{};
 
-  ThreadPool thread_pool_;
-  ThreadPtr  monitor_thread_;
+  ThreadPtr monitor_thread_;
 
   void MonitorThreadEntrypoint();
+  void WorkerThreadEntrypoint(std::size_t index);
 
   bool PlanExecution(Block::Body const &block);
-  void DispatchExecution(ExecutionItem &item);
+  void ScheduleSlice(ExecutionItemList const &slice_plan);
+  bool NextItem(std::size_t index, ExecutionItem *&item);
+  void PrefetchNextItem(std::size_t index, ExecutorInterface &executor);
+  void DispatchExecution(ExecutorInterface &executor, ExecutionItem &item);
 };
 
 }  // namespace ledger
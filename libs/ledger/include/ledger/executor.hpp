@@ -17,13 +17,23 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/mutex.hpp"
 #include "crypto/fnv.hpp"
 #include "ledger/chain/block.hpp"
 #include "ledger/chaincode/chain_code_cache.hpp"
 #include "ledger/executor_interface.hpp"
 #include "ledger/storage_unit/storage_unit_interface.hpp"
 
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace fetch {
@@ -40,26 +50,88 @@ class StateSentinelAdapter;
 class Executor : public ExecutorInterface
 {
 public:
-  using StorageUnitPtr = std::shared_ptr<StorageUnitInterface>;
-  using ConstByteArray = byte_array::ConstByteArray;
+  using StorageUnitPtr     = std::shared_ptr<StorageUnitInterface>;
+  using ConstByteArray     = byte_array::ConstByteArray;
+  using ExecutableCachePtr = ChainCodeCache::ExecutableCachePtr;
+
+  struct Statistics
+  {
+    uint64_t hits{0};        ///< The number of state reads served from the cache
+    uint64_t misses{0};      ///< The number of state reads forwarded to the storage engine
+    uint64_t prefetched{0};  ///< The number of state entries fetched ahead of execution
+    uint64_t wasted{0};      ///< The number of prefetched entries which were never read
+  };
+
+  static constexpr std::size_t MAX_LEARNED_KEYS      = 64;
+  static constexpr std::size_t MAX_LEARNED_CONTRACTS = 256;
 
   // Construction / Destruction
-  explicit Executor(StorageUnitPtr storage);
-  ~Executor() override = default;
+  explicit Executor(StorageUnitPtr storage, ExecutableCachePtr executable_cache = {});
+  ~Executor() override;
 
   /// @name Executor Interface
   /// @{
   Result Execute(Digest const &digest, BlockIndex block, SliceIndex slice,
                  BitVector const &shards) override;
   void   SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes) override;
+  void   Prefetch(Digest const &digest, BitVector const &shards) override;
+  /// @}
+
+  Statistics GetStatistics() const;
+
+protected:
+  using Keys      = StorageInterface::Keys;
+  using Documents = StorageInterface::Documents;
+
+  /// @name Learned Contract Keys
+  /// @{
+  void LearnContractKeys(ConstByteArray const &contract, Keys const &keys);
+  bool LookupLearnedKeys(ConstByteArray const &contract, Keys &keys) const;
   /// @}
 
 private:
   using TokenContractPtr        = std::shared_ptr<TokenContract>;
   using TransactionPtr          = std::shared_ptr<Transaction>;
   using CachedStorageAdapterPtr = std::shared_ptr<CachedStorageAdapter>;
+  using LearnedEntry            = std::pair<ConstByteArray, Keys>;
+  using LearnedList             = std::list<LearnedEntry>;
+  using LearnedIndex            = std::unordered_map<ConstByteArray, LearnedList::iterator>;
+  using Counter                 = std::atomic<uint64_t>;
+  using Mutex                   = mutex::Mutex;
+  using PrefetchMutex           = std::mutex;
+  using PrefetchLock            = std::unique_lock<PrefetchMutex>;
+  using Condition               = std::condition_variable;
+  using ThreadPtr               = std::unique_ptr<std::thread>;
+
+  /**
+   * A request for the prefetch worker to retrieve the state of a transaction
+   */
+  struct PrefetchRequest
+  {
+    Digest    digest{};  ///< The transaction digest (empty when there is no request)
+    BitVector shards{};  ///< The shards that the transaction will be permitted to access
+  };
+
+  /**
+   * The state retrieved speculatively for the next transaction to be executed
+   */
+  struct PrefetchResult
+  {
+    Digest         digest{};     ///< The transaction digest (empty when there is no result)
+    TransactionPtr tx{};         ///< The transaction (if it could be retrieved)
+    Keys           keys{};       ///< The resources which were fetched
+    Documents      documents{};  ///< The corresponding documents
+  };
+
+  Keys           ExpectedKeys(Transaction const &tx, BitVector const &shards) const;
+  PrefetchResult PrefetchState(Digest const &digest, BitVector const &shards);
+  void           PrefetchWorker();
+  bool           CollectPrefetch(Digest const &digest, PrefetchResult &result);
+  void           DiscardPrefetch(PrefetchResult &result);
+  void           UpdateStatistics();
 
   bool RetrieveTransaction(Digest const &digest);
+  void PrefetchExpectedState();
   bool ValidationChecks(Result &result);
   bool ExecuteTransactionContract(Result &result);
   bool ProcessTransfers(Result &result);
@@ -69,7 +141,7 @@ private:
   /// @name Resources
   /// @{
   StorageUnitPtr   storage_;             ///< The collection of resources
-  ChainCodeCache   chain_code_cache_{};  //< The factory to create new chain code instances
+  ChainCodeCache   chain_code_cache_;  //< The factory to create new chain code instances
   TokenContractPtr token_contract_;
   /// @}
 
@@ -82,6 +154,29 @@ private:
   TransactionPtr          current_tx_{};
   CachedStorageAdapterPtr storage_cache_;
   /// @}
+
+  /// @name Statistics
+  /// @{
+  Counter hits_{0};
+  Counter misses_{0};
+  Counter prefetched_{0};
+  Counter wasted_{0};
+  /// @}
+
+  /// @name Speculative Prefetching
+  /// @{
+  mutable Mutex   learned_keys_lock_{__LINE__, __FILE__};
+  LearnedList     learned_keys_{};       ///< The keys accessed by each contract (newest first)
+  LearnedIndex    learned_index_{};      ///< Map of contract name to entry in the list
+  PrefetchMutex   prefetch_lock_;        ///< Guards all of the prefetch state below
+  Condition       prefetch_condition_;   ///< Signalled on new requests, results and shutdown
+  PrefetchRequest prefetch_request_{};   ///< The next request for the worker
+  Digest          prefetch_expected_{};  ///< The transaction which is expected to execute next
+  Digest          prefetch_active_{};    ///< The transaction being prefetched by the worker
+  PrefetchResult  prefetch_result_{};    ///< The completed speculation
+  bool            prefetch_stop_{false};
+  ThreadPtr       prefetch_thread_{};    ///< The prefetch worker (started on first use)
+  /// @}
 };
 
 }  // namespace ledger
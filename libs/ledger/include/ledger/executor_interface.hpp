@@ -73,6 +73,16 @@ public:
   virtual Result Execute(Digest const &digest, BlockIndex block, SliceIndex slice,
                          BitVector const &shards)                                              = 0;
   virtual void   SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes) = 0;
+
+  /**
+   * Hint to the executor that the specified transaction is likely to be the next one executed, so
+   * that any preparation can be overlapped with the current execution
+   *
+   * @param digest The digest of the transaction
+   * @param shards The shards that the transaction will be permitted to access
+   */
+  virtual void Prefetch(Digest const & /*digest*/, BitVector const & /*shards*/)
+  {}
   /// @}
 };
 
@@ -22,9 +22,17 @@
 #include "ledger/chain/main_chain.hpp"
 #include "network/service/protocol.hpp"
 
+#include <algorithm>
+#include <cstdint>
+
 namespace fetch {
 namespace ledger {
 
+// The maximum number of blocks served in response to a single request. Clients size their requests
+// to match and the server clamps every request to these limits.
+constexpr uint64_t MAX_SUB_CHAIN_SIZE = 1000;  ///< Limit for chain and sub chain requests
+constexpr uint64_t SYNC_RANGE_SIZE    = 100;   ///< Limit for heaviest chain range requests
+
 class MainChainProtocol : public service::Protocol
 {
 public:
@@ -32,9 +40,10 @@ public:
 
   enum
   {
-    HEAVIEST_CHAIN   = 1,
-    CHAIN_PRECEDING  = 2,
-    COMMON_SUB_CHAIN = 3
+    HEAVIEST_CHAIN       = 1,
+    CHAIN_PRECEDING      = 2,
+    COMMON_SUB_CHAIN     = 3,
+    HEAVIEST_CHAIN_RANGE = 4
   };
 
   explicit MainChainProtocol(MainChain &chain)
@@ -43,19 +52,20 @@ public:
     Expose(HEAVIEST_CHAIN, this, &MainChainProtocol::GetHeaviestChain);
     Expose(CHAIN_PRECEDING, this, &MainChainProtocol::GetChainPreceding);
     Expose(COMMON_SUB_CHAIN, this, &MainChainProtocol::GetCommonSubChain);
+    Expose(HEAVIEST_CHAIN_RANGE, this, &MainChainProtocol::GetHeaviestChainRange);
   }
 
 private:
   Blocks GetHeaviestChain(uint32_t maxsize)
   {
     LOG_STACK_TRACE_POINT;
-    return Copy(chain_.GetHeaviestChain(maxsize));
+    return Copy(chain_.GetHeaviestChain(std::min(uint64_t{maxsize}, MAX_SUB_CHAIN_SIZE)));
   }
 
   Blocks GetChainPreceding(Digest const &at, uint32_t maxsize)
   {
     LOG_STACK_TRACE_POINT;
-    return Copy(chain_.GetChainPreceding(at, maxsize));
+    return Copy(chain_.GetChainPreceding(at, std::min(uint64_t{maxsize}, MAX_SUB_CHAIN_SIZE)));
   }
 
   Blocks GetCommonSubChain(Digest const &start, Digest const &last_seen, uint64_t limit)
@@ -64,6 +74,8 @@ private:
 
     MainChain::Blocks blocks;
 
+    limit = std::min(limit, MAX_SUB_CHAIN_SIZE);
+
     if (!chain_.GetPathToCommonAncestor(blocks, start, last_seen, limit))
     {
       // sanity check
@@ -73,6 +85,19 @@ private:
     return Copy(blocks);
   }
 
+  Blocks GetHeaviestChainRange(uint64_t start, uint64_t end)
+  {
+    LOG_STACK_TRACE_POINT;
+
+    // clamp the range to the maximum number of blocks that will be served for a single request
+    if ((end >= start) && ((end - start) >= SYNC_RANGE_SIZE))
+    {
+      end = start + (SYNC_RANGE_SIZE - 1);
+    }
+
+    return Copy(chain_.GetHeaviestChainRange(start, end));
+  }
+
   static Blocks Copy(MainChain::Blocks const &blocks)
   {
     Blocks output{};
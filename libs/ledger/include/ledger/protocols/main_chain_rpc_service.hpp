@@ -23,6 +23,7 @@
 #include "core/state_machine.hpp"
 #include "ledger/chain/main_chain.hpp"
 #include "ledger/protocols/main_chain_rpc_protocol.hpp"
+#include "network/details/thread_pool.hpp"
 #include "network/generics/backgrounded_work.hpp"
 #include "network/generics/has_worker_thread.hpp"
 #include "network/generics/requesting_queue.hpp"
@@ -31,6 +32,10 @@
 #include "network/muddle/subscription.hpp"
 #include "network/p2pservice/p2ptrust_interface.hpp"
 
+#include <atomic>
+#include <chrono>
+#include <deque>
+#include <map>
 #include <memory>
 
 namespace fetch {
@@ -48,6 +53,7 @@ public:
   {
     REQUEST_HEAVIEST_CHAIN,
     WAIT_FOR_HEAVIEST_CHAIN,
+    CATCHING_UP,
     SYNCHRONISING,
     WAITING_FOR_RESPONSE,
     SYNCHRONISED,
@@ -78,7 +84,7 @@ public:
   MainChainRpcService(MuddleEndpoint &endpoint, MainChain &chain, TrustSystem &trust, Mode mode);
   MainChainRpcService(MainChainRpcService const &) = delete;
   MainChainRpcService(MainChainRpcService &&)      = delete;
-  ~MainChainRpcService() override                  = default;
+  ~MainChainRpcService() override;
 
   core::WeakRunnable GetWeakRunnable()
   {
@@ -110,6 +116,37 @@ private:
   using BlockList       = fetch::ledger::MainChainProtocol::Blocks;
   using StateMachine    = core::StateMachine<State>;
   using StateMachinePtr = std::shared_ptr<StateMachine>;
+  using ThreadPool      = network::ThreadPool;
+  using Clock           = std::chrono::steady_clock;
+  using Timepoint       = Clock::time_point;
+  using Mutex           = mutex::Mutex;
+
+  /**
+   * An outstanding request for a range of blocks from a peer's heaviest chain
+   */
+  struct RangeRequest
+  {
+    Address         peer;
+    uint64_t        start;
+    uint64_t        end;
+    Promise         promise;
+    FutureTimepoint deadline;
+  };
+
+  /**
+   * A range of blocks which has been verified and is waiting to be added to the chain
+   */
+  struct VerifiedRange
+  {
+    Address   peer;
+    uint64_t  end{0};
+    BlockList blocks{};
+    bool      valid{false};
+  };
+
+  using RangeRequests  = std::deque<RangeRequest>;
+  using RetryRanges    = std::deque<std::pair<uint64_t, uint64_t>>;
+  using VerifiedRanges = std::map<uint64_t, VerifiedRange>;
 
   /// @name Subscription Handlers
   /// @{
@@ -124,10 +161,20 @@ private:
   bool               IsBlockValid(Block &block) const;
   /// @}
 
+  /// @name Pipelined Catch Up
+  /// @{
+  void StartCatchUp(uint64_t start, uint64_t target);
+  void IssueRangeRequests();
+  void HandleRangeResponse(RangeRequest const &request, BlockList block_list);
+  void VerifyRange(Address const &peer, uint64_t start, uint64_t end, BlockList block_list);
+  void AddVerifiedRanges();
+  /// @}
+
   /// @name State Machine Handlers
   /// @{
   State OnRequestHeaviestChain();
   State OnWaitForHeaviestChain();
+  State OnCatchingUp();
   State OnSynchronising();
   State OnWaitingForResponse();
   State OnSynchronised(State current, State previous);
@@ -155,6 +202,22 @@ private:
   BlockHash       current_missing_block_;
   Promise         current_request_;
   /// @}
+
+  /// @name Catch Up Data
+  /// @{
+  ThreadPool               verify_pool_;               ///< Workers verifying block ranges
+  uint64_t                 catchup_target_{0};         ///< The last block number to be synced
+  uint64_t                 next_request_height_{0};    ///< The next block number to request
+  uint64_t                 next_insert_height_{0};     ///< The next block number to be added
+  std::size_t              next_peer_index_{0};        ///< Round robin peer selection
+  std::size_t              catchup_blocks_{0};         ///< The number of blocks added
+  Timepoint                catchup_start_{};           ///< The time the catch up started
+  RangeRequests            range_requests_;            ///< The in flight range requests
+  RetryRanges              retry_ranges_;              ///< Ranges which need to be re-requested
+  std::atomic<std::size_t> pending_verifications_{0};  ///< Ranges being verified
+  Mutex                    verified_lock_{__LINE__, __FILE__};
+  VerifiedRanges           verified_ranges_;  ///< Ranges waiting to be added (by start)
+  /// @}
 };
 
 }  // namespace ledger
@@ -21,7 +21,9 @@
 #include "ledger/storage_unit/storage_unit_interface.hpp"
 
 #include <atomic>
+#include <cstdint>
 #include <unordered_map>
+#include <unordered_set>
 
 namespace fetch {
 namespace ledger {
@@ -34,12 +36,25 @@ namespace ledger {
 class CachedStorageAdapter : public StorageInterface
 {
 public:
+  struct Statistics
+  {
+    uint64_t hits{0};        ///< The number of reads served from the cache
+    uint64_t misses{0};      ///< The number of reads forwarded to the storage engine
+    uint64_t prefetched{0};  ///< The number of entries populated ahead of use
+    uint64_t wasted{0};      ///< The number of prefetched entries that were never accessed
+  };
+
   // Construction / Destruction
   explicit CachedStorageAdapter(StorageInterface &storage);
   ~CachedStorageAdapter();
 
   void Flush();
   void Clear();
+  void Prefetch(Keys const &keys);
+  void Populate(Keys const &keys, Documents const &documents);
+
+  Keys       GetCachedKeys() const;
+  Statistics GetStatistics() const;
 
   /// @name State Interface
   /// @{
@@ -55,21 +70,27 @@ private:
   {
     StateValue value{};
     bool       flushed{false};
+    bool       prefetched{false};  ///< Populated ahead of being requested
+    bool       accessed{false};    ///< Has been read since being populated
 
     CacheEntry() = default;
-    explicit CacheEntry(StateValue v)
+    explicit CacheEntry(StateValue v, bool f = false)
       : value{std::move(v)}
+      , flushed{f}
     {}
   };
 
-  using Cache = std::unordered_map<ResourceAddress, CacheEntry>;
-  using Mutex = mutex::Mutex;
+  using Cache  = std::unordered_map<ResourceAddress, CacheEntry>;
+  using KeySet = std::unordered_set<ResourceAddress>;
+  using Mutex  = mutex::Mutex;
 
   /// @name Cache Helpers
   /// @{
   void       AddCacheEntry(ResourceAddress const &address, StateValue const &value);
-  StateValue GetCacheEntry(ResourceAddress const &address) const;
+  StateValue GetCacheEntry(ResourceAddress const &address);
   bool       HasCacheEntry(ResourceAddress const &address) const;
+  bool       IsKnownAbsent(ResourceAddress const &address);
+  void       RecordMiss();
   /// @}
 
   StorageInterface &storage_;  ///< The reference to the underlying storage engine
@@ -78,7 +99,10 @@ private:
   /// @{
   mutable Mutex lock_{__LINE__, __FILE__};
   Cache         cache_{};                ///< The local cache
+  KeySet        absent_{};               ///< Prefetched resources which do not exist
   bool          flush_required_{false};  ///< Top level cache flush flag
+  uint64_t      hits_{0};                ///< The number of reads served from the cache
+  uint64_t      misses_{0};              ///< The number of reads forwarded to the storage engine
   /// @}
 };
 
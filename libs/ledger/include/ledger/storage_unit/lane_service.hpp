@@ -52,6 +52,7 @@ namespace ledger {
 class TxFinderProtocol;
 class TransactionStoreSyncProtocol;
 class TransactionStoreSyncService;
+class TransactionFeedPublisher;
 class LaneIdentityProtocol;
 class LaneController;
 class LaneControllerProtocol;
@@ -118,6 +119,7 @@ private:
   using LaneIdentityPtr           = std::shared_ptr<LaneIdentity>;
   using LaneIdentityProtocolPtr   = std::shared_ptr<LaneIdentityProtocol>;
   using TxFinderProtocolPtr       = std::unique_ptr<TxFinderProtocol>;
+  using TxFeedPublisherPtr        = std::unique_ptr<TransactionFeedPublisher>;
 
   static constexpr unsigned int SYNC_PERIOD_MS = 500;
 
@@ -165,6 +167,7 @@ private:
   TxSyncProtoPtr      tx_sync_protocol_;
   TxSyncServicePtr    tx_sync_service_;
   TxFinderProtocolPtr tx_finder_protocol_;
+  TxFeedPublisherPtr  tx_feed_publisher_;  ///< Streams newly seen transactions to the miner
   /// @}
 };
 
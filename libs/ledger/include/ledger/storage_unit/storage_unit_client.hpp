@@ -68,12 +68,15 @@ public:
   bool      GetTransaction(ConstByteArray const &digest, Transaction &tx) override;
   bool      HasTransaction(ConstByteArray const &digest) override;
   void      IssueCallForMissingTxs(DigestSet const &tx_set) override;
-  TxLayouts PollRecentTx(uint32_t max_to_poll) override;
+  void      AddTransactions(TransactionList const &txs) override;
 
   Document GetOrCreate(ResourceAddress const &key) override;
   Document Get(ResourceAddress const &key) override;
   void     Set(ResourceAddress const &key, StateValue const &value) override;
 
+  Documents GetBatch(Keys const &keys) override;
+  void      SetBatch(KeyValues const &key_values) override;
+
   // state hash functions
   byte_array::ConstByteArray CurrentHash() override;
   byte_array::ConstByteArray LastCommitHash() override;
@@ -146,9 +149,15 @@ private:
 
   static constexpr char const *MERKLE_FILENAME = "merkle_stack.db";
 
+  using LaneKeys    = std::vector<storage::ResourceID>;
+  using LaneIndices = std::vector<std::size_t>;
+
   Address const &LookupAddress(ShardIndex shard) const;
   Address const &LookupAddress(storage::ResourceID const &resource) const;
 
+  void GroupByLane(Keys const &keys, std::vector<LaneKeys> &lane_keys,
+                   std::vector<LaneIndices> &lane_indices) const;
+
   bool HashInStack(Hash const &hash, uint64_t index);
 
   /// @name Client Information
@@ -23,6 +23,8 @@
 #include "storage/document.hpp"
 #include "storage/resource_mapper.hpp"
 
+#include <memory>
+#include <utility>
 #include <vector>
 
 namespace fetch {
@@ -37,6 +39,10 @@ public:
   using ResourceAddress = storage::ResourceAddress;
   using StateValue      = byte_array::ConstByteArray;
   using ShardIndex      = uint32_t;
+  using Keys            = std::vector<ResourceAddress>;
+  using Documents       = std::vector<Document>;
+  using KeyValue        = std::pair<ResourceAddress, StateValue>;
+  using KeyValues       = std::vector<KeyValue>;
 
   // Construction / Destruction
   StorageInterface()          = default;
@@ -50,14 +56,56 @@ public:
   virtual bool     Lock(ShardIndex shard)                                   = 0;
   virtual bool     Unlock(ShardIndex shard)                                 = 0;
   /// @}
+
+  /// @name Batched State Interface
+  /// @{
+  virtual Documents GetBatch(Keys const &keys);
+  virtual void      SetBatch(KeyValues const &key_values);
+  /// @}
 };
 
+/**
+ * Get a series of documents from the storage engine. The default implementation simply makes a
+ * Get call for each of the keys, storage engines for which a call is expensive should override it.
+ *
+ * @param keys The keys to be accessed
+ * @return The documents, in the same order as the keys
+ */
+inline StorageInterface::Documents StorageInterface::GetBatch(Keys const &keys)
+{
+  Documents documents{};
+  documents.reserve(keys.size());
+
+  for (auto const &key : keys)
+  {
+    documents.emplace_back(Get(key));
+  }
+
+  return documents;
+}
+
+/**
+ * Set a series of values on the storage engine. The default implementation simply makes a Set call
+ * for each of the values, storage engines for which a call is expensive should override it.
+ *
+ * @param key_values The keys and values to be set
+ */
+inline void StorageInterface::SetBatch(KeyValues const &key_values)
+{
+  for (auto const &key_value : key_values)
+  {
+    Set(key_value.first, key_value.second);
+  }
+}
+
 class StorageUnitInterface : public StorageInterface
 {
 public:
-  using Hash           = byte_array::ConstByteArray;
-  using ConstByteArray = byte_array::ConstByteArray;
-  using TxLayouts      = std::vector<TransactionLayout>;
+  using Hash            = byte_array::ConstByteArray;
+  using ConstByteArray  = byte_array::ConstByteArray;
+  using TxLayouts       = std::vector<TransactionLayout>;
+  using TransactionPtr  = std::shared_ptr<Transaction>;
+  using TransactionList = std::vector<TransactionPtr>;
 
   // Construction / Destruction
   StorageUnitInterface()           = default;
@@ -71,7 +119,10 @@ public:
   virtual void IssueCallForMissingTxs(DigestSet const &tx_set)       = 0;
   /// @}
 
-  virtual TxLayouts PollRecentTx(uint32_t) = 0;
+  /// @name Batched Transaction Interface
+  /// @{
+  virtual void AddTransactions(TransactionList const &txs);
+  /// @}
 
   /// @name Revertible Document Store Interface
   /// @{
@@ -83,5 +134,20 @@ public:
   /// @}
 };
 
+/**
+ * Add a series of transactions to the storage engine. The default implementation simply makes an
+ * AddTransaction call for each of the transactions, storage engines for which a call is expensive
+ * should override it.
+ *
+ * @param txs The transactions to be added
+ */
+inline void StorageUnitInterface::AddTransactions(TransactionList const &txs)
+{
+  for (auto const &tx : txs)
+  {
+    AddTransaction(*tx);
+  }
+}
+
 }  // namespace ledger
 }  // namespace fetch
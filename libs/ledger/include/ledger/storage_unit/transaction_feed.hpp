@@ -0,0 +1,174 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/mutex.hpp"
+#include "core/runnable.hpp"
+#include "core/state_machine.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+#include "ledger/shard_config.hpp"
+#include "network/muddle/muddle_endpoint.hpp"
+#include "storage/transient_object_store.hpp"
+
+#include <chrono>
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace fetch {
+namespace ledger {
+
+class Transaction;
+
+/**
+ * The credit message sent from a subscriber to a lane. The subscriber grants the lane permission
+ * to send a number of further transaction layouts, the outstanding credit never exceeds the
+ * window
+ */
+struct TransactionFeedCredit
+{
+  uint64_t credit{0};
+  uint64_t window{0};
+};
+
+template <typename T>
+void Serialize(T &s, TransactionFeedCredit const &c)
+{
+  s << c.credit << c.window;
+}
+
+template <typename T>
+void Deserialize(T &s, TransactionFeedCredit &c)
+{
+  s >> c.credit >> c.window;
+}
+
+/**
+ * Lane side of the transaction feed. The layouts of newly seen transactions are streamed (in
+ * batches) to the subscribers as soon as they are seen, limited by the credit each subscriber has
+ * granted. Layouts which can not be sent remain queued in the transaction store.
+ */
+class TransactionFeedPublisher
+{
+public:
+  using MuddleEndpoint = muddle::MuddleEndpoint;
+  using TxStore        = storage::TransientObjectStore<Transaction>;
+  using WeakRunnable   = core::WeakRunnable;
+
+  static constexpr char const *LOGGING_NAME   = "TxFeedPublisher";
+  static constexpr uint32_t    MAX_BATCH_SIZE = 1000;
+
+  // Construction / Destruction
+  TransactionFeedPublisher(MuddleEndpoint &endpoint, TxStore &store);
+  TransactionFeedPublisher(TransactionFeedPublisher const &) = delete;
+  TransactionFeedPublisher(TransactionFeedPublisher &&)      = delete;
+  ~TransactionFeedPublisher()                                = default;
+
+  WeakRunnable GetWeakRunnable() const;
+
+  // Operators
+  TransactionFeedPublisher &operator=(TransactionFeedPublisher const &) = delete;
+  TransactionFeedPublisher &operator=(TransactionFeedPublisher &&) = delete;
+
+private:
+  enum class State
+  {
+    PUBLISHING
+  };
+
+  using Address         = MuddleEndpoint::Address;
+  using Clock           = std::chrono::steady_clock;
+  using Timepoint       = Clock::time_point;
+  using SubscriptionPtr = MuddleEndpoint::SubscriptionPtr;
+  using StateMachinePtr = std::shared_ptr<core::StateMachine<State>>;
+  using Mutex           = mutex::Mutex;
+
+  struct Subscriber
+  {
+    uint64_t  credit{0};
+    Timepoint last_seen{};
+  };
+
+  using SubscriberMap = std::unordered_map<Address, Subscriber>;
+
+  State OnPublishing();
+  void  OnCredit(Address const &from, TransactionFeedCredit const &credit);
+
+  MuddleEndpoint &endpoint_;
+  TxStore &       store_;
+  SubscriptionPtr credit_subscription_;
+  StateMachinePtr state_machine_;
+
+  mutable Mutex subscribers_mutex_{__LINE__, __FILE__};
+  SubscriberMap subscribers_{};  ///< The credit of each of the subscribers
+};
+
+/**
+ * Node side of the transaction feed. Receives the batches of transaction layouts streamed from the
+ * lanes and passes them to the handler. Credit is granted back to a lane once its batch has been
+ * handled, so a slow consumer throttles the lanes.
+ */
+class TransactionFeedSubscriber
+{
+public:
+  using MuddleEndpoint = muddle::MuddleEndpoint;
+  using TxLayouts      = std::vector<TransactionLayout>;
+  using Handler        = std::function<void(TxLayouts const &)>;
+
+  static constexpr char const *LOGGING_NAME = "TxFeedSubscriber";
+  static constexpr uint64_t    WINDOW       = 10000;
+
+  // Construction / Destruction
+  TransactionFeedSubscriber(MuddleEndpoint &endpoint, ShardConfigs const &shards);
+  TransactionFeedSubscriber(TransactionFeedSubscriber const &) = delete;
+  TransactionFeedSubscriber(TransactionFeedSubscriber &&)      = delete;
+  ~TransactionFeedSubscriber()                                 = default;
+
+  void SetHandler(Handler handler);
+  void Refresh();
+
+  // Operators
+  TransactionFeedSubscriber &operator=(TransactionFeedSubscriber const &) = delete;
+  TransactionFeedSubscriber &operator=(TransactionFeedSubscriber &&) = delete;
+
+private:
+  using Address         = MuddleEndpoint::Address;
+  using AddressList     = std::vector<Address>;
+  using AddressSet      = std::unordered_set<Address>;
+  using SubscriptionPtr = MuddleEndpoint::SubscriptionPtr;
+  using Mutex           = mutex::Mutex;
+
+  void OnBatch(Address const &from, TxLayouts const &layouts);
+  void GrantCredit(Address const &lane, uint64_t credit);
+
+  MuddleEndpoint &  endpoint_;
+  AddressList const addresses_;
+  SubscriptionPtr   feed_subscription_;
+
+  mutable Mutex handler_mutex_{__LINE__, __FILE__};
+  Handler       handler_{};
+
+  mutable Mutex active_mutex_{__LINE__, __FILE__};
+  AddressSet    active_{};  ///< The lanes which have sent a batch since the last refresh
+};
+
+}  // namespace ledger
+}  // namespace fetch
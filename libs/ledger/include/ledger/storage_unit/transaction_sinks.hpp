@@ -38,8 +38,23 @@ public:
   /// @name Transaction Sink
   /// @{
   virtual void OnTransaction(TransactionPtr const &tx) = 0;
+  virtual void OnTransactions(TransactionList const &txs);
   /// @}
 };
 
+/**
+ * Handle a batch of transactions. The default implementation simply makes an OnTransaction call
+ * for each of the transactions, sinks which can amortise work across a batch should override it.
+ *
+ * @param txs The batch of transactions
+ */
+inline void TransactionSink::OnTransactions(TransactionList const &txs)
+{
+  for (auto const &tx : txs)
+  {
+    OnTransaction(tx);
+  }
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -17,6 +17,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "ledger/storage_unit/transaction_feed.hpp"
 #include "ledger/storage_unit/transaction_sinks.hpp"
 #include "ledger/transaction_verifier.hpp"
 
@@ -39,7 +40,8 @@ public:
 
   // Construction / Destruction
   TransactionProcessor(StorageUnitInterface &storage, BlockPackerInterface &packer,
-                       TransactionStatusCache &tx_status_cache, std::size_t num_threads);
+                       TransactionFeedSubscriber &feed, TransactionStatusCache &tx_status_cache,
+                       uint32_t log2_num_lanes, std::size_t num_threads);
   TransactionProcessor(TransactionProcessor const &) = delete;
   TransactionProcessor(TransactionProcessor &&)      = delete;
   ~TransactionProcessor() override;
@@ -54,6 +56,7 @@ public:
   /// @{
   void AddTransaction(TransactionPtr const &mtx);
   void AddTransaction(TransactionPtr &&mtx);
+  void AddTransactions(TransactionList &&txs);
   /// @}
 
   // Operators
@@ -62,18 +65,23 @@ public:
 
 protected:
   void OnTransaction(TransactionPtr const &tx) override;
+  void OnTransactions(TransactionList const &txs) override;
 
 private:
   using Flag      = std::atomic<bool>;
   using ThreadPtr = std::unique_ptr<std::thread>;
-
-  StorageUnitInterface &  storage_;
-  BlockPackerInterface &  packer_;
-  TransactionStatusCache &status_cache_;
-  TransactionVerifier     verifier_;
-  ThreadPtr               poll_new_tx_thread_;
-  Flag                    running_{false};
-
+  using TxLayouts = TransactionFeedSubscriber::TxLayouts;
+
+  StorageUnitInterface &     storage_;
+  BlockPackerInterface &     packer_;
+  TransactionFeedSubscriber &feed_;
+  TransactionStatusCache &   status_cache_;
+  uint32_t const             log2_num_lanes_;
+  TransactionVerifier        verifier_;
+  ThreadPtr                  feed_thread_;
+  Flag                       running_{false};
+
+  void OnTransactionLayouts(TxLayouts const &layouts);
   void ThreadEntryPoint();
 };
 
@@ -83,9 +91,8 @@ private:
 inline void TransactionProcessor::Start()
 {
   verifier_.Start();
-  running_ = true;
-  poll_new_tx_thread_ =
-      std::make_unique<std::thread>(&TransactionProcessor::ThreadEntryPoint, this);
+  running_     = true;
+  feed_thread_ = std::make_unique<std::thread>(&TransactionProcessor::ThreadEntryPoint, this);
 }
 
 /**
@@ -94,10 +101,10 @@ inline void TransactionProcessor::Start()
 inline void TransactionProcessor::Stop()
 {
   running_ = false;
-  if (poll_new_tx_thread_)
+  if (feed_thread_)
   {
-    poll_new_tx_thread_->join();
-    poll_new_tx_thread_.reset();
+    feed_thread_->join();
+    feed_thread_.reset();
   }
 
   verifier_.Stop();
@@ -123,5 +130,15 @@ inline void TransactionProcessor::AddTransaction(TransactionPtr &&tx)
   verifier_.AddTransaction(std::move(tx));
 }
 
+/**
+ * Add a series of transactions to the processor, the elements are moved out of the list
+ *
+ * @param txs The list of new transactions to be processed
+ */
+inline void TransactionProcessor::AddTransactions(TransactionList &&txs)
+{
+  verifier_.AddTransactions(std::move(txs));
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -23,6 +23,7 @@
 
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -42,6 +43,7 @@ class TransactionStatusCache
 public:
   using Clock     = std::chrono::steady_clock;
   using Timepoint = Clock::time_point;
+  using Digests   = std::vector<Digest>;
 
   // Construction / Destruction
   TransactionStatusCache()                               = default;
@@ -51,6 +53,8 @@ public:
 
   TransactionStatus Query(Digest digest) const;
   void Update(Digest digest, TransactionStatus status, Timepoint const &now = Clock::now());
+  void Update(Digests const &digests, TransactionStatus status,
+              Timepoint const &now = Clock::now());
 
   // Operators
   TransactionStatusCache &operator=(TransactionStatusCache const &) = delete;
@@ -67,6 +71,7 @@ private:
 
   using Cache = DigestMap<Element>;
 
+  void PruneCacheIfRequired(Timepoint const &now);
   void PruneCache(Timepoint const &now);
 
   mutable Mutex mtx_{__LINE__, __FILE__};
@@ -17,11 +17,14 @@
 //
 //------------------------------------------------------------------------------
 
-#include "core/containers/queue.hpp"
+#include "core/containers/mpmc_ring_queue.hpp"
+#include "metrics/registry.hpp"
 
+#include <algorithm>
 #include <cstddef>
 #include <memory>
 #include <thread>
+#include <vector>
 
 namespace fetch {
 namespace ledger {
@@ -34,14 +37,24 @@ class TransactionVerifier
 public:
   static constexpr char const *LOGGING_NAME = "TxVerifier";
 
-  using TransactionPtr = std::shared_ptr<Transaction>;
+  static constexpr std::size_t DEFAULT_BATCH_SIZE = 64;
+
+  using TransactionPtr  = std::shared_ptr<Transaction>;
+  using TransactionList = std::vector<TransactionPtr>;
 
   // Construction / Destruction
   explicit TransactionVerifier(TransactionSink &sink, std::size_t verifying_threads,
-                               std::string name)
+                               std::string name, std::size_t batch_size = DEFAULT_BATCH_SIZE)
     : verifying_threads_(verifying_threads)
+    , batch_size_(std::max<std::size_t>(batch_size, 1))
     , name_(std::move(name))
     , sink_(sink)
+    , verified_total_(metrics::Registry::Instance().LookupCounter(
+          "ledger_tx_verified_total", "The number of transactions successfully verified"))
+    , failed_total_(metrics::Registry::Instance().LookupCounter(
+          "ledger_tx_verify_failures_total", "The number of transactions failing verification"))
+    , verify_duration_(metrics::Registry::Instance().LookupHistogram(
+          "ledger_tx_verify_duration_seconds", "The time taken to verify a single transaction"))
   {}
   TransactionVerifier(TransactionVerifier const &) = delete;
   TransactionVerifier(TransactionVerifier &&)      = delete;
@@ -57,6 +70,7 @@ public:
   /// @{
   void AddTransaction(TransactionPtr const &tx);
   void AddTransaction(TransactionPtr &&tx);
+  void AddTransactions(TransactionList &&txs);
   /// @}
 
   // Operators
@@ -67,22 +81,30 @@ private:
   static constexpr std::size_t QUEUE_SIZE = 1u << 16u;  // 65K
 
   using Flag            = std::atomic<bool>;
-  using VerifiedQueue   = core::MPSCQueue<TransactionPtr, QUEUE_SIZE>;
-  using UnverifiedQueue = core::MPMCQueue<TransactionPtr, QUEUE_SIZE>;
+  using VerifiedQueue   = core::MPMCRingQueue<TransactionPtr, QUEUE_SIZE>;
+  using UnverifiedQueue = core::MPMCRingQueue<TransactionPtr, QUEUE_SIZE>;
   using ThreadPtr       = std::unique_ptr<std::thread>;
   using Threads         = std::vector<ThreadPtr>;
   using Sink            = TransactionSink;
+  using Counter         = metrics::Counter;
+  using Histogram       = metrics::Histogram;
 
   void Verifier();
   void Dispatcher();
+  void DispatchBatch(TransactionList const &batch);
+  void VerifyBatch(TransactionList &batch);
 
   std::size_t const verifying_threads_;
+  std::size_t const batch_size_;
   std::string const name_;
   Sink &            sink_;
   Flag              active_{true};
   Threads           threads_;
   VerifiedQueue     verified_queue_;
   UnverifiedQueue   unverified_queue_;
+  Counter &         verified_total_;
+  Counter &         failed_total_;
+  Histogram &       verify_duration_;
 };
 
 inline void TransactionVerifier::AddTransaction(TransactionPtr const &tx)
@@ -95,5 +117,16 @@ inline void TransactionVerifier::AddTransaction(TransactionPtr &&tx)
   unverified_queue_.Push(std::move(tx));
 }
 
+/**
+ * Add a series of transactions to the verifier, the elements are moved out of the list
+ *
+ * @param txs The list of transactions to be verified
+ */
+inline void TransactionVerifier::AddTransactions(TransactionList &&txs)
+{
+  unverified_queue_.Push(txs.begin(), txs.end());
+  txs.clear();
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -28,6 +28,7 @@
 #include "ledger/storage_unit/storage_unit_interface.hpp"
 #include "ledger/transaction_status_cache.hpp"
 
+#include <algorithm>
 #include <chrono>
 
 using fetch::byte_array::ToBase64;
@@ -38,6 +39,7 @@ using ExecutionState = fetch::ledger::ExecutionManagerInterface::State;
 static const std::chrono::milliseconds TX_SYNC_NOTIFY_INTERVAL{1000};
 static const std::chrono::milliseconds EXEC_NOTIFY_INTERVAL{500};
 static const std::chrono::seconds      NOTIFY_INTERVAL{10};
+static const std::chrono::milliseconds SYNCHRONISED_CHECK_INTERVAL{1000};
 static const std::chrono::seconds      WAIT_BEFORE_ASKING_FOR_MISSING_TX_INTERVAL{30};
 static const std::chrono::seconds      WAIT_FOR_TX_TIMEOUT_INTERVAL{30};
 static const uint32_t                  THRESHOLD_FOR_FAST_SYNCING{100u};
@@ -103,6 +105,16 @@ BlockCoordinator::BlockCoordinator(MainChain &chain, ExecutionManagerInterface &
     }
   });
 
+  // wake the state machine as soon as the heaviest chain changes
+  std::weak_ptr<StateMachine> weak_state_machine = state_machine_;
+  chain_.OnHeaviestChainUpdate([weak_state_machine]() {
+    auto state_machine = weak_state_machine.lock();
+    if (state_machine)
+    {
+      state_machine->Notify();
+    }
+  });
+
   // TODO(private issue 792): this shouldn't be here, but if it is, it locks the whole system on
   // startup. RecoverFromStartup();
 }
@@ -116,6 +128,7 @@ void BlockCoordinator::TriggerBlockGeneration()
   if (mining_)
   {
     next_block_time_ = Clock::now();
+    state_machine_->Notify();
   }
 }
 
@@ -346,6 +359,16 @@ BlockCoordinator::State BlockCoordinator::OnSynchronised(State current, State pr
                    current_block_->body.previous_hash.ToHex(), ")");
   }
 
+  // Nothing to do until either the chain changes or the next block is due. Changes to the chain
+  // and the mining configuration notify the state machine, so the delay is only a fallback
+  Clock::duration delay = SYNCHRONISED_CHECK_INTERVAL;
+  if (mining_ && mining_enabled_)
+  {
+    delay = std::min(delay, next_block_time_ - Clock::now());
+  }
+
+  state_machine_->Delay(delay);
+
   return State::SYNCHRONISED;
 }
 
@@ -0,0 +1,100 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chain/digest_bloom_filter.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace fetch {
+namespace ledger {
+
+constexpr std::size_t DigestBloomFilter::DEFAULT_LOG2_SIZE;
+constexpr std::size_t DigestBloomFilter::NUM_HASHES;
+
+/**
+ * Construct an empty filter
+ *
+ * @param log2_size The log2 of the number of bits in the filter
+ */
+DigestBloomFilter::DigestBloomFilter(std::size_t log2_size)
+  : bits_(std::max<std::size_t>((std::size_t{1} << log2_size) / 64u, 1u), 0)
+  , mask_((uint64_t{1} << log2_size) - 1u)
+{}
+
+/**
+ * Add a digest to the filter
+ *
+ * @param digest The digest to be added
+ */
+void DigestBloomFilter::Add(Digest const &digest)
+{
+  VisitBits(digest, [this](uint64_t bit) { bits_[bit >> 6u] |= uint64_t{1} << (bit & 63u); });
+}
+
+/**
+ * Determine if the digest might have been added to the filter
+ *
+ * @param digest The digest to be checked
+ * @return false if the digest has definitely not been added, otherwise true
+ */
+bool DigestBloomFilter::Match(Digest const &digest) const
+{
+  bool match{true};
+
+  VisitBits(digest, [this, &match](uint64_t bit) {
+    match = match && ((bits_[bit >> 6u] >> (bit & 63u)) & 1u);
+  });
+
+  return match;
+}
+
+/**
+ * Remove all the digests from the filter
+ */
+void DigestBloomFilter::Reset()
+{
+  std::fill(bits_.begin(), bits_.end(), 0);
+}
+
+/**
+ * Internal: Call the visitor with each of the bit positions for the specified digest
+ *
+ * @param digest The digest to be mapped
+ * @param visitor The visitor to be called with each bit position
+ */
+template <typename Visitor>
+void DigestBloomFilter::VisitBits(Digest const &digest, Visitor &&visitor) const
+{
+  uint64_t words[2] = {0, 0};
+  if (!digest.empty())
+  {
+    std::memcpy(words, digest.pointer(), std::min(digest.size(), sizeof(words)));
+  }
+
+  // ensure the step is odd so that all the positions are distinct
+  uint64_t const step = words[1] | 1u;
+
+  for (std::size_t i = 0; i < NUM_HASHES; ++i)
+  {
+    visitor((words[0] + (i * step)) & mask_);
+  }
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -69,8 +69,10 @@ MainChain::MainChain(Mode mode)
 {
   if (Mode::IN_MEMORY_DB != mode)
   {
-    // create the block store
+    // create the block and transaction stores
     block_store_ = std::make_unique<BlockStore>();
+    tx_store_    = std::make_unique<TransactionStore>();
+    tx_filter_   = std::make_unique<DigestBloomFilter>();
 
     RecoverFromFile(mode);
   }
@@ -91,6 +93,11 @@ MainChain::~MainChain()
   {
     block_store_->Flush(false);
   }
+
+  if (tx_store_)
+  {
+    tx_store_->Flush(false);
+  }
 }
 
 /**
@@ -127,8 +134,15 @@ BlockStatus MainChain::AddBlock(Block const &blk)
  */
 MainChain::BlockPtr MainChain::GetHeaviestBlock() const
 {
+  // in the normal case the heaviest block can be served directly from the published view
+  auto const view = GetHeaviestChainView();
+  if (view)
+  {
+    return view->block;
+  }
+
   FETCH_LOCK(lock_);
-  return GetBlock(heaviest_.hash);
+  return GetStoredBlock(heaviest_.hash);
 }
 
 /**
@@ -153,7 +167,8 @@ bool MainChain::RemoveBlock(BlockHash hash)
 
     // add the original element into the invalidated block set
     invalidated_blocks.insert(hash);
-    block_chain_.erase(hash);
+    RemoveIndexedTransactions(*invalid_block_it->second);
+    block_chain_.erase(invalid_block_it);
 
     // Step 1. Evaluate all the blocks which have been now been made invalid from this change
     for (;;)
@@ -174,6 +189,7 @@ bool MainChain::RemoveBlock(BlockHash hash)
 
       // update our removed blocks and hashes
       invalidated_blocks.insert(it->first);
+      RemoveIndexedTransactions(*it->second);
 
       // remove the element from the map
       block_chain_.erase(it);
@@ -236,9 +252,55 @@ MainChain::Blocks MainChain::GetHeaviestChain(uint64_t limit) const
   limit = std::min(limit, uint64_t{MainChain::UPPER_BOUND});
   MilliTimer myTimer("MainChain::HeaviestChain");
 
+  return GetChainPreceding(GetHeaviestBlockHash(), limit);
+}
+
+/**
+ * Retrieve a range of blocks from the heaviest chain by block number
+ *
+ * The range is clipped to the current height of the heaviest chain and is limited to UPPER_BOUND
+ * blocks.
+ *
+ * @param start The block number of the first block
+ * @param end The block number of the last block (inclusive)
+ * @return The array of blocks (in ascending block number order)
+ */
+MainChain::Blocks MainChain::GetHeaviestChainRange(uint64_t start, uint64_t end) const
+{
+  MilliTimer myTimer("MainChain::HeaviestChainRange");
+
+  Blocks result;
+
   FETCH_LOCK(lock_);
 
-  return GetChainPreceding(GetHeaviestBlockHash(), limit);
+  if (heaviest_chain_.empty())
+  {
+    return result;
+  }
+
+  // clip the range to the current heaviest chain
+  end = std::min(end, static_cast<uint64_t>(heaviest_chain_.size() - 1));
+  if (start > end)
+  {
+    return result;
+  }
+
+  end = std::min(end, start + (MainChain::UPPER_BOUND - 1));
+
+  result.reserve(end - start + 1);
+  for (uint64_t block_number = start; block_number <= end; ++block_number)
+  {
+    auto block = GetStoredBlock(heaviest_chain_[block_number]);
+    if (!block)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Block lookup failure for block number: ", block_number);
+      break;
+    }
+
+    result.emplace_back(std::move(block));
+  }
+
+  return result;
 }
 
 /**
@@ -254,14 +316,29 @@ MainChain::Blocks MainChain::GetChainPreceding(BlockHash start, uint64_t limit)
   limit = std::min(limit, uint64_t{MainChain::UPPER_BOUND});
   MilliTimer myTimer("MainChain::ChainPreceding");
 
-  FETCH_LOCK(lock_);
-
   Blocks result;
 
   // lookup the heaviest block hash
   BlockPtr  block;
   BlockHash current_hash = std::move(start);
 
+  // serve as much of the request as possible from the published view of the heaviest chain, in
+  // the normal case this means that the lock never needs to be taken
+  auto link = LookupHeaviestChainView(current_hash);
+  for (; link && (result.size() < limit); link = link->previous)
+  {
+    result.push_back(link->block);
+    current_hash = link->block->body.previous_hash;
+  }
+
+  // exit early when the request has been completely served from the view
+  if ((result.size() >= limit) || (GENESIS_DIGEST == current_hash))
+  {
+    return result;
+  }
+
+  FETCH_LOCK(lock_);
+
   while (result.size() < limit)
   {
     // exit once we have reached genesis
@@ -271,7 +348,7 @@ MainChain::Blocks MainChain::GetChainPreceding(BlockHash start, uint64_t limit)
     }
 
     // lookup the block
-    block = GetBlock(current_hash);
+    block = GetStoredBlock(current_hash);
     if (!block)
     {
       FETCH_LOG_ERROR(LOGGING_NAME, "Block lookup failure for block: ", ToBase64(current_hash));
@@ -328,7 +405,7 @@ bool MainChain::GetPathToCommonAncestor(Blocks &blocks, BlockHash tip, BlockHash
     // load up the left side
     if (!left || left->body.hash != left_hash)
     {
-      left = GetBlock(left_hash);
+      left = GetStoredBlock(left_hash);
       if (!left)
       {
         FETCH_LOG_WARN(LOGGING_NAME, "Unable to lookup block (left): ", ToBase64(left_hash));
@@ -366,7 +443,7 @@ bool MainChain::GetPathToCommonAncestor(Blocks &blocks, BlockHash tip, BlockHash
     // load up the right side
     if (!right || right->body.hash != right_hash)
     {
-      right = GetBlock(right_hash);
+      right = GetStoredBlock(right_hash);
       if (!right)
       {
         FETCH_LOG_WARN(LOGGING_NAME, "Unable to lookup block (right): ", ToBase64(right_hash));
@@ -413,6 +490,24 @@ bool MainChain::GetPathToCommonAncestor(Blocks &blocks, BlockHash tip, BlockHash
  * @return The a valid shared pointer to the block if found, otherwise an empty pointer
  */
 MainChain::BlockPtr MainChain::GetBlock(BlockHash hash) const
+{
+  // blocks which are part of the recent heaviest chain can be served from the published view
+  auto const link = LookupHeaviestChainView(hash);
+  if (link)
+  {
+    return link->block;
+  }
+
+  return GetStoredBlock(std::move(hash));
+}
+
+/**
+ * Internal: Retrieve a block with a specific hash from either the cache or the block store
+ *
+ * @param hash The hash being queried
+ * @return The a valid shared pointer to the block if found, otherwise an empty pointer
+ */
+MainChain::BlockPtr MainChain::GetStoredBlock(BlockHash hash) const
 {
   FETCH_LOCK(lock_);
 
@@ -524,6 +619,7 @@ void MainChain::RecoverFromFile(Mode mode)
   if (Mode::CREATE_PERSISTENT_DB == mode)
   {
     block_store_->New("chain.db", "chain.index.db");
+    tx_store_->New("chain.tx.db", "chain.tx.index.db");
     head_store_.open("chain.head.db",
                      std::ios::binary | std::ios::in | std::ios::out | std::ios::trunc);
     return;
@@ -531,6 +627,7 @@ void MainChain::RecoverFromFile(Mode mode)
   else if (Mode::LOAD_PERSISTENT_DB == mode)
   {
     block_store_->Load("chain.db", "chain.index.db");
+    tx_store_->Load("chain.tx.db", "chain.tx.index.db");
     head_store_.open("chain.head.db", std::ios::binary | std::ios::in | std::ios::out);
   }
   else
@@ -545,6 +642,10 @@ void MainChain::RecoverFromFile(Mode mode)
   // retrieve the starting hash
   BlockHash head_block_hash = GetHeadHash();
 
+  // the transaction index is only rebuilt when it is missing (e.g. chains stored by an older
+  // version), otherwise it is kept up to date as blocks are written to the block store
+  bool const rebuild_tx_index = (tx_store_->size() == 0);
+
   bool recovery_complete{false};
   if (!head_block_hash.empty() && block_store_->Get(storage::ResourceID{head_block_hash}, *block))
   {
@@ -553,6 +654,15 @@ void MainChain::RecoverFromFile(Mode mode)
     // Save the head
     head = block;
 
+    if (rebuild_tx_index)
+    {
+      PersistIndexedTransactions(*head);
+    }
+    else
+    {
+      FilterStoredTransactions(*head);
+    }
+
     // Copy head block so as to walk down the chain
     IntBlockPtr next = std::make_shared<Block>(*block);
 
@@ -567,6 +677,15 @@ void MainChain::RecoverFromFile(Mode mode)
       }
 
       block_index = next->body.block_number;
+
+      if (rebuild_tx_index)
+      {
+        PersistIndexedTransactions(*next);
+      }
+      else
+      {
+        FilterStoredTransactions(*next);
+      }
     }
 
     if (block_index != 0)
@@ -614,7 +733,12 @@ void MainChain::RecoverFromFile(Mode mode)
   // Recovering the chain has failed in some way, reset the storage.
   if (!recovery_complete)
   {
+    tx_index_.clear();
+    heaviest_chain_.clear();
+
     block_store_->New("chain.db", "chain.index.db");
+    tx_store_->New("chain.tx.db", "chain.tx.index.db");
+    tx_filter_->Reset();
 
     // reopen the file and clear the contents
     head_store_.close();
@@ -664,6 +788,7 @@ void MainChain::WriteToFile()
       FETCH_LOG_DEBUG(LOGGING_NAME, "Writing genesis. ");
 
       block_store_->Set(storage::ResourceID(block->body.hash), *block);
+      PersistIndexedTransactions(*block);
       SetHeadHash(block->body.hash);
     }
     else
@@ -682,6 +807,7 @@ void MainChain::WriteToFile()
       for (;;)
       {
         block_store_->Set(storage::ResourceID(block->body.hash), *block);
+        PersistIndexedTransactions(*block);
 
         // Keep the current_file_head one block behind
         while (current_file_head->body.block_number != block->body.block_number - 1)
@@ -707,8 +833,9 @@ void MainChain::WriteToFile()
     // Clear the block from ram
     FlushBlock(block);
 
-    // Force flush of the file object!
+    // Force flush of the file objects!
     block_store_->Flush(false);
+    tx_store_->Flush(false);
 
     // as final step do some sanity checks
     TrimCache();
@@ -746,6 +873,11 @@ void MainChain::TrimCache()
       {
         FETCH_LOG_INFO(LOGGING_NAME, "Removing loose block: 0x", block.hash.ToHex());
 
+        // the transactions of blocks which have been written to disk are already in the stored
+        // index, while blocks which are not on the heaviest chain will never be written and should
+        // no longer be considered when checking for duplicate transactions
+        RemoveIndexedTransactions(*chain_it->second);
+
         // remove the entry from the tips map
         tips_.erase(block.hash);
 
@@ -798,6 +930,9 @@ void MainChain::TrimCache()
  */
 void MainChain::FlushBlock(IntBlockPtr const &block)
 {
+  // the transactions of the block have already been written to the stored index
+  RemoveIndexedTransactions(*block);
+
   // remove the block from the block map
   block_chain_.erase(block->body.hash);
 
@@ -1002,11 +1137,13 @@ BlockStatus MainChain::InsertBlock(IntBlockPtr const &block, bool evaluate_loose
   // Add block
   FETCH_LOG_DEBUG(LOGGING_NAME, "Adding block to chain: 0x", block->body.hash.ToHex());
   AddBlockToCache(block);
+  IndexTransactions(*block);
 
   // If the heaviest branch has been updated we should determine if any blocks should be flushed
   // to disk
   if (heaviest_advanced)
   {
+    UpdateHeaviestChainIndex();
     WriteToFile();
   }
 
@@ -1167,11 +1304,278 @@ bool MainChain::DetermineHeaviestTip()
     heaviest_.hash   = it->first;
     heaviest_.weight = it->second.total_weight;
     success          = true;
+
+    UpdateHeaviestChainIndex();
   }
 
   return success;
 }
 
+/**
+ * Add all the transactions of a (non-loose) block to the transaction index
+ *
+ * @param block The block whose transactions should be indexed
+ */
+void MainChain::IndexTransactions(Block const &block)
+{
+  FETCH_LOCK(lock_);
+
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_index_.emplace(tx.digest(), TransactionRecord{block.body.block_number, block.body.hash});
+    }
+  }
+}
+
+/**
+ * Remove all the transactions of a block from the transaction index
+ *
+ * @param block The block whose transactions should be removed
+ */
+void MainChain::RemoveIndexedTransactions(Block const &block)
+{
+  FETCH_LOCK(lock_);
+
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      auto range = tx_index_.equal_range(tx.digest());
+      while (range.first != range.second)
+      {
+        if (range.first->second.block_hash == block.body.hash)
+        {
+          range.first = tx_index_.erase(range.first);
+        }
+        else
+        {
+          ++range.first;
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Add all the transactions of a block being written to the block store to the stored transaction
+ * index
+ *
+ * @param block The block whose transactions should be indexed
+ */
+void MainChain::PersistIndexedTransactions(Block const &block)
+{
+  TransactionRecord const record{block.body.block_number, block.body.hash};
+
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_store_->Set(storage::ResourceID{tx.digest()}, record);
+      tx_filter_->Add(tx.digest());
+    }
+  }
+}
+
+/**
+ * Add all the transactions of a block in the block store to the filter of the stored transaction
+ * index, so that candidates which have never been stored do not need to be looked up on disk
+ *
+ * @param block The block whose transactions should be added
+ */
+void MainChain::FilterStoredTransactions(Block const &block)
+{
+  for (auto const &slice : block.body.slices)
+  {
+    for (auto const &tx : slice)
+    {
+      tx_filter_->Add(tx.digest());
+    }
+  }
+}
+
+/**
+ * Update the height index of the heaviest chain after the heaviest tip has changed
+ *
+ * In the normal case this is a single step since the new tip directly extends the previous one.
+ * In the case of a reorganisation the chain is walked back until the common ancestor is found.
+ *
+ * @return true if successful, otherwise false
+ */
+bool MainChain::UpdateHeaviestChainIndex()
+{
+  FETCH_LOCK(lock_);
+
+  IntBlockPtr block;
+  if (!LookupBlock(heaviest_.hash, block))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to lookup heaviest block when updating chain index");
+    return false;
+  }
+
+  // trim (or extend) the index so that the heaviest block is at the top
+  heaviest_chain_.resize(block->body.block_number + 1);
+
+  for (;;)
+  {
+    auto &entry = heaviest_chain_[block->body.block_number];
+
+    // once we reach a block which has already been indexed, the rest of the chain is also valid
+    if (entry == block->body.hash)
+    {
+      break;
+    }
+
+    entry = block->body.hash;
+
+    // exit once we have reached genesis
+    if (block->body.block_number == 0)
+    {
+      break;
+    }
+
+    if (!LookupBlock(block->body.previous_hash, block))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to walk heaviest chain when updating chain index");
+      return false;
+    }
+  }
+
+  PublishHeaviestChainView();
+
+  return true;
+}
+
+/**
+ * Determine if a block is part of the current heaviest chain
+ *
+ * @param block_number The block number of the block
+ * @param hash The hash of the block
+ * @return true if the block is on the heaviest chain, otherwise false
+ */
+bool MainChain::IsOnHeaviestChain(uint64_t block_number, BlockHash const &hash) const
+{
+  return (block_number < heaviest_chain_.size()) && (heaviest_chain_[block_number] == hash);
+}
+
+/**
+ * Build and publish a new view of the heaviest chain
+ *
+ * The blocks from the new heaviest tip are walked back until they join the previously published
+ * view, the links of which are then reused. In the normal case this means that only a single link
+ * is created. Once the view has grown to twice CHAIN_VIEW_DEPTH it is rebuilt, so that the blocks
+ * at the end of the view can be released
+ */
+void MainChain::PublishHeaviestChainView()
+{
+  std::size_t const max_depth = CHAIN_VIEW_DEPTH;
+
+  FETCH_LOCK(lock_);
+
+  IntBlockPtr block;
+  if (!LookupBlock(heaviest_.hash, block))
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to lookup heaviest block when publishing chain view");
+    return;
+  }
+
+  // walk back from the heaviest block until we join the previously published view
+  Blocks       blocks{};
+  ChainLinkPtr join = GetHeaviestChainView();
+  for (;;)
+  {
+    // advance the previous view to the same height as the current block
+    while (join && (join->block->body.block_number > block->body.block_number))
+    {
+      join = join->previous;
+    }
+
+    if (join && (join->block->body.hash == block->body.hash))
+    {
+      break;
+    }
+
+    blocks.push_back(block);
+
+    // exit once we have reached genesis or the maximum depth
+    if ((block->body.block_number == 0) || (blocks.size() >= max_depth))
+    {
+      join.reset();
+      break;
+    }
+
+    if (!LookupBlock(block->body.previous_hash, block))
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to walk heaviest chain when publishing chain view");
+      join.reset();
+      break;
+    }
+  }
+
+  // when the view has become too long, copy the most recent part of it into a new set of links
+  if (join && ((join->length + blocks.size()) > (2 * max_depth)))
+  {
+    for (; join && (blocks.size() < max_depth); join = join->previous)
+    {
+      blocks.push_back(join->block);
+    }
+
+    join.reset();
+  }
+
+  // create the new links (oldest first)
+  ChainLinkPtr view = std::move(join);
+  for (auto it = blocks.rbegin(); it != blocks.rend(); ++it)
+  {
+    std::size_t const length = (view) ? view->length + 1 : 1;
+
+    view = std::make_shared<ChainLink const>(ChainLink{*it, std::move(view), length});
+  }
+
+  std::atomic_store(&chain_view_, view);
+
+  if (heaviest_chain_callback_)
+  {
+    heaviest_chain_callback_();
+  }
+}
+
+/**
+ * Get the most recently published view of the heaviest chain
+ *
+ * @return The link for the heaviest block (empty if no view has been published yet)
+ */
+MainChain::ChainLinkPtr MainChain::GetHeaviestChainView() const
+{
+  return std::atomic_load(&chain_view_);
+}
+
+/**
+ * Lookup a block in the most recent part of the published view of the heaviest chain
+ *
+ * Only the first CHAIN_VIEW_LOOKUP_DEPTH links are searched, so that the cost of a miss is bounded.
+ * Older blocks are served (under the chain lock) from the cache or the block store instead.
+ *
+ * @param hash The hash of the block
+ * @return The link for the block (empty if the block is not part of the searched links)
+ */
+MainChain::ChainLinkPtr MainChain::LookupHeaviestChainView(BlockHash const &hash) const
+{
+  auto        link  = GetHeaviestChainView();
+  std::size_t depth = 0;
+
+  for (; link && (depth < CHAIN_VIEW_LOOKUP_DEPTH); link = link->previous, ++depth)
+  {
+    if (link->block->body.hash == hash)
+    {
+      return link;
+    }
+  }
+
+  return {};
+}
+
 /**
  * Reindex the tips
  *
@@ -1264,6 +1668,12 @@ MainChain::IntBlockPtr MainChain::CreateGenesisBlock()
  */
 MainChain::BlockHash MainChain::GetHeaviestBlockHash() const
 {
+  auto const view = GetHeaviestChainView();
+  if (view)
+  {
+    return view->block->body.hash;
+  }
+
   FETCH_LOCK(lock_);
   return heaviest_.hash;
 }
@@ -1324,6 +1734,12 @@ void MainChain::SetHeadHash(BlockHash const &hash)
 /**
  * Strip transactions in container that already exist in the blockchain
  *
+ * Rather than walking the chain, the transaction index is queried for each of the candidate
+ * transactions. Any matching blocks are then checked to be part of the chain which ends at the
+ * starting block. This is trivial for blocks on the heaviest chain, since a height index of the
+ * chain is maintained. When the starting block is on a fork, the fork is walked back until it joins
+ * the heaviest chain.
+ *
  * @param: starting_hash Block to start looking downwards from
  * @tparam: transaction The set of transaction to be filtered
  *
@@ -1336,6 +1752,8 @@ DigestSet MainChain::DetectDuplicateTransactions(BlockHash        starting_hash,
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Starting TX uniqueness verify");
 
+  FETCH_LOCK(lock_);
+
   IntBlockPtr block;
   if (!LookupBlock(std::move(starting_hash), block, false) || block->is_loose)
   {
@@ -1343,38 +1761,79 @@ DigestSet MainChain::DetectDuplicateTransactions(BlockHash        starting_hash,
     return {};
   }
 
-  // Need a set for quickly checking whether transactions are in our container
-  DigestSet duplicates{};
-  bool      searching{true};
-  while (searching)
+  // Step 1. Walk back from the starting block until the heaviest chain is reached (normally the
+  // starting block is already on the heaviest chain). The blocks passed on the way are recorded.
+  BlockHashSet fork_blocks{};
+  bool         joins_heaviest_chain{true};
+  while (!IsOnHeaviestChain(block->body.block_number, block->body.hash))
   {
-    // Traversing the chain fully is costly: break out early if we know the transactions are all
-    // duplicated (or empty)
-    if (transactions.size() == duplicates.size())
+    fork_blocks.insert(block->body.hash);
+
+    if (!LookupBlock(block->body.previous_hash, block, false))
     {
+      joins_heaviest_chain = false;
       break;
     }
+  }
 
-    for (auto const &slice : block->body.slices)
-    {
-      for (auto const &tx : slice)
-      {
-        if (transactions.find(tx.digest()) != transactions.end())
-        {
-          duplicates.insert(tx.digest());
-        }
-      }
-    }
+  uint64_t const join_block_number = joins_heaviest_chain ? block->body.block_number : 0;
 
-    // exit the loop once we can no longer find the block
-    if (!LookupBlock(block->body.previous_hash, block, false))
+  auto const is_duplicate = [&](TransactionRecord const &record) {
+    bool const on_fork           = fork_blocks.find(record.block_hash) != fork_blocks.end();
+    bool const on_heaviest_chain = joins_heaviest_chain &&
+                                   (record.block_number <= join_block_number) &&
+                                   IsOnHeaviestChain(record.block_number, record.block_hash);
+
+    return on_fork || on_heaviest_chain;
+  };
+
+  // Step 2. Probe the transaction indices for each of the candidate transactions. Blocks in the
+  // cache are checked first, followed by the blocks which have been written to the block store.
+  // The stored index is only read from disk when the digest matches its filter
+  DigestSet duplicates{};
+  for (auto const &digest : transactions)
+  {
+    auto const range = tx_index_.equal_range(digest);
+    bool const found = std::any_of(range.first, range.second,
+                                   [&](TransactionIndex::value_type const &entry) {
+                                     return is_duplicate(entry.second);
+                                   });
+
+    TransactionRecord record{};
+    if (found || (tx_store_ && tx_filter_->Match(digest) &&
+                  tx_store_->Get(storage::ResourceID{digest}, record) && is_duplicate(record)))
     {
-      break;
+      duplicates.insert(digest);
     }
   }
 
   return duplicates;
 }
 
+/**
+ * Get the number of entries in the in-memory transaction index
+ *
+ * @return The number of entries
+ */
+std::size_t MainChain::GetTransactionIndexSize() const
+{
+  FETCH_LOCK(lock_);
+  return tx_index_.size();
+}
+
+/**
+ * Register the callback which is invoked each time the heaviest chain changes
+ *
+ * The callback is invoked with the chain lock held, it must be cheap and must not call back into
+ * the chain (e.g. it should only signal another component)
+ *
+ * @param cb The callback to be registered
+ */
+void MainChain::OnHeaviestChainUpdate(HeaviestChainCallback cb)
+{
+  FETCH_LOCK(lock_);
+  heaviest_chain_callback_ = std::move(cb);
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -18,6 +18,7 @@
 
 #include "ledger/chain/transaction.hpp"
 #include "crypto/verifier.hpp"
+#include "crypto/verifier_cache.hpp"
 #include "ledger/chain/transaction_serializer.hpp"
 
 namespace fetch {
@@ -43,9 +44,29 @@ uint64_t Transaction::GetTotalTransferAmount() const
 /**
  * Verify the contents of the transaction
  *
- * @return
+ * @return true if all the signatures are valid, otherwise false
  */
 bool Transaction::Verify()
+{
+  crypto::VerifierCache::VerifierPtr verifier{};
+
+  // resolve the verifiers for each of the signatories through the shared cache
+  return Verify([&verifier](Identity const &identity) -> crypto::Verifier & {
+    verifier = crypto::VerifierCache::Default().Lookup(identity);
+    return *verifier;
+  });
+}
+
+/**
+ * Verify the contents of the transaction using a caller supplied set of verifiers
+ *
+ * This allows callers that are processing many transactions together to decode the public key
+ * of a signer once and reuse it for every subsequent signature from the same identity.
+ *
+ * @param lookup The function used to resolve the verifier for a given identity
+ * @return true if all the signatures are valid, otherwise false
+ */
+bool Transaction::Verify(VerifierLookup const &lookup)
 {
   if (!verification_completed_)
   {
@@ -63,7 +84,7 @@ bool Transaction::Verify()
       for (auto const &signatory : signatories_)
       {
         // verify the signature
-        if (!crypto::Verifier::Verify(signatory.identity, payload, signatory.signature))
+        if (!lookup(signatory.identity).Verify(payload, signatory.signature))
         {
           // exit as soon as the first non valid signature is detected
           all_verified = false;
@@ -28,6 +28,15 @@
 namespace fetch {
 namespace ledger {
 
+/**
+ * Construct the chain code cache
+ *
+ * @param executable_cache The (optional) shared cache of compiled smart contracts
+ */
+ChainCodeCache::ChainCodeCache(ExecutableCachePtr executable_cache)
+  : factory_{std::move(executable_cache)}
+{}
+
 ChainCodeCache::ContractPtr ChainCodeCache::Lookup(Identifier const &contract_id,
                                                    StorageInterface &storage)
 {
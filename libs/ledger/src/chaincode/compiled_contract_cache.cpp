@@ -0,0 +1,130 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "core/logger.hpp"
+
+#include <exception>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+std::string DocumentFile(std::string const &prefix)
+{
+  return prefix + "_contracts.db";
+}
+
+std::string IndexFile(std::string const &prefix)
+{
+  return prefix + "_contracts_index.db";
+}
+
+}  // namespace
+
+/**
+ * Create a new (empty) cache, discarding any existing contents
+ *
+ * @param prefix The database file(s) prefix
+ */
+void CompiledContractCache::New(std::string const &prefix)
+{
+  store_.New(DocumentFile(prefix), IndexFile(prefix));
+}
+
+/**
+ * Load an existing cache from disk, creating it if it is not present
+ *
+ * @param prefix The database file(s) prefix
+ */
+void CompiledContractCache::Load(std::string const &prefix)
+{
+  store_.Load(DocumentFile(prefix), IndexFile(prefix), true);
+}
+
+/**
+ * Lookup a compiled executable in the cache
+ *
+ * @param digest The digest of the contract source
+ * @param version The opcode table version of the VM which will run the executable
+ * @param executable The output executable to be populated
+ * @return true if a compatible executable was found, otherwise false
+ */
+bool CompiledContractCache::Get(ConstByteArray const &digest, uint64_t version,
+                                Executable &executable)
+{
+  Entry entry{};
+
+  bool found{false};
+  try
+  {
+    found = store_.Get(storage::ResourceID{digest}, entry);
+  }
+  catch (std::exception const &ex)
+  {
+    // corrupt or incompatible entries are simply recompiled
+    FETCH_LOG_WARN(LOGGING_NAME, "Unable to load cached executable: ", ex.what());
+  }
+
+  if (!found)
+  {
+    ++misses_;
+    return false;
+  }
+
+  if (entry.version != version)
+  {
+    ++stale_;
+    return false;
+  }
+
+  executable = std::move(entry.executable);
+  ++hits_;
+
+  return true;
+}
+
+/**
+ * Store a compiled executable in the cache
+ *
+ * @param digest The digest of the contract source
+ * @param version The opcode table version of the VM which generated the executable
+ * @param executable The executable to be stored
+ */
+void CompiledContractCache::Set(ConstByteArray const &digest, uint64_t version,
+                                Executable const &executable)
+{
+  store_.Set(storage::ResourceID{digest}, Entry{version, executable});
+}
+
+/**
+ * Get a snapshot of the cache statistics
+ *
+ * @return The current statistics
+ */
+CompiledContractCache::Statistics CompiledContractCache::GetStatistics() const
+{
+  Statistics stats{};
+  stats.hits   = hits_.load();
+  stats.misses = misses_.load();
+  stats.stale  = stale_.load();
+  return stats;
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -321,6 +321,10 @@ ContractHttpInterface::SubmitTxStatus ContractHttpInterface::SubmitJsonTx(
   if (doc.root().IsArray())
   {
     expected_count = doc.root().size();
+
+    TransactionProcessor::TransactionList batch{};
+    batch.reserve(expected_count);
+
     for (std::size_t i = 0, end = doc.root().size(); i < end; ++i)
     {
       auto const &tx_obj = doc[i];
@@ -330,11 +334,13 @@ ContractHttpInterface::SubmitTxStatus ContractHttpInterface::SubmitJsonTx(
       if (FromJsonTransaction(tx_obj, *tx))
       {
         txs.emplace_back(tx->digest());
-
-        processor_.AddTransaction(std::move(tx));
-        ++submitted;
+        batch.emplace_back(std::move(tx));
       }
     }
+
+    // submit the whole array to the processor in one go
+    submitted = batch.size();
+    processor_.AddTransactions(std::move(batch));
   }
   else
   {
@@ -0,0 +1,568 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chaincode/executable_cache.hpp"
+#include "core/mutex.hpp"
+#include "crypto/fnv.hpp"
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+
+#include <algorithm>
+#include <array>
+#include <list>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+using ConstByteArray = byte_array::ConstByteArray;
+using Executable     = vm::Executable;
+using ExecutablePtr  = ExecutableCache::ExecutablePtr;
+using Statistics     = ExecutableCache::Statistics;
+
+constexpr std::size_t TYPICAL_EXECUTABLE_SIZE = 4096;
+constexpr std::size_t MIN_SKETCH_WIDTH        = 64;
+constexpr std::size_t MAX_SKETCH_WIDTH        = 1u << 16u;
+constexpr std::size_t WINDOW_PERCENTAGE       = 1;
+constexpr std::size_t PROTECTED_PERCENTAGE    = 80;
+
+std::size_t RoundUpToPowerOfTwo(std::size_t value)
+{
+  std::size_t result = 1;
+  while (result < value)
+  {
+    result <<= 1u;
+  }
+  return result;
+}
+
+std::size_t EstimateStringSize(std::string const &value)
+{
+  return sizeof(std::string) + value.capacity();
+}
+
+/**
+ * A count-min sketch of 4-bit saturating counters used to estimate how frequently each key has been
+ * accessed. All the counters are halved once the number of recorded accesses reaches ten times the
+ * width of the sketch, so that the estimates favour recent history.
+ */
+class FrequencySketch
+{
+public:
+  explicit FrequencySketch(std::size_t width)
+    : width_{RoundUpToPowerOfTwo(width)}
+    , mask_{width_ - 1u}
+    , sample_size_{width_ * 10u}
+    , table_(width_ * DEPTH, 0)
+  {}
+
+  void Increment(std::size_t hash)
+  {
+    for (std::size_t row = 0; row < DEPTH; ++row)
+    {
+      uint8_t &counter = table_[Index(hash, row)];
+      if (counter < MAX_COUNT)
+      {
+        ++counter;
+      }
+    }
+
+    if (++additions_ >= sample_size_)
+    {
+      Age();
+    }
+  }
+
+  uint8_t Frequency(std::size_t hash) const
+  {
+    uint8_t frequency = MAX_COUNT;
+    for (std::size_t row = 0; row < DEPTH; ++row)
+    {
+      frequency = std::min(frequency, table_[Index(hash, row)]);
+    }
+    return frequency;
+  }
+
+private:
+  static constexpr std::size_t DEPTH     = 4;
+  static constexpr uint8_t     MAX_COUNT = 15;
+
+  std::size_t Index(std::size_t hash, std::size_t row) const
+  {
+    static constexpr std::array<uint64_t, DEPTH> SEEDS{{0x9E3779B97F4A7C15ull,
+                                                        0xC2B2AE3D27D4EB4Full,
+                                                        0x165667B19E3779F9ull,
+                                                        0xD6E8FEB86659FD93ull}};
+
+    uint64_t value = (static_cast<uint64_t>(hash) + row) * SEEDS[row];
+    value ^= value >> 32u;
+
+    return (row * width_) + static_cast<std::size_t>(value & mask_);
+  }
+
+  void Age()
+  {
+    for (auto &counter : table_)
+    {
+      counter = static_cast<uint8_t>(counter >> 1u);
+    }
+    additions_ /= 2;
+  }
+
+  std::size_t          width_;
+  std::size_t          mask_;
+  std::size_t          sample_size_;
+  std::size_t          additions_{0};
+  std::vector<uint8_t> table_;
+};
+
+}  // namespace
+
+/**
+ * A single independently locked partition of the cache
+ */
+class ExecutableCache::Shard
+{
+public:
+  explicit Shard(std::size_t capacity_bytes);
+
+  ExecutablePtr Get(ConstByteArray const &digest, std::size_t hash, uint64_t version);
+  void          Insert(ConstByteArray const &digest, std::size_t hash, uint64_t version,
+                       ExecutablePtr executable, std::size_t size);
+  void          Collect(Statistics &stats) const;
+
+private:
+  enum Segment : std::size_t
+  {
+    WINDOW = 0,
+    PROBATION,
+    PROTECTED,
+    NUM_SEGMENTS
+  };
+
+  struct Node
+  {
+    ConstByteArray digest;
+    std::size_t    hash;
+    uint64_t       version;
+    ExecutablePtr  executable;
+    std::size_t    size;
+    Segment        segment;
+  };
+
+  using NodeList = std::list<Node>;
+  using NodeIter = NodeList::iterator;
+  using Index    = std::unordered_map<ConstByteArray, NodeIter>;
+  using Mutex    = std::mutex;
+
+  std::size_t MainBytes() const
+  {
+    return bytes_[PROBATION] + bytes_[PROTECTED];
+  }
+
+  void MoveToFront(NodeIter node, Segment segment);
+  void Remove(NodeIter node);
+  void OnHit(NodeIter node);
+  void EvictFromWindow();
+  void EnforceProtectedLimit();
+
+  std::size_t const capacity_;
+  std::size_t const window_capacity_;
+  std::size_t const main_capacity_;
+  std::size_t const protected_capacity_;
+
+  mutable Mutex                         lock_;
+  FrequencySketch                       sketch_;
+  std::array<NodeList, NUM_SEGMENTS>    lists_;
+  std::array<std::size_t, NUM_SEGMENTS> bytes_{};
+  Index                                 index_;
+  uint64_t                              hits_{0};
+  uint64_t                              misses_{0};
+  uint64_t                              admitted_{0};
+  uint64_t                              rejected_{0};
+  uint64_t                              evicted_{0};
+};
+
+ExecutableCache::Shard::Shard(std::size_t capacity_bytes)
+  : capacity_{capacity_bytes}
+  , window_capacity_{(capacity_bytes * WINDOW_PERCENTAGE) / 100u}
+  , main_capacity_{capacity_bytes - window_capacity_}
+  , protected_capacity_{(main_capacity_ * PROTECTED_PERCENTAGE) / 100u}
+  , sketch_{std::min(std::max(capacity_bytes / TYPICAL_EXECUTABLE_SIZE, MIN_SKETCH_WIDTH),
+                     MAX_SKETCH_WIDTH)}
+{}
+
+/**
+ * Lookup an executable in the shard, recording the access
+ *
+ * @param digest The digest of the contract source
+ * @param hash The hash of the digest
+ * @param version The required opcode table version
+ * @return The executable if present, otherwise a null pointer
+ */
+ExecutablePtr ExecutableCache::Shard::Get(ConstByteArray const &digest, std::size_t hash,
+                                          uint64_t version)
+{
+  FETCH_LOCK(lock_);
+
+  sketch_.Increment(hash);
+
+  auto it = index_.find(digest);
+  if (it == index_.end())
+  {
+    ++misses_;
+    return {};
+  }
+
+  NodeIter node = it->second;
+  if (node->version != version)
+  {
+    // stale entries are replaced once the contract has been recompiled
+    Remove(node);
+    ++misses_;
+    return {};
+  }
+
+  OnHit(node);
+  ++hits_;
+
+  return node->executable;
+}
+
+/**
+ * Insert an executable into the window of the shard, potentially causing the least recently used
+ * window entry to be considered for admission into the main segment
+ *
+ * @param digest The digest of the contract source
+ * @param hash The hash of the digest
+ * @param version The opcode table version of the executable
+ * @param executable The executable to be cached
+ * @param size The estimated size of the executable in bytes
+ */
+void ExecutableCache::Shard::Insert(ConstByteArray const &digest, std::size_t hash,
+                                    uint64_t version, ExecutablePtr executable, std::size_t size)
+{
+  FETCH_LOCK(lock_);
+
+  // replace any existing entry (e.g. when two executors compile the same contract concurrently)
+  auto it = index_.find(digest);
+  if (it != index_.end())
+  {
+    Remove(it->second);
+  }
+
+  if (size > capacity_)
+  {
+    ++rejected_;
+    return;
+  }
+
+  auto &window = lists_[WINDOW];
+  window.push_front(Node{digest, hash, version, std::move(executable), size, WINDOW});
+  bytes_[WINDOW] += size;
+  index_.emplace(digest, window.begin());
+
+  EvictFromWindow();
+}
+
+/**
+ * Add the statistics of this shard to the specified totals
+ *
+ * @param stats The statistics to be updated
+ */
+void ExecutableCache::Shard::Collect(Statistics &stats) const
+{
+  FETCH_LOCK(lock_);
+
+  stats.hits += hits_;
+  stats.misses += misses_;
+  stats.admitted += admitted_;
+  stats.rejected += rejected_;
+  stats.evicted += evicted_;
+  stats.entries += index_.size();
+  stats.size_bytes += bytes_[WINDOW] + MainBytes();
+}
+
+void ExecutableCache::Shard::MoveToFront(NodeIter node, Segment segment)
+{
+  bytes_[node->segment] -= node->size;
+  bytes_[segment] += node->size;
+
+  lists_[segment].splice(lists_[segment].begin(), lists_[node->segment], node);
+  node->segment = segment;
+}
+
+void ExecutableCache::Shard::Remove(NodeIter node)
+{
+  bytes_[node->segment] -= node->size;
+  index_.erase(node->digest);
+  lists_[node->segment].erase(node);
+}
+
+void ExecutableCache::Shard::OnHit(NodeIter node)
+{
+  if (node->segment == PROBATION)
+  {
+    // entries which are accessed again while on probation are promoted
+    MoveToFront(node, PROTECTED);
+    EnforceProtectedLimit();
+  }
+  else
+  {
+    MoveToFront(node, node->segment);
+  }
+}
+
+void ExecutableCache::Shard::EvictFromWindow()
+{
+  auto &window    = lists_[WINDOW];
+  auto &probation = lists_[PROBATION];
+  auto &prot      = lists_[PROTECTED];
+
+  while (bytes_[WINDOW] > window_capacity_)
+  {
+    NodeIter const candidate = std::prev(window.end());
+
+    // determine the victims which would need to be evicted in order to admit the candidate,
+    // starting with the least recently used entries on probation
+    std::vector<NodeIter> victims{};
+    std::size_t           available = main_capacity_ - MainBytes();
+    bool                  admit     = true;
+
+    uint8_t const candidate_frequency = sketch_.Frequency(candidate->hash);
+
+    for (auto *list : {&probation, &prot})
+    {
+      for (auto it = list->rbegin(); (available < candidate->size) && (it != list->rend()); ++it)
+      {
+        NodeIter const victim = std::prev(it.base());
+
+        if (sketch_.Frequency(victim->hash) >= candidate_frequency)
+        {
+          admit = false;
+          break;
+        }
+
+        victims.push_back(victim);
+        available += victim->size;
+      }
+
+      if (!admit || (available >= candidate->size))
+      {
+        break;
+      }
+    }
+
+    if (admit && (available >= candidate->size))
+    {
+      for (auto const &victim : victims)
+      {
+        Remove(victim);
+        ++evicted_;
+      }
+
+      MoveToFront(candidate, PROBATION);
+      ++admitted_;
+    }
+    else
+    {
+      Remove(candidate);
+      ++rejected_;
+    }
+  }
+}
+
+void ExecutableCache::Shard::EnforceProtectedLimit()
+{
+  auto &prot = lists_[PROTECTED];
+
+  while ((bytes_[PROTECTED] > protected_capacity_) && (prot.size() > 1))
+  {
+    MoveToFront(std::prev(prot.end()), PROBATION);
+  }
+}
+
+/**
+ * Construct the executable cache
+ *
+ * @param capacity_bytes The maximum (estimated) size of all the cached executables
+ * @param log2_num_shards The log2 of the number of independently locked shards
+ * @param persistent The (optional) persistent cache of compiled contracts
+ */
+ExecutableCache::ExecutableCache(std::size_t capacity_bytes, std::size_t log2_num_shards,
+                                 CompiledContractCachePtr persistent)
+  : capacity_bytes_{capacity_bytes}
+  , persistent_{std::move(persistent)}
+{
+  std::size_t const num_shards = std::size_t{1} << log2_num_shards;
+
+  shards_.reserve(num_shards);
+  for (std::size_t i = 0; i < num_shards; ++i)
+  {
+    shards_.emplace_back(std::make_unique<Shard>(capacity_bytes / num_shards));
+  }
+}
+
+ExecutableCache::~ExecutableCache() = default;
+
+/**
+ * Lookup the executable for the specified contract. On a miss the persistent cache (if present)
+ * will be consulted.
+ *
+ * @param digest The digest of the contract source
+ * @param version The opcode table version of the VM which will run the executable
+ * @return The executable if available, otherwise a null pointer
+ */
+ExecutableCache::ExecutablePtr ExecutableCache::Get(ConstByteArray const &digest, uint64_t version)
+{
+  std::size_t hash{0};
+  Shard &     shard = LookupShard(digest, hash);
+
+  ExecutablePtr executable = shard.Get(digest, hash, version);
+
+  if (!executable && persistent_)
+  {
+    Executable loaded{};
+    if (persistent_->Get(digest, version, loaded))
+    {
+      executable = std::make_shared<Executable const>(std::move(loaded));
+      shard.Insert(digest, hash, version, executable, EstimateSize(*executable));
+
+      ++loaded_;
+    }
+  }
+
+  return executable;
+}
+
+/**
+ * Add a newly compiled executable to the cache (and the persistent cache if present)
+ *
+ * @param digest The digest of the contract source
+ * @param version The opcode table version of the VM which generated the executable
+ * @param executable The executable to be cached
+ * @return The shared immutable executable, which is valid even if it was not admitted
+ */
+ExecutableCache::ExecutablePtr ExecutableCache::Set(ConstByteArray const &digest, uint64_t version,
+                                                    Executable executable)
+{
+  auto shared = std::make_shared<Executable const>(std::move(executable));
+
+  std::size_t hash{0};
+  LookupShard(digest, hash).Insert(digest, hash, version, shared, EstimateSize(*shared));
+
+  if (persistent_)
+  {
+    persistent_->Set(digest, version, *shared);
+  }
+
+  return shared;
+}
+
+/**
+ * Get a snapshot of the cache statistics
+ *
+ * @return The current statistics
+ */
+ExecutableCache::Statistics ExecutableCache::GetStatistics() const
+{
+  Statistics stats{};
+
+  for (auto const &shard : shards_)
+  {
+    shard->Collect(stats);
+  }
+
+  stats.loaded         = loaded_.load();
+  stats.capacity_bytes = capacity_bytes_;
+
+  uint64_t const lookups = stats.hits + stats.misses;
+  if (lookups > 0)
+  {
+    stats.hit_rate = static_cast<double>(stats.hits) / static_cast<double>(lookups);
+  }
+
+  return stats;
+}
+
+/**
+ * Estimate the memory used by an executable
+ *
+ * @param executable The executable to be measured
+ * @return The estimated size in bytes
+ */
+std::size_t ExecutableCache::EstimateSize(Executable const &executable)
+{
+  // rough per element overhead of the node based containers
+  static constexpr std::size_t NODE_OVERHEAD = 4 * sizeof(void *);
+
+  std::size_t size = sizeof(Executable) + EstimateStringSize(executable.name);
+
+  for (auto const &value : executable.strings)
+  {
+    size += EstimateStringSize(value);
+  }
+
+  size += executable.constants.capacity() * sizeof(vm::Variant);
+
+  for (auto const &type : executable.types)
+  {
+    size += sizeof(type) + EstimateStringSize(type.name) +
+            (type.parameter_type_ids.capacity() * sizeof(vm::TypeId));
+  }
+
+  for (auto const &function : executable.functions)
+  {
+    size += sizeof(function) + EstimateStringSize(function.name);
+
+    for (auto const &annotation : function.annotations)
+    {
+      size += sizeof(annotation) + EstimateStringSize(annotation.name) +
+              (annotation.elements.capacity() * sizeof(vm::AnnotationElement));
+    }
+
+    for (auto const &variable : function.variables)
+    {
+      size += sizeof(variable) + EstimateStringSize(variable.name);
+    }
+
+    size += function.instructions.capacity() * sizeof(Executable::Instruction);
+    size += function.pc_to_line_map_.size() *
+            (sizeof(std::pair<uint16_t const, uint16_t>) + NODE_OVERHEAD);
+  }
+
+  for (auto const &entry : executable.function_map)
+  {
+    size += EstimateStringSize(entry.first) + sizeof(entry.second) + NODE_OVERHEAD;
+  }
+
+  return size;
+}
+
+ExecutableCache::Shard &ExecutableCache::LookupShard(ConstByteArray const &digest,
+                                                     std::size_t &   hash) const
+{
+  hash = std::hash<ConstByteArray>{}(digest);
+
+  return *shards_[hash & (shards_.size() - 1u)];
+}
+
+}  // namespace ledger
+}  // namespace fetch
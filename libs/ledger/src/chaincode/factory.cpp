@@ -21,6 +21,7 @@
 #include "core/serializers/byte_array.hpp"
 #include "core/serializers/byte_array_buffer.hpp"
 #include "ledger/chaincode/dummy_contract.hpp"
+#include "ledger/chaincode/executable_cache.hpp"
 #include "ledger/chaincode/smart_contract.hpp"
 #include "ledger/chaincode/smart_contract_manager.hpp"
 #include "ledger/chaincode/token_contract.hpp"
@@ -69,6 +70,15 @@ ContractNameSet const global_contract_set = CreateContractSet(global_registry);
 
 }  // namespace
 
+/**
+ * Construct the chain code factory
+ *
+ * @param executable_cache The (optional) shared cache of compiled smart contracts
+ */
+ChainCodeFactory::ChainCodeFactory(ExecutableCachePtr executable_cache)
+  : executable_cache_{std::move(executable_cache)}
+{}
+
 ChainCodeFactory::ContractPtr ChainCodeFactory::Create(Identifier const &contract_id,
                                                        StorageInterface &storage) const
 {
@@ -93,7 +103,8 @@ ChainCodeFactory::ContractPtr ChainCodeFactory::Create(Identifier const &contrac
       adapter >> contract_source;
 
       // attempt to construct the smart contract in question
-      contract = std::make_shared<SmartContract>(std::string{contract_source});
+      contract =
+          std::make_shared<SmartContract>(std::string{contract_source}, executable_cache_.get());
     }
   }
   else  // invalid or chain code
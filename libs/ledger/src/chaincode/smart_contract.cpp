@@ -23,6 +23,7 @@
 #include "crypto/hash.hpp"
 #include "crypto/sha256.hpp"
 #include "ledger/chain/transaction.hpp"
+#include "ledger/chaincode/executable_cache.hpp"
 #include "ledger/chaincode/smart_contract_exception.hpp"
 #include "ledger/chaincode/vm_definition.hpp"
 #include "ledger/state_adapter.hpp"
@@ -94,11 +95,11 @@ void ValidateAddressesInParams(Transaction const &tx, vm::ParameterPack const &p
  *
  * @param source Reference to the executable text
  */
-SmartContract::SmartContract(std::string const &source)
+SmartContract::SmartContract(std::string const &source, ExecutableCache *executable_cache)
   : source_{source}
   , digest_{GenerateDigest(source)}
-  , executable_{std::make_shared<Executable>()}
   , module_{vm_modules::VMFactory::GetModule()}
+  , vm_pool_{module_.get()}
 {
   if (source_.empty())
   {
@@ -111,13 +112,42 @@ SmartContract::SmartContract(std::string const &source)
   module_->CreateFreeFunctionFromLambda<uint64_t>("getBlockNumber",
                                                   [this](vm::VM *) { return block_index_; });
 
-  // create and compile the executable
-  auto errors = vm_modules::VMFactory::Compile(module_, source_, *executable_);
+  uint64_t version{0};
 
-  // if there are any compilation errors
-  if (!errors.empty())
+  // attempt to reuse a previously compiled version of the contract
+  if (executable_cache != nullptr)
   {
-    throw SmartContractException(SmartContractException::Category::COMPILATION, std::move(errors));
+    vm_modules::VMFactory::PrepareModule(module_);
+
+    version     = vm_pool_.Acquire()->GetOpcodeTableVersion();
+    executable_ = executable_cache->Get(digest_, version);
+  }
+
+  if (executable_)
+  {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Loaded compiled contract: 0x", contract_digest().ToHex());
+  }
+  else
+  {
+    // create and compile the executable
+    Executable executable{};
+    auto       errors = vm_modules::VMFactory::Compile(module_, source_, executable);
+
+    // if there are any compilation errors
+    if (!errors.empty())
+    {
+      throw SmartContractException(SmartContractException::Category::COMPILATION,
+                                   std::move(errors));
+    }
+
+    if (executable_cache != nullptr)
+    {
+      executable_ = executable_cache->Set(digest_, version, std::move(executable));
+    }
+    else
+    {
+      executable_ = std::make_shared<Executable const>(std::move(executable));
+    }
   }
 
   // since we now have a fully compiled executable we can evaluate the functions and assign the
@@ -384,7 +414,7 @@ Contract::Status SmartContract::InvokeAction(std::string const &name, Transactio
   }
 
   // Get clean VM instance
-  auto vm = vm_modules::VMFactory::GetVM(module_);
+  auto vm = vm_pool_.Acquire();
   vm->SetIOObserver(state());
 
   // lookup the function / entry point which will be executed
@@ -446,7 +476,7 @@ Contract::Status SmartContract::InvokeAction(std::string const &name, Transactio
 Contract::Status SmartContract::InvokeInit(Address const &owner)
 {
   // Get clean VM instance
-  auto vm = vm_modules::VMFactory::GetVM(module_);
+  auto vm = vm_pool_.Acquire();
   vm->SetIOObserver(state());
 
   FETCH_LOG_DEBUG(LOGGING_NAME, "Running SC init function: ", init_fn_name_);
@@ -497,7 +527,7 @@ SmartContract::Status SmartContract::InvokeQuery(std::string const &name, Query
                                                  Query &response)
 {
   // get clean VM instance
-  auto vm = vm_modules::VMFactory::GetVM(module_);
+  auto vm = vm_pool_.Acquire();
   vm->SetIOObserver(state());
 
   // lookup the executable
@@ -22,6 +22,7 @@
 #include "core/mutex.hpp"
 #include "core/threading.hpp"
 #include "ledger/executor.hpp"
+#include "metrics/registry.hpp"
 #include "storage/resource_mapper.hpp"
 
 #include "ledger/state_adapter.hpp"
@@ -50,24 +51,17 @@ ExecutionManager::ExecutionManager(std::size_t num_executors, uint32_t log2_num_
                                    StorageUnitPtr storage, ExecutorFactory const &factory)
   : log2_num_lanes_{log2_num_lanes}
   , storage_(std::move(storage))
-  , idle_executors_()
-  , thread_pool_(network::MakeThreadPool(num_executors, "Executor"))
 {
-  // setup the executor pool
-  {
-    FETCH_LOCK(idle_executors_lock_);
-
-    // ensure lists are reserved
-    idle_executors_.reserve(num_executors);
+  // ensure lists are reserved
+  workers_.reserve(num_executors);
 
-    // create the executor instances
-    for (std::size_t i = 0; i < num_executors; ++i)
-    {
-      auto executor = factory();
-      assert(static_cast<bool>(executor));
+  // create the executor instances, each of which will be pinned to a worker thread
+  for (std::size_t i = 0; i < num_executors; ++i)
+  {
+    auto executor = factory();
+    assert(static_cast<bool>(executor));
 
-      idle_executors_.emplace_back(std::move(executor));
-    }
+    workers_.emplace_back(std::make_unique<Worker>(std::move(executor)));
   }
 }
 
@@ -156,60 +150,179 @@ bool ExecutionManager::PlanExecution(Block::Body const &block)
 }
 
 /**
- * Dispatches an execution item to the next available executor
+ * Distributes the items of a slice across the local queues of the workers
  *
- * This function should be called from a context of a thread pool
+ * Items are assigned to workers based on the first lane of their lane mask, so that transactions
+ * touching the same lanes tend to be executed by the same executor. Idle workers will steal from
+ * the other queues so the overall load is balanced.
  *
- * @param item The execution item to dispatch
+ * @param slice_plan The list of items to be executed for this slice
  */
-void ExecutionManager::DispatchExecution(ExecutionItem &item)
+void ExecutionManager::ScheduleSlice(ExecutionItemList const &slice_plan)
 {
-  ExecutorPtr executor;
+  assert(!workers_.empty());
 
-  // lookup a free executor
+  std::size_t const num_workers = workers_.size();
+
+  for (auto const &item : slice_plan)
   {
-    FETCH_LOCK(idle_executors_lock_);
-    if (!idle_executors_.empty())
+    // determine the first lane that this item is associated with
+    BitVector const &shards = item->shards();
+
+    std::size_t lane{0};
+    for (std::size_t end = shards.size(); lane < end; ++lane)
     {
-      executor = idle_executors_.back();
-      idle_executors_.pop_back();
+      if (shards.bit(lane))
+      {
+        break;
+      }
     }
+
+    auto &worker = *workers_[lane % num_workers];
+
+    FETCH_LOCK(worker.lock);
+    worker.queue.push_back(item.get());
+
+    // only count the item once it can be found, otherwise idle workers would spin looking for it
+    ++pending_items_;
+  }
+
+  // wake up all the workers (under the lock, so that the wakeup can not be missed)
+  {
+    FETCH_LOCK(work_lock_);
+    work_available_.notify_all();
   }
+}
 
-  // We must have a executor present for this to work. This should always
-  // be the case provided num_executors == num_threads (in thread pool)
-  assert(executor);
+/**
+ * Retrieve the next item of work for a specified worker
+ *
+ * Items are taken first from the front of the workers own queue. If this is empty then items are
+ * stolen from the back of the queues of the other workers.
+ *
+ * @param index The index of the worker looking for work
+ * @param item The output item
+ * @return true if an item was found, otherwise false
+ */
+bool ExecutionManager::NextItem(std::size_t index, ExecutionItem *&item)
+{
+  std::size_t const num_workers = workers_.size();
 
-  if (executor)
+  for (std::size_t i = 0; i < num_workers; ++i)
   {
-    // increment the active counters
-    counters_.Apply([](Counters &counters) { counters.active++; });
+    bool const is_local = (i == 0);
+    auto &     worker   = *workers_[(index + i) % num_workers];
 
-    // execute the item
-    item.Execute(*executor);
+    FETCH_LOCK(worker.lock);
 
-    // determine what the status is
-    if (ExecutorInterface::Status::SUCCESS != item.status())
+    if (!worker.queue.empty())
     {
-      FETCH_LOG_WARN(LOGGING_NAME, "Error executing tx: 0x", item.digest().ToHex(),
-                     " status: ", ledger::ToString(item.status()));
+      if (is_local)
+      {
+        item = worker.queue.front();
+        worker.queue.pop_front();
+      }
+      else
+      {
+        item = worker.queue.back();
+        worker.queue.pop_back();
+      }
+
+      --pending_items_;
+      return true;
     }
+  }
 
-    counters_.Apply([](Counters &counters) {
-      counters.active--;
-      counters.remaining--;
-    });
+  return false;
+}
 
-    ++completed_executions_;
+/**
+ * Hint to the executor which item it is most likely to execute next
+ *
+ * The front item of the workers own queue is the next item that it will execute unless it is
+ * stolen by another worker. The executor is able to fetch the state for this item in the background
+ * while the current item is executing.
+ *
+ * @param index The index of the worker
+ * @param executor The executor pinned to the worker
+ */
+void ExecutionManager::PrefetchNextItem(std::size_t index, ExecutorInterface &executor)
+{
+  Digest    digest{};
+  BitVector shards{};
+
+  {
+    auto &worker = *workers_[index];
+
+    FETCH_LOCK(worker.lock);
 
+    if (worker.queue.empty())
     {
-      FETCH_LOCK(idle_executors_lock_);
-      idle_executors_.push_back(std::move(executor));
+      return;
     }
+
+    digest = worker.queue.front()->digest();
+    shards = worker.queue.front()->shards();
   }
-  else
+
+  executor.Prefetch(digest, shards);
+}
+
+/**
+ * Executes an item with the specified executor
+ *
+ * This function should be called from the context of a worker thread
+ *
+ * @param executor The executor pinned to the calling worker thread
+ * @param item The execution item to dispatch
+ */
+void ExecutionManager::DispatchExecution(ExecutorInterface &executor, ExecutionItem &item)
+{
+  // increment the active counters
+  counters_.Apply([](Counters &counters) { counters.active++; });
+
+  // execute the item
+  item.Execute(executor);
+
+  // determine what the status is
+  if (ExecutorInterface::Status::SUCCESS != item.status())
   {
-    FETCH_LOG_ERROR(LOGGING_NAME, "Failed to secure an idle executor");
+    FETCH_LOG_WARN(LOGGING_NAME, "Error executing tx: 0x", item.digest().ToHex(),
+                   " status: ", ledger::ToString(item.status()));
+  }
+
+  counters_.Apply([](Counters &counters) {
+    counters.active--;
+    counters.remaining--;
+  });
+
+  ++completed_executions_;
+}
+
+/**
+ * Thread process for each of the workers
+ *
+ * @param index The index of the worker
+ */
+void ExecutionManager::WorkerThreadEntrypoint(std::size_t index)
+{
+  SetThreadName("Executor", index);
+
+  auto &         executor = *workers_[index]->executor;
+  ExecutionItem *item     = nullptr;
+
+  while (running_)
+  {
+    if (NextItem(index, item))
+    {
+      PrefetchNextItem(index, executor);
+      DispatchExecution(executor, *item);
+      continue;
+    }
+
+    // wait for the next slice to be scheduled
+    std::unique_lock<Mutex> lock(work_lock_);
+    work_available_.wait(lock, [this]() { return !running_ || (pending_items_ > 0); });
   }
 }
 
@@ -239,8 +352,12 @@ void ExecutionManager::Start()
     throw std::runtime_error("Failed waiting for the monitor to start");
   }
 
-  // fire up the main worker thread pool
-  thread_pool_->Start();
+  // fire up the worker threads
+  for (std::size_t i = 0, end = workers_.size(); i < end; ++i)
+  {
+    workers_[i]->thread =
+        std::make_unique<std::thread>(&ExecutionManager::WorkerThreadEntrypoint, this, i);
+  }
 }
 
 /**
@@ -262,8 +379,21 @@ void ExecutionManager::Stop()
   monitor_thread_->join();
   monitor_thread_.reset();
 
-  // tear down the thread pool
-  thread_pool_->Stop();
+  // trigger the worker threads to wake up
+  {
+    FETCH_LOCK(work_lock_);
+    work_available_.notify_all();
+  }
+
+  // tear down the worker threads
+  for (auto &worker : workers_)
+  {
+    if (worker->thread)
+    {
+      worker->thread->join();
+      worker->thread.reset();
+    }
+  }
 }
 
 void ExecutionManager::SetLastProcessedBlock(Digest hash)
@@ -305,10 +435,24 @@ void ExecutionManager::MonitorThreadEntrypoint()
     BOOKMARKING_STATE
   };
 
+  using Clock = std::chrono::steady_clock;
+
+  auto &registry = metrics::Registry::Instance();
+  auto &block_duration =
+      registry.LookupHistogram("ledger_block_execution_duration_seconds",
+                               "The time taken to execute all the transactions of a block");
+  auto &blocks_executed =
+      registry.LookupCounter("ledger_blocks_executed_total", "The number of blocks executed");
+  auto &txs_executed = registry.LookupCounter("ledger_tx_executed_total",
+                                              "The number of transactions successfully executed");
+  auto &tx_failures = registry.LookupCounter("ledger_tx_execution_failures_total",
+                                             "The number of transactions which failed execution");
+
   MonitorState monitor_state = MonitorState::COMPLETED;
 
   std::size_t current_slice        = 0;
   uint64_t    aggregate_block_fees = 0;
+  auto        block_started        = Clock::now();
 
   Digest current_block;
 
@@ -362,6 +506,7 @@ void ExecutionManager::MonitorThreadEntrypoint()
         monitor_state        = MonitorState::SCHEDULE_NEXT_SLICE;
         current_slice        = 0;
         aggregate_block_fees = 0;
+        block_started        = Clock::now();
       }
 
       break;
@@ -380,15 +525,11 @@ void ExecutionManager::MonitorThreadEntrypoint()
         auto const &slice_plan = execution_plan_[current_slice];
 
         // determine the target number of executions being expected (must be
-        // done before the thread pool dispatch)
+        // done before the items are dispatched to the workers)
         counters_.Set(Counters{0, slice_plan.size()});
 
-        auto self = shared_from_this();
-        for (auto &item : slice_plan)
-        {
-          // create the closure and dispatch to the thread pool
-          thread_pool_->Post([self, &item]() { self->DispatchExecution(*item); });
-        }
+        // distribute the items of the slice across the workers
+        ScheduleSlice(slice_plan);
 
         monitor_state = MonitorState::RUNNING;
       }
@@ -443,6 +584,9 @@ void ExecutionManager::MonitorThreadEntrypoint()
           aggregate_block_fees += item->fee();
         }
 
+        txs_executed.Increment(num_complete);
+        tx_failures.Increment(num_errors + num_fatal_errors);
+
         // only provide debug if required
         if (num_complete + num_stalls + num_errors + num_fatal_errors)
         {
@@ -487,12 +631,12 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
     case MonitorState::SETTLE_FEES:
     {
-      FETCH_LOCK(idle_executors_lock_);
-
-      if (!idle_executors_.empty())
+      // all the slices have completed at this point so all the workers are idle and it is safe
+      // to borrow one of the executors
+      if (!workers_.empty())
       {
-        idle_executors_.front()->SettleFees(last_block_miner_, aggregate_block_fees,
-                                            log2_num_lanes_);
+        workers_.front()->executor->SettleFees(last_block_miner_, aggregate_block_fees,
+                                               log2_num_lanes_);
       }
       else
       {
@@ -506,6 +650,9 @@ void ExecutionManager::MonitorThreadEntrypoint()
 
     case MonitorState::BOOKMARKING_STATE:
       // finished processing the block
+      block_duration.Record(Clock::now() - block_started);
+      blocks_executed.Increment();
+
       monitor_state = MonitorState::IDLE;
       break;
     }
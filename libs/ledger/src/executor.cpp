@@ -33,6 +33,8 @@
 #include <algorithm>
 #include <chrono>
 #include <random>
+#include <unordered_set>
+#include <utility>
 
 static constexpr char const *LOGGING_NAME    = "Executor";
 static constexpr uint64_t    TRANSFER_CHARGE = 1;
@@ -85,18 +87,44 @@ bool IsCreateWealth(Transaction const &tx)
          (tx.chain_code() == "fetch.token") && (tx.action() == "wealth");
 }
 
+uint64_t CountAvailable(StorageInterface::Documents const &documents)
+{
+  return static_cast<uint64_t>(std::count_if(documents.begin(), documents.end(),
+                                             [](storage::Document const &doc) {
+                                               return !doc.failed;
+                                             }));
+}
+
 }  // namespace
 
 /**
  * Construct a Executor given a storage unit
  *
  * @param storage The storage unit to be used
+ * @param executable_cache The (optional) shared cache of compiled smart contracts
  */
-Executor::Executor(StorageUnitPtr storage)
+Executor::Executor(StorageUnitPtr storage, ExecutableCachePtr executable_cache)
   : storage_{std::move(storage)}
+  , chain_code_cache_{std::move(executable_cache)}
   , token_contract_{std::make_shared<TokenContract>()}
 {}
 
+Executor::~Executor()
+{
+  {
+    PrefetchLock lock{prefetch_lock_};
+    prefetch_stop_ = true;
+  }
+
+  prefetch_condition_.notify_all();
+
+  if (prefetch_thread_)
+  {
+    prefetch_thread_->join();
+    prefetch_thread_.reset();
+  }
+}
+
 /**
  * Executes a given transaction across a series of lanes
  *
@@ -119,8 +147,23 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
   allowed_shards_ = shards;
   log2_num_lanes_ = shards.log2_size();
 
-  // attempt to retrieve the transaction from the storage
-  if (!RetrieveTransaction(digest))
+  // collect the transaction and state if they have already been speculatively fetched
+  PrefetchResult prefetched{};
+  bool const     has_prefetch = CollectPrefetch(digest, prefetched);
+
+  bool tx_available{false};
+  if (has_prefetch && prefetched.tx)
+  {
+    current_tx_  = std::move(prefetched.tx);
+    tx_available = true;
+  }
+  else
+  {
+    // attempt to retrieve the transaction from the storage
+    tx_available = RetrieveTransaction(digest);
+  }
+
+  if (!tx_available)
   {
     // signal that the contract failed to be executed
     result.status = Status::TX_LOOKUP_FAILURE;
@@ -130,8 +173,16 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
     // update the charge rate
     result.charge_rate = current_tx_->charge();
 
-    // create the storage cache
+    // create the storage cache, seeded with any speculatively fetched state
     storage_cache_ = std::make_shared<CachedStorageAdapter>(*storage_);
+    if (has_prefetch)
+    {
+      storage_cache_->Populate(prefetched.keys, prefetched.documents);
+    }
+
+    // retrieve the state that the transaction is expected to access up front (unless it has already
+    // been prefetched), requiring only a single round trip to each of the lanes
+    PrefetchExpectedState();
 
     // follow the three step process for executing a transaction
     //
@@ -155,6 +206,8 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
 
     // flush the storage so that all changes are now persistent
     storage_cache_->Flush();
+
+    UpdateStatistics();
   }
 
   // clean up any used resources
@@ -163,6 +216,334 @@ Executor::Result Executor::Execute(Digest const &digest, BlockIndex block, Slice
   return result;
 }
 
+/**
+ * Speculatively fetch the transaction and the state that it is expected to access, in the
+ * background, so that it is available locally when the transaction is executed
+ *
+ * The request is handed to the prefetch worker and never blocks. Only the most recent speculation
+ * is kept: any earlier request which has not been started is replaced and any earlier result which
+ * was never used is discarded.
+ *
+ * @param digest The digest of the transaction expected to be executed next
+ * @param shards The shards that the transaction will be permitted to access
+ */
+void Executor::Prefetch(Digest const &digest, BitVector const &shards)
+{
+  {
+    PrefetchLock lock{prefetch_lock_};
+
+    // start the worker on first use, since many executors never prefetch
+    if (!prefetch_thread_)
+    {
+      prefetch_thread_ = std::make_unique<std::thread>(&Executor::PrefetchWorker, this);
+    }
+
+    // discard any earlier speculation which was never used
+    DiscardPrefetch(prefetch_result_);
+
+    prefetch_expected_ = digest;
+    prefetch_request_  = PrefetchRequest{digest, shards};
+  }
+
+  prefetch_condition_.notify_all();
+}
+
+/**
+ * Get the accumulated state access statistics for all the transactions executed
+ *
+ * @return The statistics
+ */
+Executor::Statistics Executor::GetStatistics() const
+{
+  Statistics stats{};
+  stats.hits       = hits_.load();
+  stats.misses     = misses_.load();
+  stats.prefetched = prefetched_.load();
+  stats.wasted     = wasted_.load();
+
+  return stats;
+}
+
+/**
+ * Determine the resources which a transaction is expected to access.
+ *
+ * These are the token balances of the originator and the transfer recipients along with the state
+ * keys that the target contract accessed the last time it was executed. Only the resources on the
+ * shards that the transaction is permitted to access are included.
+ *
+ * @param tx The transaction
+ * @param shards The shards that the transaction will be permitted to access
+ * @return The keys of the expected resources
+ */
+Executor::Keys Executor::ExpectedKeys(Transaction const &tx, BitVector const &shards) const
+{
+  Identifier const                    token_scope{"fetch.token"};
+  std::unordered_set<ResourceAddress> expected{};
+
+  expected.emplace(StateAdapter::CreateAddress(token_scope, tx.from().display()));
+  for (auto const &transfer : tx.transfers())
+  {
+    expected.emplace(StateAdapter::CreateAddress(token_scope, transfer.to.display()));
+  }
+
+  Identifier contract_id{};
+  Keys       learned_keys{};
+  if (GenerateContractName(tx, contract_id) && !contract_id.empty() &&
+      LookupLearnedKeys(contract_id.GetParent().full_name(), learned_keys))
+  {
+    expected.insert(learned_keys.begin(), learned_keys.end());
+  }
+
+  // restrict the resources to the shards owned by the transaction
+  Keys keys{};
+  if (shards.size() > 0)
+  {
+    uint32_t const log2_num_lanes = shards.log2_size();
+
+    for (auto const &key : expected)
+    {
+      if (shards.bit(key.lane(log2_num_lanes)))
+      {
+        keys.push_back(key);
+      }
+    }
+  }
+
+  return keys;
+}
+
+/**
+ * Background task: Retrieve the transaction and the state that it is expected to access.
+ *
+ * The resources on the shards that the transaction is permitted to access can not be modified by
+ * the other transactions of the slice which is currently executing, so the speculatively fetched
+ * values are guaranteed to be current.
+ *
+ * @param digest The digest of the transaction
+ * @param shards The shards that the transaction will be permitted to access
+ * @return The prefetched transaction and state
+ */
+Executor::PrefetchResult Executor::PrefetchState(Digest const &digest, BitVector const &shards)
+{
+  PrefetchResult result{};
+  result.digest = digest;
+
+  try
+  {
+    auto tx = std::make_shared<Transaction>();
+    if (!storage_->GetTransaction(digest, *tx))
+    {
+      return result;
+    }
+
+    result.tx   = tx;
+    result.keys = ExpectedKeys(*tx, shards);
+
+    if (!result.keys.empty())
+    {
+      result.documents = storage_->GetBatch(result.keys);
+    }
+  }
+  catch (std::exception const &ex)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, "Exception caught when prefetching tx state: ", ex.what());
+
+    result.keys.clear();
+    result.documents.clear();
+  }
+
+  return result;
+}
+
+/**
+ * Background task: Serve the prefetch requests until the executor is destroyed
+ */
+void Executor::PrefetchWorker()
+{
+  PrefetchLock lock{prefetch_lock_};
+
+  for (;;)
+  {
+    prefetch_condition_.wait(
+        lock, [this]() { return prefetch_stop_ || !prefetch_request_.digest.empty(); });
+
+    if (prefetch_stop_)
+    {
+      break;
+    }
+
+    PrefetchRequest request{};
+    std::swap(request, prefetch_request_);
+    prefetch_active_ = request.digest;
+
+    // retrieve the state without holding the lock, so that new requests are never blocked
+    lock.unlock();
+    PrefetchResult result = PrefetchState(request.digest, request.shards);
+    lock.lock();
+
+    prefetch_active_ = Digest{};
+
+    // only keep the result when the speculation is still current
+    if (result.digest == prefetch_expected_)
+    {
+      DiscardPrefetch(prefetch_result_);
+      prefetch_result_ = std::move(result);
+    }
+    else
+    {
+      DiscardPrefetch(result);
+    }
+
+    prefetch_condition_.notify_all();
+  }
+}
+
+/**
+ * Collect the speculative prefetch if it was for the specified transaction
+ *
+ * A prefetch for a different transaction is stale and is dropped without waiting for it to
+ * complete. A prefetch for the specified transaction is waited for only when the worker has
+ * already started it, otherwise it is cancelled and the state is retrieved during execution.
+ *
+ * @param digest The digest of the transaction about to be executed
+ * @param result The output prefetch result
+ * @return true if the prefetch was for the specified transaction, otherwise false
+ */
+bool Executor::CollectPrefetch(Digest const &digest, PrefetchResult &result)
+{
+  PrefetchLock lock{prefetch_lock_};
+
+  if (prefetch_expected_ != digest)
+  {
+    // the speculation was incorrect (for example the transaction was stolen by another executor)
+    prefetch_expected_ = Digest{};
+    prefetch_request_  = PrefetchRequest{};
+    DiscardPrefetch(prefetch_result_);
+
+    return false;
+  }
+
+  if (prefetch_request_.digest == digest)
+  {
+    prefetch_expected_ = Digest{};
+    prefetch_request_  = PrefetchRequest{};
+    return false;
+  }
+
+  // the worker has already started on this transaction, wait for it to complete. The transaction
+  // must remain expected until then, otherwise the worker would discard the result.
+  prefetch_condition_.wait(lock, [this, &digest]() {
+    return (prefetch_result_.digest == digest) || (prefetch_active_ != digest);
+  });
+
+  // this transaction is no longer expected, regardless of the outcome
+  prefetch_expected_ = Digest{};
+
+  if (prefetch_result_.digest != digest)
+  {
+    return false;
+  }
+
+  result           = std::move(prefetch_result_);
+  prefetch_result_ = PrefetchResult{};
+
+  if (result.keys.size() != result.documents.size())
+  {
+    DiscardPrefetch(result);
+    return false;
+  }
+
+  return true;
+}
+
+/**
+ * Internal: Drop an unused speculative prefetch, recording the state which was wasted
+ *
+ * @param result The prefetch result to be discarded
+ */
+void Executor::DiscardPrefetch(PrefetchResult &result)
+{
+  auto const num_unused = CountAvailable(result.documents);
+  prefetched_ += num_unused;
+  wasted_ += num_unused;
+
+  result = PrefetchResult{};
+}
+
+/**
+ * Record the state keys accessed by a contract, these will be used to prefetch the state for the
+ * next transaction targeting the same contract
+ *
+ * @param contract The name of the contract
+ * @param keys The state keys accessed during the execution
+ */
+void Executor::LearnContractKeys(ConstByteArray const &contract, Keys const &keys)
+{
+  auto const num_keys =
+      static_cast<std::ptrdiff_t>(std::min(keys.size(), std::size_t{MAX_LEARNED_KEYS}));
+
+  FETCH_LOCK(learned_keys_lock_);
+
+  auto it = learned_index_.find(contract);
+  if (it != learned_index_.end())
+  {
+    // move the existing entry to the front of the list
+    learned_keys_.splice(learned_keys_.begin(), learned_keys_, it->second);
+  }
+  else
+  {
+    // bound the memory usage by evicting the least recently executed contract
+    if (learned_keys_.size() >= MAX_LEARNED_CONTRACTS)
+    {
+      learned_index_.erase(learned_keys_.back().first);
+      learned_keys_.pop_back();
+    }
+
+    learned_keys_.emplace_front(contract, Keys{});
+    learned_index_.emplace(contract, learned_keys_.begin());
+  }
+
+  learned_keys_.front().second.assign(keys.begin(), keys.begin() + num_keys);
+}
+
+/**
+ * Lookup the state keys accessed the last time that a contract was executed
+ *
+ * @param contract The name of the contract
+ * @param keys The output keys
+ * @return true if the keys for the contract are known, otherwise false
+ */
+bool Executor::LookupLearnedKeys(ConstByteArray const &contract, Keys &keys) const
+{
+  FETCH_LOCK(learned_keys_lock_);
+
+  auto const it = learned_index_.find(contract);
+  if (it == learned_index_.end())
+  {
+    return false;
+  }
+
+  keys = it->second->second;
+  return true;
+}
+
+/**
+ * Accumulate the state access statistics of the transaction which has just been executed
+ */
+void Executor::UpdateStatistics()
+{
+  auto const stats = storage_cache_->GetStatistics();
+
+  hits_ += stats.hits;
+  misses_ += stats.misses;
+  prefetched_ += stats.prefetched;
+  wasted_ += stats.wasted;
+
+  FETCH_LOG_DEBUG(LOGGING_NAME, "State access for tx 0x", current_tx_->digest().ToHex(),
+                  " hits: ", stats.hits, " misses: ", stats.misses,
+                  " prefetched: ", stats.prefetched, " wasted: ", stats.wasted);
+}
+
 void Executor::SettleFees(Address const &miner, TokenAmount amount, uint32_t log2_num_lanes)
 {
   FETCH_LOG_DEBUG(LOGGING_NAME, "Settling fees");
@@ -205,6 +586,15 @@ bool Executor::RetrieveTransaction(Digest const &digest)
   return success;
 }
 
+/**
+ * Warm the storage cache with the state that the current transaction is expected to access. Any
+ * resources which have already been prefetched (including those known not to exist) are skipped.
+ */
+void Executor::PrefetchExpectedState()
+{
+  storage_cache_->Prefetch(ExpectedKeys(*current_tx_, allowed_shards_));
+}
+
 bool Executor::ValidationChecks(Result &result)
 {
   // SHORT TERM EXEMPTION - While no state file exists (and the wealth endpoint is still present)
@@ -294,6 +684,9 @@ bool Executor::ExecuteTransactionContract(Result &result)
     // detach the chain code from the current context
     contract->Detach();
 
+    // remember the state accessed so that it can be prefetched for subsequent transactions
+    LearnContractKeys(contract_id.GetParent().full_name(), storage_cache_->GetCachedKeys());
+
     // map the contract execution status
     result.status = Status::CHAIN_CODE_EXEC_FAILURE;
     switch (contract_status)
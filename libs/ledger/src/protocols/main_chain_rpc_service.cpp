@@ -28,9 +28,13 @@
 #include "metrics/metrics.hpp"
 #include "network/muddle/packet.hpp"
 
-// TODO(private 976) : This can crash the network as it's not enforced server side
-static const uint32_t MAX_CHAIN_REQUEST_SIZE = 10000;
-static const uint64_t MAX_SUB_CHAIN_SIZE     = 1000;
+static const uint32_t HEAVIEST_CHAIN_REQUEST_SIZE = 1;
+
+// Pipelined catch up configuration (the range size is shared with the server, see SYNC_RANGE_SIZE)
+static const std::size_t MAX_RANGE_REQUESTS    = 8;
+static const std::size_t MAX_BUFFERED_RANGES   = 2 * MAX_RANGE_REQUESTS;
+static const std::size_t NUM_SYNC_VERIFIERS    = 4;
+static const uint32_t    RANGE_REQUEST_TIMEOUT = 30000;  // ms
 
 namespace fetch {
 namespace ledger {
@@ -82,6 +86,7 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
   , rpc_client_("R:MChain", endpoint, Address{}, SERVICE_MAIN_CHAIN, CHANNEL_RPC)
   , state_machine_{std::make_shared<StateMachine>("MainChain", GetInitialState(mode_),
                                                   [](State state) { return ToString(state); })}
+  , verify_pool_{network::MakeThreadPool(NUM_SYNC_VERIFIERS, "MChainSync")}
 {
   // register the main chain protocol
   Add(RPC_MAIN_CHAIN, &main_chain_protocol_);
@@ -90,6 +95,7 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
   // clang-format off
   state_machine_->RegisterHandler(State::REQUEST_HEAVIEST_CHAIN,  this, &MainChainRpcService::OnRequestHeaviestChain);
   state_machine_->RegisterHandler(State::WAIT_FOR_HEAVIEST_CHAIN, this, &MainChainRpcService::OnWaitForHeaviestChain);
+  state_machine_->RegisterHandler(State::CATCHING_UP,             this, &MainChainRpcService::OnCatchingUp);
   state_machine_->RegisterHandler(State::SYNCHRONISING,           this, &MainChainRpcService::OnSynchronising);
   state_machine_->RegisterHandler(State::WAITING_FOR_RESPONSE,    this, &MainChainRpcService::OnWaitingForResponse);
   state_machine_->RegisterHandler(State::SYNCHRONISED,            this, &MainChainRpcService::OnSynchronised);
@@ -117,6 +123,13 @@ MainChainRpcService::MainChainRpcService(MuddleEndpoint &endpoint, MainChain &ch
     // dispatch the event
     OnNewBlock(from, block, transmitter);
   });
+
+  verify_pool_->Start();
+}
+
+MainChainRpcService::~MainChainRpcService()
+{
+  verify_pool_->Stop();
 }
 
 void MainChainRpcService::BroadcastBlock(MainChainRpcService::Block const &block)
@@ -197,6 +210,9 @@ char const *MainChainRpcService::ToString(State state)
   case State::WAIT_FOR_HEAVIEST_CHAIN:
     text = "Waiting for Heaviest Chain";
     break;
+  case State::CATCHING_UP:
+    text = "Catching Up";
+    break;
   case State::SYNCHRONISING:
     text = "Synchronising";
     break;
@@ -308,9 +324,9 @@ MainChainRpcService::State MainChainRpcService::OnRequestHeaviestChain()
   if (!peer.empty())
   {
     current_peer_address_ = peer;
-    current_request_ =
-        rpc_client_.CallSpecificAddress(current_peer_address_, RPC_MAIN_CHAIN,
-                                        MainChainProtocol::HEAVIEST_CHAIN, MAX_CHAIN_REQUEST_SIZE);
+    current_request_ = rpc_client_.CallSpecificAddress(current_peer_address_, RPC_MAIN_CHAIN,
+                                                       MainChainProtocol::HEAVIEST_CHAIN,
+                                                       HEAVIEST_CHAIN_REQUEST_SIZE);
 
     next_state = State::WAIT_FOR_HEAVIEST_CHAIN;
   }
@@ -336,11 +352,24 @@ MainChainRpcService::State MainChainRpcService::OnWaitForHeaviestChain()
     {
       if (PromiseState::SUCCESS == status)
       {
-        // the request was successful, simply hand off the blocks to be added to the chain
-        HandleChainResponse(current_peer_address_, current_request_->As<BlockList>());
-
-        // now we have completed a request we can start normal synchronisation
-        next_state = State::SYNCHRONISING;
+        auto           blocks       = current_request_->As<BlockList>();
+        uint64_t const local_height = chain_.GetHeaviestBlock()->body.block_number;
+
+        if (!blocks.empty() && (blocks.front().body.block_number > local_height))
+        {
+          // the peer is ahead of us, fetch the missing part of its chain in parallel
+          StartCatchUp(local_height + 1, blocks.front().body.block_number);
+
+          next_state = State::CATCHING_UP;
+        }
+        else
+        {
+          // the request was successful, simply hand off the blocks to be added to the chain
+          HandleChainResponse(current_peer_address_, std::move(blocks));
+
+          // now we have completed a request we can start normal synchronisation
+          next_state = State::SYNCHRONISING;
+        }
       }
       else
       {
@@ -361,6 +390,78 @@ MainChainRpcService::State MainChainRpcService::OnWaitForHeaviestChain()
   return next_state;
 }
 
+MainChainRpcService::State MainChainRpcService::OnCatchingUp()
+{
+  // Step 1. Collect the responses from the in flight range requests
+  auto it = range_requests_.begin();
+  while (it != range_requests_.end())
+  {
+    auto const status = it->promise->GetState();
+
+    if (PromiseState::WAITING == status)
+    {
+      if (it->deadline.IsDue())
+      {
+        FETCH_LOG_INFO(LOGGING_NAME, "Range request to: ", ToBase64(it->peer), " timed out");
+
+        retry_ranges_.emplace_back(it->start, it->end);
+        it = range_requests_.erase(it);
+      }
+      else
+      {
+        ++it;
+      }
+
+      continue;
+    }
+
+    if (PromiseState::SUCCESS == status)
+    {
+      HandleRangeResponse(*it, it->promise->As<BlockList>());
+    }
+    else
+    {
+      FETCH_LOG_INFO(LOGGING_NAME, "Range request to: ", ToBase64(it->peer),
+                     " failed. Reason: ", service::ToString(status));
+
+      retry_ranges_.emplace_back(it->start, it->end);
+    }
+
+    it = range_requests_.erase(it);
+  }
+
+  // Step 2. Add all the verified blocks which are next in sequence to the chain
+  AddVerifiedRanges();
+
+  // Step 3. Determine if the catch up has completed
+  if ((next_insert_height_ > catchup_target_) && range_requests_.empty() &&
+      (pending_verifications_ == 0))
+  {
+    double const duration =
+        std::chrono::duration_cast<std::chrono::duration<double>>(Clock::now() - catchup_start_)
+            .count();
+    double const rate = (duration > 0.0) ? (static_cast<double>(catchup_blocks_) / duration) : 0.0;
+
+    FETCH_LOG_INFO(LOGGING_NAME, "Catch up complete. Added ", catchup_blocks_, " blocks in ",
+                   duration, "s (", rate, " blocks/s)");
+
+    // clear any remaining state
+    retry_ranges_.clear();
+    {
+      FETCH_LOCK(verified_lock_);
+      verified_ranges_.clear();
+    }
+
+    // resolve any remaining missing or loose blocks with the normal synchronisation
+    return State::SYNCHRONISING;
+  }
+
+  // Step 4. Keep the pipeline full
+  IssueRangeRequests();
+
+  return State::CATCHING_UP;
+}
+
 MainChainRpcService::State MainChainRpcService::OnSynchronising()
 {
   State next_state{State::SYNCHRONISED};
@@ -449,6 +550,220 @@ MainChainRpcService::State MainChainRpcService::OnSynchronised(State current, St
   return next_state;
 }
 
+/**
+ * Reset the catch up state ready for syncing a new range of the chain
+ *
+ * @param start The block number of the first block to be requested
+ * @param target The block number of the last block to be requested
+ */
+void MainChainRpcService::StartCatchUp(uint64_t start, uint64_t target)
+{
+  FETCH_LOG_INFO(LOGGING_NAME, "Catching up from block ", start, " to ", target);
+
+  catchup_target_      = target;
+  next_request_height_ = start;
+  next_insert_height_  = start;
+  catchup_blocks_      = 0;
+  catchup_start_       = Clock::now();
+
+  range_requests_.clear();
+  retry_ranges_.clear();
+}
+
+/**
+ * Issue range requests to the directly connected peers (round robin) until either the maximum
+ * number of in flight requests or the maximum number of buffered ranges has been reached
+ */
+void MainChainRpcService::IssueRangeRequests()
+{
+  auto const peers = endpoint_.GetDirectlyConnectedPeers();
+
+  // in the case that we are not connected to anyone we need to simply wait until we are
+  if (peers.empty())
+  {
+    return;
+  }
+
+  uint64_t const max_request_height = next_insert_height_ + (MAX_BUFFERED_RANGES * SYNC_RANGE_SIZE);
+
+  while (range_requests_.size() < MAX_RANGE_REQUESTS)
+  {
+    uint64_t start{0};
+    uint64_t end{0};
+
+    if (!retry_ranges_.empty())
+    {
+      // failed requests take priority since they are blocking the insertion of later blocks
+      start = retry_ranges_.front().first;
+      end   = retry_ranges_.front().second;
+      retry_ranges_.pop_front();
+    }
+    else if ((next_request_height_ <= catchup_target_) &&
+             (next_request_height_ < max_request_height))
+    {
+      start = next_request_height_;
+      end   = std::min(start + SYNC_RANGE_SIZE - 1, catchup_target_);
+
+      next_request_height_ = end + 1;
+    }
+    else
+    {
+      break;
+    }
+
+    auto const &peer = peers[next_peer_index_++ % peers.size()];
+
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Requesting blocks ", start, " to ", end, " from muddle://",
+                    ToBase64(peer));
+
+    auto promise = rpc_client_.CallSpecificAddress(
+        peer, RPC_MAIN_CHAIN, MainChainProtocol::HEAVIEST_CHAIN_RANGE, start, end);
+
+    range_requests_.emplace_back(RangeRequest{
+        peer, start, end, std::move(promise),
+        FutureTimepoint{std::chrono::milliseconds{RANGE_REQUEST_TIMEOUT}}});
+  }
+}
+
+/**
+ * Handle the response to a range request, dispatching the blocks to the verification workers
+ *
+ * @param request The original range request
+ * @param block_list The blocks returned from the peer
+ */
+void MainChainRpcService::HandleRangeResponse(RangeRequest const &request, BlockList block_list)
+{
+  uint64_t const expected = (request.end - request.start) + 1;
+
+  // a short response means that the peer does not (or no longer) have the blocks that were
+  // originally advertised, in this case the catch up stops early and the remainder of the chain
+  // will be resolved by the normal synchronisation
+  if (block_list.size() < expected)
+  {
+    uint64_t const last_block = request.start + block_list.size();
+
+    FETCH_LOG_INFO(LOGGING_NAME, "Short range response from: ", ToBase64(request.peer),
+                   " expected: ", expected, " received: ", block_list.size());
+
+    catchup_target_ = std::min(catchup_target_, last_block - 1);
+
+    if (block_list.empty())
+    {
+      return;
+    }
+  }
+
+  ++pending_verifications_;
+  verify_pool_->Post([this, peer = request.peer, start = request.start, end = request.end,
+                      blocks = std::move(block_list)]() mutable {
+    VerifyRange(peer, start, end, std::move(blocks));
+  });
+}
+
+/**
+ * Verify a range of blocks (executed on the verification workers)
+ *
+ * In addition to checking the proof of each block, the range is checked to be a contiguous section
+ * of chain. The range is truncated at the first block which fails these checks.
+ *
+ * @param peer The peer that provided the blocks
+ * @param start The block number of the first block
+ * @param end The block number of the last block that was requested
+ * @param block_list The blocks to be verified
+ */
+void MainChainRpcService::VerifyRange(Address const &peer, uint64_t start, uint64_t end,
+                                      BlockList block_list)
+{
+  std::size_t num_valid{0};
+  for (auto &block : block_list)
+  {
+    // recompute the digest
+    block.UpdateDigest();
+
+    bool const is_next_block = (block.body.block_number == start + num_valid);
+    bool const is_linked =
+        (num_valid == 0) || (block.body.previous_hash == block_list[num_valid - 1].body.hash);
+
+    if (!(is_next_block && is_linked && IsBlockValid(block)))
+    {
+      break;
+    }
+
+    ++num_valid;
+  }
+
+  VerifiedRange range{};
+  range.peer  = peer;
+  range.end   = end;
+  range.valid = (num_valid == block_list.size());
+
+  block_list.resize(num_valid);
+  range.blocks = std::move(block_list);
+
+  {
+    FETCH_LOCK(verified_lock_);
+    verified_ranges_[start] = std::move(range);
+  }
+
+  --pending_verifications_;
+}
+
+/**
+ * Add all the verified ranges which are next in sequence to the chain
+ */
+void MainChainRpcService::AddVerifiedRanges()
+{
+  for (;;)
+  {
+    VerifiedRange range{};
+
+    // extract the next range (if it is available)
+    {
+      FETCH_LOCK(verified_lock_);
+
+      auto it = verified_ranges_.find(next_insert_height_);
+      if (verified_ranges_.end() == it)
+      {
+        break;
+      }
+
+      range = std::move(it->second);
+      verified_ranges_.erase(it);
+    }
+
+    // add the blocks to the chain in order
+    for (auto const &block : range.blocks)
+    {
+      auto const status = chain_.AddBlock(block);
+
+      if (BlockStatus::INVALID == status)
+      {
+        FETCH_LOG_DEBUG(LOGGING_NAME, "Synced invalid block: 0x", block.body.hash.ToHex(),
+                        " from: muddle://", ToBase64(range.peer));
+      }
+      else
+      {
+        ++catchup_blocks_;
+      }
+    }
+
+    // advance past the blocks that were actually received, a short (but valid) response has
+    // already lowered the catch up target so the remainder is left to the normal synchronisation
+    next_insert_height_ += range.blocks.size();
+
+    if (!range.valid)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Invalid block range received from: muddle://",
+                     ToBase64(range.peer));
+
+      trust_.AddFeedback(range.peer, p2p::TrustSubject::BLOCK, p2p::TrustQuality::LIED);
+
+      // request the invalid section of the range again (hopefully from a different peer)
+      retry_ranges_.emplace_front(next_insert_height_, range.end);
+    }
+  }
+}
+
 bool MainChainRpcService::IsBlockValid(Block &block) const
 {
   bool block_valid{false};
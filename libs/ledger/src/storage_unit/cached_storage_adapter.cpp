@@ -18,6 +18,10 @@
 
 #include "ledger/storage_unit/cached_storage_adapter.hpp"
 
+#include <algorithm>
+#include <cassert>
+#include <utility>
+
 namespace fetch {
 namespace ledger {
 
@@ -45,18 +49,25 @@ void CachedStorageAdapter::Flush()
 
   if (flush_required_)
   {
+    KeyValues key_values{};
+
     for (auto &entry : cache_)
     {
       if (!entry.second.flushed)
       {
-        // set the value on the storage engine
-        storage_.Set(entry.first, entry.second.value);
+        key_values.emplace_back(entry.first, entry.second.value);
 
         // signal the entry as flushed
         entry.second.flushed = true;
       }
     }
 
+    // set all the values on the storage engine together
+    if (!key_values.empty())
+    {
+      storage_.SetBatch(key_values);
+    }
+
     // reset the top level flush flag
     flush_required_ = false;
   }
@@ -70,9 +81,126 @@ void CachedStorageAdapter::Clear()
   FETCH_LOCK(lock_);
 
   cache_.clear();
+  absent_.clear();
   flush_required_ = false;
 }
 
+/**
+ * Populate the cache with a series of resources which are expected to be accessed. The resources
+ * which are not already cached are retrieved from the storage engine in a single batch. Unlike
+ * values retrieved with Get, prefetched values are not written back to the storage engine on Flush
+ * unless they are subsequently modified.
+ *
+ * @param keys The keys of the resources to prefetch
+ */
+void CachedStorageAdapter::Prefetch(Keys const &keys)
+{
+  Keys missing{};
+  missing.reserve(keys.size());
+
+  {
+    FETCH_LOCK(lock_);
+    for (auto const &key : keys)
+    {
+      if ((cache_.find(key) == cache_.end()) && (absent_.find(key) == absent_.end()))
+      {
+        missing.push_back(key);
+      }
+    }
+  }
+
+  if (missing.empty())
+  {
+    return;
+  }
+
+  Populate(missing, storage_.GetBatch(missing));
+}
+
+/**
+ * Populate the cache with a series of documents which have been retrieved ahead of time from the
+ * storage engine. Entries which are already present in the cache are not replaced.
+ *
+ * @param keys The keys of the resources
+ * @param documents The corresponding documents (in the same order as the keys)
+ */
+void CachedStorageAdapter::Populate(Keys const &keys, Documents const &documents)
+{
+  assert(keys.size() == documents.size());
+
+  FETCH_LOCK(lock_);
+  for (std::size_t i = 0, end = std::min(keys.size(), documents.size()); i < end; ++i)
+  {
+    if (cache_.find(keys[i]) != cache_.end())
+    {
+      continue;
+    }
+
+    if (documents[i].failed)
+    {
+      // remember the resources which are not present, so that reading them does not require
+      // another round trip to the storage engine
+      absent_.insert(keys[i]);
+    }
+    else
+    {
+      CacheEntry entry{documents[i].document, true};
+      entry.prefetched = true;
+
+      cache_.emplace(keys[i], std::move(entry));
+    }
+  }
+}
+
+/**
+ * Get the keys of all the resources which are currently cached
+ *
+ * @return The list of keys
+ */
+CachedStorageAdapter::Keys CachedStorageAdapter::GetCachedKeys() const
+{
+  FETCH_LOCK(lock_);
+
+  Keys keys{};
+  keys.reserve(cache_.size());
+
+  for (auto const &entry : cache_)
+  {
+    keys.push_back(entry.first);
+  }
+
+  return keys;
+}
+
+/**
+ * Get the access statistics for the cache
+ *
+ * @return The statistics
+ */
+CachedStorageAdapter::Statistics CachedStorageAdapter::GetStatistics() const
+{
+  FETCH_LOCK(lock_);
+
+  Statistics stats{};
+  stats.hits   = hits_;
+  stats.misses = misses_;
+
+  for (auto const &entry : cache_)
+  {
+    if (entry.second.prefetched)
+    {
+      ++stats.prefetched;
+
+      if (!entry.second.accessed)
+      {
+        ++stats.wasted;
+      }
+    }
+  }
+
+  return stats;
+}
+
 /**
  * Get a resource from the storage engine or cache
  *
@@ -89,8 +217,15 @@ CachedStorageAdapter::Document CachedStorageAdapter::Get(ResourceAddress const &
     // retrieve the document directly from the cache
     result.document = GetCacheEntry(key);
   }
+  else if (IsKnownAbsent(key))
+  {
+    // the resource has already been looked up and does not exist
+    result.failed = true;
+  }
   else
   {
+    RecordMiss();
+
     // not in the cache need to retrieve
     auto const storage_result = storage_.Get(key);
 
@@ -125,6 +260,8 @@ CachedStorageAdapter::Document CachedStorageAdapter::GetOrCreate(ResourceAddress
   }
   else
   {
+    RecordMiss();
+
     // not in the cache need to retrieve
     auto const storage_result = storage_.GetOrCreate(key);
 
@@ -187,9 +324,14 @@ void CachedStorageAdapter::AddCacheEntry(ResourceAddress const &address, StateVa
 {
   FETCH_LOCK(lock_);
 
-  // update the cache and signal that a flush is required
-  cache_[address] = CacheEntry{value};
+  // update the cache and signal that a flush is required, an existing entry keeps its access
+  // history so that prefetched values which are modified are still reported as prefetched
+  auto &entry     = cache_[address];
+  entry.value     = value;
+  entry.flushed   = false;
   flush_required_ = true;
+
+  absent_.erase(address);
 }
 
 /**
@@ -199,7 +341,7 @@ void CachedStorageAdapter::AddCacheEntry(ResourceAddress const &address, StateVa
  * @return The value being stored
  */
 CachedStorageAdapter::StateValue CachedStorageAdapter::GetCacheEntry(
-    ResourceAddress const &address) const
+    ResourceAddress const &address)
 {
   FETCH_LOCK(lock_);
 
@@ -209,7 +351,10 @@ CachedStorageAdapter::StateValue CachedStorageAdapter::GetCacheEntry(
   auto it = cache_.find(address);
   if (it != cache_.end())
   {
-    value = it->second.value;
+    value               = it->second.value;
+    it->second.accessed = true;
+
+    ++hits_;
   }
   else
   {
@@ -220,6 +365,15 @@ CachedStorageAdapter::StateValue CachedStorageAdapter::GetCacheEntry(
   return value;
 }
 
+/**
+ * Record a read which could not be served from the cache
+ */
+void CachedStorageAdapter::RecordMiss()
+{
+  FETCH_LOCK(lock_);
+  ++misses_;
+}
+
 /**
  * Determine if a resource is being stored in the cache
  *
@@ -233,5 +387,25 @@ bool CachedStorageAdapter::HasCacheEntry(ResourceAddress const &address) const
   return cache_.find(address) != cache_.end();
 }
 
+/**
+ * Determine if a resource is known not to exist in the storage engine, recording the read as a
+ * cache hit if so
+ *
+ * @param address The resource address to be checked
+ * @return true if the resource is known not to exist, otherwise false
+ */
+bool CachedStorageAdapter::IsKnownAbsent(ResourceAddress const &address)
+{
+  FETCH_LOCK(lock_);
+
+  if (absent_.find(address) == absent_.end())
+  {
+    return false;
+  }
+
+  ++hits_;
+  return true;
+}
+
 }  // namespace ledger
 }  // namespace fetch
@@ -24,6 +24,7 @@
 #include "ledger/storage_unit/lane_controller_protocol.hpp"
 #include "ledger/storage_unit/lane_identity.hpp"
 #include "ledger/storage_unit/lane_identity_protocol.hpp"
+#include "ledger/storage_unit/transaction_feed.hpp"
 #include "ledger/storage_unit/transaction_finder_protocol.hpp"
 #include "ledger/storage_unit/transaction_store_sync_protocol.hpp"
 #include "ledger/storage_unit/transaction_store_sync_service.hpp"
@@ -89,6 +90,11 @@ LaneService::LaneService(NetworkManager nm, ShardConfig config, bool sign_packet
   tx_store_protocol_ = std::make_shared<TxStoreProto>(tx_store_.get());
   internal_rpc_server_->Add(RPC_TX_STORE, tx_store_protocol_.get());
 
+  // Transaction feed to the miner
+  tx_feed_publisher_ =
+      std::make_unique<TransactionFeedPublisher>(internal_muddle_->AsEndpoint(), *tx_store_);
+  reactor_.Attach(tx_feed_publisher_->GetWeakRunnable());
+
   // Controller
   controller_          = std::make_shared<LaneController>(lane_identity_, external_muddle_);
   controller_protocol_ = std::make_shared<LaneControllerProtocol>(controller_.get());
@@ -160,6 +166,7 @@ LaneService::~LaneService()
 
   // TODO(issue 24): Remove protocol
   tx_store_protocol_.reset();
+  tx_feed_publisher_.reset();
   tx_store_.reset();
 
   tx_sync_protocol_.reset();
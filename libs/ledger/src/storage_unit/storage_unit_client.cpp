@@ -23,6 +23,9 @@
 #include "ledger/chain/transaction_rpc_serializers.hpp"
 #include "ledger/storage_unit/transaction_finder_protocol.hpp"
 
+#include <utility>
+#include <vector>
+
 using fetch::storage::ResourceID;
 using fetch::storage::RevertibleDocumentStoreProtocol;
 using fetch::muddle::MuddleEndpoint;
@@ -342,32 +345,62 @@ void StorageUnitClient::AddTransaction(Transaction const &tx)
   }
 }
 
-StorageUnitClient::TxLayouts StorageUnitClient::PollRecentTx(uint32_t max_to_poll)
+/**
+ * Add a series of transactions to the lanes. The transactions are grouped by the lane that owns
+ * them and a single SET_BULK request is made to each of the lanes, all of the requests are in
+ * flight at the same time.
+ *
+ * @param txs The transactions to be added
+ */
+void StorageUnitClient::AddTransactions(TransactionList const &txs)
 {
-  std::vector<service::Promise> promises;
-  TxLayouts                     layouts;
-
-  FETCH_LOG_DEBUG(LOGGING_NAME, "Polling recent transactions from lanes");
+  using LaneElements = TxStoreProtocol::ElementList;
 
-  // Assume that the lanes are roughly balanced in terms of new TXs
-  for (auto const &lane_address : addresses_)
+  std::vector<LaneElements> lane_elements(num_lanes());
+  for (auto const &tx : txs)
   {
-    auto promise =
-        rpc_client_.CallSpecificAddress(lane_address, RPC_TX_STORE, TxStoreProtocol::GET_RECENT,
-                                        uint32_t(max_to_poll / addresses_.size()));
-    FETCH_LOG_PROMISE();
-    promises.push_back(promise);
+    ResourceID const resource{tx->digest()};
+
+    lane_elements.at(resource.lane(log2_num_lanes_))
+        .emplace_back(TxStoreProtocol::Element{resource, *tx});
   }
 
-  for (auto const &promise : promises)
+  // dispatch all the requests to the lanes
+  std::vector<std::pair<LaneIndex, service::Promise>> promises{};
+  for (LaneIndex lane = 0; lane < lane_elements.size(); ++lane)
   {
-    auto txs = promise->As<TxLayouts>();
+    if (lane_elements[lane].empty())
+    {
+      continue;
+    }
 
-    layouts.insert(layouts.end(), std::make_move_iterator(txs.begin()),
-                   std::make_move_iterator(txs.end()));
+    try
+    {
+      promises.emplace_back(lane, rpc_client_.CallSpecificAddress(
+                                      LookupAddress(lane), RPC_TX_STORE, TxStoreProtocol::SET_BULK,
+                                      lane_elements[lane]));
+    }
+    catch (std::exception const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to add ", lane_elements[lane].size(),
+                     " transactions to lane ", lane, ", because: ", e.what());
+    }
   }
 
-  return layouts;
+  // wait for all of the lanes to complete
+  for (auto &entry : promises)
+  {
+    try
+    {
+      FETCH_LOG_PROMISE();
+      entry.second->Wait();
+    }
+    catch (std::exception const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to add ", lane_elements[entry.first].size(),
+                     " transactions to lane ", entry.first, ", because: ", e.what());
+    }
+  }
 }
 
 bool StorageUnitClient::GetTransaction(byte_array::ConstByteArray const &digest, Transaction &tx)
@@ -511,6 +544,160 @@ void StorageUnitClient::Set(ResourceAddress const &key, StateValue const &value)
   }
 }
 
+/**
+ * Get a series of documents from the lanes. The keys are grouped by the lane that owns them and a
+ * single request is made to each of the lanes, all of the requests are in flight at the same time.
+ *
+ * @param keys The keys to be retrieved
+ * @return The documents, in the same order as the keys
+ */
+StorageUnitClient::Documents StorageUnitClient::GetBatch(Keys const &keys)
+{
+  Documents documents(keys.size());
+
+  std::vector<LaneKeys>    lane_keys{};
+  std::vector<LaneIndices> lane_indices{};
+  GroupByLane(keys, lane_keys, lane_indices);
+
+  // dispatch all the requests to the lanes
+  std::vector<std::pair<LaneIndex, service::Promise>> promises{};
+  for (LaneIndex lane = 0; lane < lane_keys.size(); ++lane)
+  {
+    if (lane_keys[lane].empty())
+    {
+      continue;
+    }
+
+    try
+    {
+      promises.emplace_back(lane, rpc_client_.CallSpecificAddress(
+                                      LookupAddress(lane), RPC_STATE,
+                                      RevertibleDocumentStoreProtocol::GET_BATCH, lane_keys[lane]));
+    }
+    catch (std::runtime_error const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to request documents from lane ", lane,
+                     ", because: ", e.what());
+
+      for (auto const index : lane_indices[lane])
+      {
+        documents[index].failed = true;
+      }
+    }
+  }
+
+  // collect all of the responses
+  for (auto &entry : promises)
+  {
+    auto const &indices = lane_indices[entry.first];
+
+    try
+    {
+      FETCH_LOG_PROMISE();
+      auto const lane_documents = entry.second->As<Documents>();
+
+      if (lane_documents.size() != indices.size())
+      {
+        throw std::runtime_error("Incorrect number of documents returned");
+      }
+
+      for (std::size_t i = 0; i < indices.size(); ++i)
+      {
+        documents[indices[i]] = lane_documents[i];
+      }
+    }
+    catch (std::runtime_error const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to get documents from lane ", entry.first,
+                     ", because: ", e.what());
+
+      for (auto const index : indices)
+      {
+        documents[index].failed = true;
+      }
+    }
+  }
+
+  return documents;
+}
+
+/**
+ * Set a series of values on the lanes. The values are grouped by the lane that owns them and a
+ * single request is made to each of the lanes, all of the requests are in flight at the same time.
+ *
+ * @param key_values The keys and values to be set
+ */
+void StorageUnitClient::SetBatch(KeyValues const &key_values)
+{
+  using LaneValues = RevertibleDocumentStoreProtocol::KeyValues;
+
+  std::vector<LaneValues> lane_values(num_lanes());
+  for (auto const &key_value : key_values)
+  {
+    lane_values.at(key_value.first.lane(log2_num_lanes_))
+        .emplace_back(key_value.first.as_resource_id(), key_value.second);
+  }
+
+  // dispatch all the requests to the lanes
+  std::vector<service::Promise> promises{};
+  for (LaneIndex lane = 0; lane < lane_values.size(); ++lane)
+  {
+    if (lane_values[lane].empty())
+    {
+      continue;
+    }
+
+    try
+    {
+      promises.emplace_back(rpc_client_.CallSpecificAddress(
+          LookupAddress(lane), RPC_STATE, RevertibleDocumentStoreProtocol::SET_BATCH,
+          lane_values[lane]));
+    }
+    catch (std::runtime_error const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to call SET_BATCH on lane ", lane,
+                     ", because: ", e.what());
+    }
+  }
+
+  // wait for all of the lanes to complete
+  for (auto &promise : promises)
+  {
+    try
+    {
+      FETCH_LOG_PROMISE();
+      promise->Wait();
+    }
+    catch (std::runtime_error const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Failed to call SET_BATCH (store documents), because: ",
+                     e.what());
+    }
+  }
+}
+
+/**
+ * Internal: Group a series of keys by the lane that owns them
+ *
+ * @param keys The keys to be grouped
+ * @param lane_keys The output resource ids for each of the lanes
+ * @param lane_indices The output indices (into keys) of the resources for each of the lanes
+ */
+void StorageUnitClient::GroupByLane(Keys const &keys, std::vector<LaneKeys> &lane_keys,
+                                    std::vector<LaneIndices> &lane_indices) const
+{
+  lane_keys.assign(num_lanes(), LaneKeys{});
+  lane_indices.assign(num_lanes(), LaneIndices{});
+
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    auto const lane = keys[i].lane(log2_num_lanes_);
+
+    lane_keys.at(lane).emplace_back(keys[i].as_resource_id());
+    lane_indices.at(lane).push_back(i);
+  }
+}
+
 bool StorageUnitClient::Lock(ShardIndex index)
 {
   bool success{false};
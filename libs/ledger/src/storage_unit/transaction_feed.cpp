@@ -0,0 +1,300 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/storage_unit/transaction_feed.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
+#include "core/serializers/counter.hpp"
+#include "core/serializers/stl_types.hpp"
+#include "core/service_ids.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_layout_rpc_serializers.hpp"
+#include "network/muddle/packet.hpp"
+
+#include <algorithm>
+#include <exception>
+
+using fetch::muddle::Packet;
+
+namespace fetch {
+namespace ledger {
+namespace {
+
+using Serializer        = serializers::ByteArrayBuffer;
+using SerializerCounter = serializers::SizeCounter<Serializer>;
+
+// Subscribers which have not been heard from for this period are removed
+const std::chrono::seconds SUBSCRIBER_TIMEOUT{30};
+
+// Fallback period between checks of the store when no notification has been received
+const std::chrono::milliseconds PUBLISH_INTERVAL{1000};
+
+using AddressList = std::vector<muddle::MuddleEndpoint::Address>;
+
+AddressList GenerateAddressList(ShardConfigs const &shards)
+{
+  AddressList addresses{};
+  addresses.reserve(shards.size());
+
+  for (auto const &shard : shards)
+  {
+    addresses.emplace_back(shard.internal_identity->identity().identifier());
+  }
+
+  return addresses;
+}
+
+template <typename T>
+Packet::Payload Encode(T const &value)
+{
+  SerializerCounter counter;
+  counter << value;
+
+  Serializer serializer;
+  serializer.Reserve(counter.size());
+  serializer << value;
+
+  return serializer.data();
+}
+
+}  // namespace
+
+constexpr uint32_t TransactionFeedPublisher::MAX_BATCH_SIZE;
+constexpr uint64_t TransactionFeedSubscriber::WINDOW;
+
+/**
+ * Construct the lane side of the transaction feed
+ *
+ * @param endpoint The (internal) muddle endpoint of the lane
+ * @param store The transaction store of the lane
+ */
+TransactionFeedPublisher::TransactionFeedPublisher(MuddleEndpoint &endpoint, TxStore &store)
+  : endpoint_{endpoint}
+  , store_{store}
+  , credit_subscription_{endpoint.Subscribe(SERVICE_LANE_CTRL, CHANNEL_TX_FEED_CREDIT)}
+  , state_machine_{std::make_shared<core::StateMachine<State>>("TxFeed", State::PUBLISHING)}
+{
+  state_machine_->RegisterHandler(State::PUBLISHING, this, &TransactionFeedPublisher::OnPublishing);
+
+  credit_subscription_->SetMessageHandler([this](Address const &from, uint16_t, uint16_t, uint16_t,
+                                                 Packet::Payload const &payload, Address) {
+    try
+    {
+      Serializer            serializer{payload};
+      TransactionFeedCredit credit{};
+      serializer >> credit;
+
+      OnCredit(from, credit);
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to decode feed credit: ", ex.what());
+    }
+  });
+
+  // wake up the publisher as soon as new transactions have been seen
+  std::weak_ptr<core::StateMachine<State>> weak_state_machine = state_machine_;
+  store_.SetRecentCallback([weak_state_machine]() {
+    auto state_machine = weak_state_machine.lock();
+    if (state_machine)
+    {
+      state_machine->Notify();
+    }
+  });
+}
+
+TransactionFeedPublisher::WeakRunnable TransactionFeedPublisher::GetWeakRunnable() const
+{
+  return state_machine_;
+}
+
+/**
+ * Update the credit of a subscriber (subscribing it if necessary)
+ *
+ * @param from The address of the subscriber
+ * @param credit The credit granted by the subscriber
+ */
+void TransactionFeedPublisher::OnCredit(Address const &from, TransactionFeedCredit const &credit)
+{
+  {
+    FETCH_LOCK(subscribers_mutex_);
+
+    auto &subscriber     = subscribers_[from];
+    subscriber.credit    = std::min(subscriber.credit + credit.credit, credit.window);
+    subscriber.last_seen = Clock::now();
+  }
+
+  state_machine_->Notify();
+}
+
+TransactionFeedPublisher::State TransactionFeedPublisher::OnPublishing()
+{
+  std::vector<Address> addresses{};
+  uint64_t             budget{MAX_BATCH_SIZE};
+
+  // Step 1. Determine the number of layouts that every subscriber is able to accept
+  {
+    FETCH_LOCK(subscribers_mutex_);
+
+    auto const now = Clock::now();
+    for (auto it = subscribers_.begin(); it != subscribers_.end();)
+    {
+      if ((now - it->second.last_seen) > SUBSCRIBER_TIMEOUT)
+      {
+        FETCH_LOG_INFO(LOGGING_NAME, "Removing inactive subscriber: ", it->first.ToBase64());
+        it = subscribers_.erase(it);
+        continue;
+      }
+
+      budget = std::min(budget, it->second.credit);
+      addresses.push_back(it->first);
+      ++it;
+    }
+  }
+
+  // without subscribers or credit the layouts are left in the store, new credit notifies us
+  if (addresses.empty() || (budget == 0))
+  {
+    state_machine_->Delay(PUBLISH_INTERVAL);
+    return State::PUBLISHING;
+  }
+
+  // Step 2. Take the next batch from the store
+  auto const layouts = store_.PopRecent(static_cast<uint32_t>(budget));
+  if (layouts.empty())
+  {
+    state_machine_->Delay(PUBLISH_INTERVAL);
+    return State::PUBLISHING;
+  }
+
+  // Step 3. Send the batch to all of the subscribers
+  auto const payload = Encode(layouts);
+  for (auto const &address : addresses)
+  {
+    endpoint_.Send(address, SERVICE_LANE_CTRL, CHANNEL_TX_FEED, payload);
+  }
+
+  {
+    FETCH_LOCK(subscribers_mutex_);
+
+    for (auto const &address : addresses)
+    {
+      auto it = subscribers_.find(address);
+      if (it != subscribers_.end())
+      {
+        it->second.credit -= std::min<uint64_t>(it->second.credit, layouts.size());
+      }
+    }
+  }
+
+  // a partial batch means that the store has been drained, otherwise run again straight away
+  if (layouts.size() < budget)
+  {
+    state_machine_->Delay(PUBLISH_INTERVAL);
+  }
+
+  return State::PUBLISHING;
+}
+
+/**
+ * Construct the node side of the transaction feed
+ *
+ * @param endpoint The muddle endpoint connected to the (internal) network of the lanes
+ * @param shards The configuration of the lanes
+ */
+TransactionFeedSubscriber::TransactionFeedSubscriber(MuddleEndpoint &    endpoint,
+                                                     ShardConfigs const &shards)
+  : endpoint_{endpoint}
+  , addresses_{GenerateAddressList(shards)}
+  , feed_subscription_{endpoint.Subscribe(SERVICE_LANE_CTRL, CHANNEL_TX_FEED)}
+{
+  feed_subscription_->SetMessageHandler([this](Address const &from, uint16_t, uint16_t, uint16_t,
+                                               Packet::Payload const &payload, Address) {
+    try
+    {
+      Serializer serializer{payload};
+      TxLayouts  layouts{};
+      serializer >> layouts;
+
+      OnBatch(from, layouts);
+    }
+    catch (std::exception const &ex)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, "Unable to decode transaction feed batch: ", ex.what());
+    }
+  });
+}
+
+/**
+ * Set the handler which is called with each batch of layouts received from the lanes
+ *
+ * @param handler The handler to be called
+ */
+void TransactionFeedSubscriber::SetHandler(Handler handler)
+{
+  FETCH_LOCK(handler_mutex_);
+  handler_ = std::move(handler);
+}
+
+/**
+ * Subscribe to (or keep alive the subscription of) each of the lanes which have not sent a batch
+ * since the last refresh. Expected to be called periodically.
+ */
+void TransactionFeedSubscriber::Refresh()
+{
+  AddressSet active{};
+  {
+    FETCH_LOCK(active_mutex_);
+    std::swap(active, active_);
+  }
+
+  for (auto const &address : addresses_)
+  {
+    if (active.find(address) == active.end())
+    {
+      GrantCredit(address, WINDOW);
+    }
+  }
+}
+
+void TransactionFeedSubscriber::OnBatch(Address const &from, TxLayouts const &layouts)
+{
+  {
+    FETCH_LOCK(active_mutex_);
+    active_.insert(from);
+  }
+
+  {
+    FETCH_LOCK(handler_mutex_);
+    if (handler_)
+    {
+      handler_(layouts);
+    }
+  }
+
+  // the batch has been consumed, allow the lane to send more
+  GrantCredit(from, layouts.size());
+}
+
+void TransactionFeedSubscriber::GrantCredit(Address const &lane, uint64_t credit)
+{
+  endpoint_.Send(lane, SERVICE_LANE_CTRL, CHANNEL_TX_FEED_CREDIT,
+                 Encode(TransactionFeedCredit{credit, WINDOW}));
+}
+
+}  // namespace ledger
+}  // namespace fetch
@@ -33,74 +33,123 @@ namespace ledger {
  *
  * @param storage The reference to the storage unit
  * @param miner The reference to the system miner
+ * @param feed The feed of transactions seen by the lanes
+ * @param tx_status_cache The reference to the transaction status cache
+ * @param log2_num_lanes The log2 of the number of lanes
+ * @param num_threads The number of verification threads
  */
-TransactionProcessor::TransactionProcessor(StorageUnitInterface &  storage,
-                                           BlockPackerInterface &  packer,
-                                           TransactionStatusCache &tx_status_cache,
-                                           std::size_t             num_threads)
+TransactionProcessor::TransactionProcessor(StorageUnitInterface &     storage,
+                                           BlockPackerInterface &     packer,
+                                           TransactionFeedSubscriber &feed,
+                                           TransactionStatusCache &   tx_status_cache,
+                                           uint32_t                   log2_num_lanes,
+                                           std::size_t                num_threads)
   : storage_{storage}
   , packer_{packer}
+  , feed_{feed}
   , status_cache_{tx_status_cache}
+  , log2_num_lanes_{log2_num_lanes}
   , verifier_{*this, num_threads, "TxV-P"}
   , running_{false}
-{}
+{
+  feed_.SetHandler([this](TxLayouts const &layouts) { OnTransactionLayouts(layouts); });
+}
 
 TransactionProcessor::~TransactionProcessor()
 {
   Stop();
+  feed_.SetHandler({});
 }
 
 void TransactionProcessor::OnTransaction(TransactionPtr const &tx)
 {
-  FETCH_METRIC_TX_SUBMITTED(tx->digest());
+  OnTransactions(TransactionList{tx});
+}
 
-  FETCH_LOG_INFO(LOGGING_NAME, "Verified Input Transaction: 0x", tx->digest().ToHex());
+/**
+ * Dispatch a batch of verified transactions. The transactions are sent to the lanes with a single
+ * request per lane, after which the miner and the status cache are updated in bulk.
+ *
+ * @param txs The batch of verified transactions
+ */
+void TransactionProcessor::OnTransactions(TransactionList const &txs)
+{
+  FETCH_LOG_INFO(LOGGING_NAME, "Verified ", txs.size(), " input transactions");
 
-  // dispatch the transaction to the storage engine
+#ifdef FETCH_ENABLE_METRICS
+  for (auto const &tx : txs)
+  {
+    FETCH_METRIC_TX_SUBMITTED(tx->digest());
+  }
+#endif  // FETCH_ENABLE_METRICS
+
+  // dispatch the transactions to the storage engine
   try
   {
-    storage_.AddTransaction(*tx);
+    storage_.AddTransactions(txs);
   }
   catch (std::runtime_error const &e)
   {
     // TODO(unknown): We need to think about how we handle failures of that class.
-    FETCH_LOG_WARN(LOGGING_NAME, "Failed to add transaction to storage: ", e.what());
+    FETCH_LOG_WARN(LOGGING_NAME, "Failed to add transactions to storage: ", e.what());
     return;
   }
 
-  FETCH_METRIC_TX_STORED(tx->digest());
+  TxLayouts                       layouts{};
+  TransactionStatusCache::Digests digests{};
+  layouts.reserve(txs.size());
+  digests.reserve(txs.size());
 
-  // dispatch the summary to the miner
-  packer_.EnqueueTransaction(*tx);
+  for (auto const &tx : txs)
+  {
+    FETCH_METRIC_TX_STORED(tx->digest());
 
-  // update the status cache with the state of this transaction
-  status_cache_.Update(tx->digest(), TransactionStatus::PENDING);
+    layouts.emplace_back(*tx, log2_num_lanes_);
+    digests.emplace_back(tx->digest());
+  }
 
-  FETCH_METRIC_TX_QUEUED(tx->digest());
+  // dispatch the summaries to the miner
+  packer_.EnqueueTransactions(layouts);
+
+  // update the status cache with the state of these transactions
+  status_cache_.Update(digests, TransactionStatus::PENDING);
+
+#ifdef FETCH_ENABLE_METRICS
+  for (auto const &digest : digests)
+  {
+    FETCH_METRIC_TX_QUEUED(digest);
+  }
+#endif  // FETCH_ENABLE_METRICS
+}
+
+/**
+ * Dispatch a batch of transactions streamed from one of the lanes to the miner
+ *
+ * @param layouts The layouts of the transactions
+ */
+void TransactionProcessor::OnTransactionLayouts(TxLayouts const &layouts)
+{
+  FETCH_LOG_DEBUG(LOGGING_NAME, "Received ", layouts.size(), " transactions from shards");
+
+  packer_.EnqueueTransactions(layouts);
+
+#ifdef FETCH_ENABLE_METRICS
+  for (auto const &summary : layouts)
+  {
+    FETCH_METRIC_TX_QUEUED(summary.digest());
+  }
+#endif  // FETCH_ENABLE_METRICS
 }
 
 void TransactionProcessor::ThreadEntryPoint()
 {
-  SetThreadName("TxProc");
+  SetThreadName("TxFeed");
 
-  std::vector<TransactionLayout> new_txs;
+  // the transactions are pushed from the lanes, this thread only keeps the subscriptions alive
   while (running_)
   {
+    feed_.Refresh();
     std::this_thread::sleep_for(std::chrono::milliseconds(500));
-    new_txs.clear();
-    new_txs = storage_.PollRecentTx(10000);
-
-    if (!new_txs.empty())
-    {
-      FETCH_LOG_INFO(LOGGING_NAME, "Pulled ", new_txs.size(), " transactions from shards");
-    }
-
-    for (auto const &summary : new_txs)
-    {
-      packer_.EnqueueTransaction(summary);
-
-      FETCH_METRIC_TX_QUEUED(summary.transaction_hash);
-    }
   }
 }
 
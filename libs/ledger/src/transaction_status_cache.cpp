@@ -73,6 +73,32 @@ void TransactionStatusCache::Update(Digest digest, TransactionStatus status, Tim
   // update the cache
   cache_[digest] = Element{status, now};
 
+  PruneCacheIfRequired(now);
+}
+
+/**
+ * Update the status of a series of transactions, the cache lock is only taken once for the batch
+ *
+ * @param digests The digests of the transactions to be updated
+ * @param status The new status of the transactions
+ * @param now The current time
+ */
+void TransactionStatusCache::Update(Digests const &digests, TransactionStatus status,
+                                    Timepoint const &now)
+{
+  FETCH_LOCK(mtx_);
+
+  // update the cache
+  for (auto const &digest : digests)
+  {
+    cache_[digest] = Element{status, now};
+  }
+
+  PruneCacheIfRequired(now);
+}
+
+void TransactionStatusCache::PruneCacheIfRequired(Timepoint const &now)
+{
   // determine if we need to prune the cache
   auto const delta_prune = now - last_clean_;
   if (delta_prune > INTERVAL)
@@ -19,12 +19,16 @@
 #include "ledger/transaction_verifier.hpp"
 #include "core/logger.hpp"
 #include "core/threading.hpp"
+#include "crypto/verifier.hpp"
+#include "crypto/verifier_cache.hpp"
 #include "ledger/chain/transaction.hpp"
 #include "ledger/storage_unit/transaction_sinks.hpp"
 #include "metrics/metrics.hpp"
 #include "network/generics/milli_timer.hpp"
 
+#include <algorithm>
 #include <chrono>
+#include <unordered_map>
 
 static const std::chrono::milliseconds POP_TIMEOUT{300};
 
@@ -76,42 +80,96 @@ void TransactionVerifier::Stop()
 }
 
 /**
- * Internal: Thread process for the verification of
+ * Internal: Thread process for the verification of incoming transactions
+ *
+ * Each wakeup drains up to `batch_size_` transactions from the unverified queue so that the cost
+ * of decoding the public keys of repeat signers can be shared across the whole batch.
  */
 void TransactionVerifier::Verifier()
 {
-  TransactionPtr tx;
+  TransactionList batch{};
+  batch.reserve(batch_size_);
 
   while (active_)
   {
     try
     {
-      // wait for a mutable transaction to be available
-      if (unverified_queue_.Pop(tx, POP_TIMEOUT))
+      // wait for a mutable transaction to be available, draining any other transactions which are
+      // already waiting at the same time
+      if (unverified_queue_.Pop(batch, batch_size_, POP_TIMEOUT) > 0)
       {
-        FETCH_LOG_DEBUG(LOGGING_NAME, "Verifying TX: 0x", tx->digest().ToHex());
-
-        // check the status
-        if (tx->Verify())
-        {
-          FETCH_LOG_DEBUG(LOGGING_NAME, "TX Verify Complete: 0x", tx->digest().ToHex());
-
-          verified_queue_.Push(std::move(tx));
-        }
-        else
-        {
-          FETCH_LOG_WARN(LOGGING_NAME, name_ + " Unable to verify transaction: 0x",
-                         tx->digest().ToHex());
-        }
+        VerifyBatch(batch);
       }
     }
     catch (std::exception const &e)
     {
       FETCH_LOG_WARN(LOGGING_NAME, name_ + " Exception caught: ", e.what());
     }
+
+    batch.clear();
   }
 }
 
+/**
+ * Internal: Verify a batch of transactions, dispatching the valid ones to the verified queue
+ *
+ * @param batch The batch of transactions to be verified
+ */
+void TransactionVerifier::VerifyBatch(TransactionList &batch)
+{
+  using VerifierPtr   = crypto::VerifierCache::VerifierPtr;
+  using VerifierTable = std::unordered_map<crypto::Identity, VerifierPtr>;
+
+  // table of decoded public keys shared by all the transactions in this batch, this is populated
+  // from the process wide cache so that the cache lock is only taken once per signer per batch
+  VerifierTable verifiers{};
+
+  Transaction::VerifierLookup const lookup =
+      [&verifiers](crypto::Identity const &identity) -> crypto::Verifier & {
+    auto &verifier = verifiers[identity];
+    if (!verifier)
+    {
+      verifier = crypto::VerifierCache::Default().Lookup(identity);
+    }
+
+    return *verifier;
+  };
+
+  // partition the batch so that the verified transactions are at the front
+  auto const end = std::stable_partition(batch.begin(), batch.end(), [&](TransactionPtr &tx) {
+    FETCH_LOG_DEBUG(LOGGING_NAME, "Verifying TX: 0x", tx->digest().ToHex());
+
+    bool verified{false};
+
+    try
+    {
+      metrics::HistogramTimer const timer{verify_duration_};
+      verified = tx->Verify(lookup);
+    }
+    catch (std::exception const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, name_ + " Exception caught: ", e.what());
+    }
+
+    if (verified)
+    {
+      FETCH_LOG_DEBUG(LOGGING_NAME, "TX Verify Complete: 0x", tx->digest().ToHex());
+      verified_total_.Increment();
+    }
+    else
+    {
+      failed_total_.Increment();
+      FETCH_LOG_WARN(LOGGING_NAME, name_ + " Unable to verify transaction: 0x",
+                     tx->digest().ToHex());
+    }
+
+    return verified;
+  });
+
+  // dispatch all the verified transactions together
+  verified_queue_.Push(batch.begin(), end);
+}
+
 /**
  * Internal: Dispatch thread process for verified transactions to be sent to the storage
  * engine and the mining interface.
@@ -120,22 +178,60 @@ void TransactionVerifier::Dispatcher()
 {
   SetThreadName(name_ + "-D");
 
+  TransactionList batch{};
+  batch.reserve(batch_size_);
+
   while (active_)
   {
     try
     {
-      TransactionPtr tx;
-      if (verified_queue_.Pop(tx, POP_TIMEOUT))
+      if (verified_queue_.Pop(batch, batch_size_, POP_TIMEOUT) > 0)
       {
-        FETCH_LOG_DEBUG(LOGGING_NAME, "TX Dispatch: 0x", tx->digest().ToHex());
+        FETCH_LOG_DEBUG(LOGGING_NAME, "TX Dispatch: ", batch.size(), " transactions");
 
-        sink_.OnTransaction(tx);
+        DispatchBatch(batch);
       }
     }
     catch (std::exception const &e)
     {
       FETCH_LOG_WARN(LOGGING_NAME, name_ + " Exception caught: ", e.what());
     }
+
+    batch.clear();
+  }
+}
+
+/**
+ * Internal: Send a batch of verified transactions to the sink. Should the batch fail, the
+ * transactions are sent again one at a time so that a single bad transaction does not cause the
+ * rest of the batch to be dropped.
+ *
+ * @param batch The batch of verified transactions
+ */
+void TransactionVerifier::DispatchBatch(TransactionList const &batch)
+{
+  try
+  {
+    sink_.OnTransactions(batch);
+    return;
+  }
+  catch (std::exception const &e)
+  {
+    FETCH_LOG_WARN(LOGGING_NAME, name_ + " Batch dispatch failed, retrying individually: ",
+                   e.what());
+  }
+
+  for (auto const &tx : batch)
+  {
+    try
+    {
+      sink_.OnTransaction(tx);
+    }
+    catch (std::exception const &e)
+    {
+      FETCH_LOG_WARN(LOGGING_NAME, name_ + " Unable to dispatch transaction: 0x",
+                     tx->digest().ToHex(), " Exception caught: ", e.what());
+    }
   }
 }
 
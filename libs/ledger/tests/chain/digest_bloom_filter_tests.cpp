@@ -0,0 +1,88 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/hash.hpp"
+#include "crypto/sha256.hpp"
+#include "ledger/chain/digest_bloom_filter.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <string>
+
+namespace {
+
+using fetch::crypto::Hash;
+using fetch::crypto::SHA256;
+using fetch::ledger::Digest;
+using fetch::ledger::DigestBloomFilter;
+
+Digest CreateDigest(std::size_t index)
+{
+  return Hash<SHA256>(std::to_string(index));
+}
+
+TEST(DigestBloomFilterTests, CheckAddedDigestsAlwaysMatch)
+{
+  DigestBloomFilter filter{16};
+
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    filter.Add(CreateDigest(i));
+  }
+
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    EXPECT_TRUE(filter.Match(CreateDigest(i)));
+  }
+}
+
+TEST(DigestBloomFilterTests, CheckMostOtherDigestsDoNotMatch)
+{
+  DigestBloomFilter filter{16};
+
+  for (std::size_t i = 0; i < 1000; ++i)
+  {
+    filter.Add(CreateDigest(i));
+  }
+
+  std::size_t false_positives{0};
+  for (std::size_t i = 1000; i < 11000; ++i)
+  {
+    if (filter.Match(CreateDigest(i)))
+    {
+      ++false_positives;
+    }
+  }
+
+  // with 1000 digests in 64 Kbit the expected false positive rate is well below 1%
+  EXPECT_LT(false_positives, 100u);
+}
+
+TEST(DigestBloomFilterTests, CheckResetRemovesAllDigests)
+{
+  DigestBloomFilter filter{16};
+
+  filter.Add(CreateDigest(1));
+  ASSERT_TRUE(filter.Match(CreateDigest(1)));
+
+  filter.Reset();
+  EXPECT_FALSE(filter.Match(CreateDigest(1)));
+}
+
+}  // namespace
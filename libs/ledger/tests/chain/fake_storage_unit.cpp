@@ -104,11 +104,6 @@ void FakeStorageUnit::IssueCallForMissingTxs(DigestSet const &digests)
   FETCH_UNUSED(digests);
 }
 
-FakeStorageUnit::TxLayouts FakeStorageUnit::PollRecentTx(uint32_t)
-{
-  return {};
-}
-
 // We need to be able to set the 'hash' since it isn't calculated from any state changes
 void FakeStorageUnit::SetCurrentHash(FakeStorageUnit::Hash const &hash)
 {
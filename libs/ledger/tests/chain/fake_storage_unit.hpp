@@ -51,11 +51,6 @@ public:
   void IssueCallForMissingTxs(DigestSet const &tx_set) override;
   /// @}
 
-  /// @name Transaction History Poll
-  /// @{
-  TxLayouts PollRecentTx(uint32_t) override;
-  /// @}
-
   /// @name Revertible Document Store Interface
   /// @{
   Hash CurrentHash() override;
@@ -28,6 +28,7 @@
 #include <gtest/gtest.h>
 #include <memory>
 #include <random>
+#include <string>
 
 using namespace fetch;
 
@@ -79,6 +80,19 @@ protected:
     chain_.reset();
   }
 
+  BlockPtr GenerateWithTransaction(BlockPtr const &from, fetch::ledger::Digest const &tx)
+  {
+    auto block = generator_->Generate(from);
+
+    BitVector mask{1};
+    mask.set(0, 1);
+
+    block->body.slices[0].emplace_back(fetch::ledger::TransactionLayout{tx, mask, 1, 0, 100});
+    block->UpdateDigest();
+
+    return block;
+  }
+
   MainChainPtr      chain_;
   BlockGeneratorPtr generator_;
 };
@@ -607,6 +621,107 @@ TEST_P(MainChainTests, CheckLongChainWrite)
   }
 }
 
+TEST_P(MainChainTests, CheckHeaviestChainBeyondView)
+{
+  static constexpr std::size_t NUM_BLOCKS = (2 * MainChain::CHAIN_VIEW_DEPTH) + 50;
+
+  auto genesis        = generator_->Generate();
+  auto previous_block = genesis;
+
+  std::vector<BlockPtr> blocks{};
+  blocks.reserve(NUM_BLOCKS);
+  for (std::size_t i = 0; i < NUM_BLOCKS; ++i)
+  {
+    auto next_block = generator_->Generate(previous_block);
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*next_block));
+
+    previous_block = next_block;
+    blocks.push_back(next_block);
+  }
+
+  // the complete chain (including genesis) must be returned even though it is longer than the view
+  auto const heaviest = chain_->GetHeaviestChain();
+  ASSERT_EQ(heaviest.size(), NUM_BLOCKS + 1);
+  for (std::size_t i = 0; i < NUM_BLOCKS; ++i)
+  {
+    EXPECT_TRUE(IsSameBlock(*heaviest[i], *blocks[NUM_BLOCKS - (i + 1)]));
+  }
+  EXPECT_TRUE(IsSameBlock(*heaviest.back(), *genesis));
+
+  // create a heavier side chain branching from part way down the chain
+  auto side1 = generator_->Generate(blocks[NUM_BLOCKS - 3]);
+  auto side2 = generator_->Generate(side1);
+  auto side3 = generator_->Generate(side2);
+
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side1));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side2));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side3));
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), side3->body.hash);
+
+  auto const switched = chain_->GetHeaviestChain(5);
+  ASSERT_EQ(switched.size(), 5);
+  EXPECT_TRUE(IsSameBlock(*switched[0], *side3));
+  EXPECT_TRUE(IsSameBlock(*switched[1], *side2));
+  EXPECT_TRUE(IsSameBlock(*switched[2], *side1));
+  EXPECT_TRUE(IsSameBlock(*switched[3], *blocks[NUM_BLOCKS - 3]));
+  EXPECT_TRUE(IsSameBlock(*switched[4], *blocks[NUM_BLOCKS - 4]));
+
+  // blocks from the old heaviest chain must still be available
+  auto const old_tip = chain_->GetChainPreceding(blocks.back()->body.hash, 3);
+  ASSERT_EQ(old_tip.size(), 3);
+  EXPECT_TRUE(IsSameBlock(*old_tip[0], *blocks[NUM_BLOCKS - 1]));
+  EXPECT_TRUE(IsSameBlock(*old_tip[1], *blocks[NUM_BLOCKS - 2]));
+  EXPECT_TRUE(IsSameBlock(*old_tip[2], *blocks[NUM_BLOCKS - 3]));
+}
+
+TEST_P(MainChainTests, CheckHeaviestChainRange)
+{
+  auto genesis = generator_->Generate();
+  auto main1   = generator_->Generate(genesis);
+  auto main2   = generator_->Generate(main1);
+  auto main3   = generator_->Generate(main2);
+  auto side2   = generator_->Generate(main1);
+  auto side3   = generator_->Generate(side2);
+  auto side4   = generator_->Generate(side3);
+
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main1));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main2));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main3));
+
+  {
+    auto const range = chain_->GetHeaviestChainRange(1, 2);
+    ASSERT_EQ(range.size(), 2);
+    EXPECT_TRUE(IsSameBlock(*range[0], *main1));
+    EXPECT_TRUE(IsSameBlock(*range[1], *main2));
+  }
+
+  {
+    // the range should be clipped to the heaviest block
+    auto const range = chain_->GetHeaviestChainRange(0, 100);
+    ASSERT_EQ(range.size(), 4);
+    EXPECT_TRUE(IsSameBlock(*range[0], *genesis));
+    EXPECT_TRUE(IsSameBlock(*range[3], *main3));
+  }
+
+  EXPECT_TRUE(chain_->GetHeaviestChainRange(4, 10).empty());
+  EXPECT_TRUE(chain_->GetHeaviestChainRange(2, 1).empty());
+
+  // switch to the heavier side chain
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side2));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side3));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side4));
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), side4->body.hash);
+
+  {
+    auto const range = chain_->GetHeaviestChainRange(1, 4);
+    ASSERT_EQ(range.size(), 4);
+    EXPECT_TRUE(IsSameBlock(*range[0], *main1));
+    EXPECT_TRUE(IsSameBlock(*range[1], *side2));
+    EXPECT_TRUE(IsSameBlock(*range[2], *side3));
+    EXPECT_TRUE(IsSameBlock(*range[3], *side4));
+  }
+}
+
 TEST_P(MainChainTests, CheckInOrderWeights)
 {
   auto genesis = generator_->Generate();
@@ -688,6 +803,124 @@ TEST_P(MainChainTests, CheckResolvedLooseWeight)
   ASSERT_EQ(chain_->GetBlock(main5->body.hash)->total_weight, main5->total_weight);
 }
 
+TEST_P(MainChainTests, CheckDuplicateTransactionDetection)
+{
+  using fetch::ledger::Digest;
+  using fetch::ledger::DigestSet;
+
+  Digest const tx_main1{"Main chain transaction 1 ......."};
+  Digest const tx_main2{"Main chain transaction 2 ......."};
+  Digest const tx_side1{"Side chain transaction 1 ......."};
+  Digest const tx_other{"Other transaction .............."};
+
+  auto genesis = generator_->Generate();
+  auto main1   = GenerateWithTransaction(genesis, tx_main1);
+  auto main2   = GenerateWithTransaction(main1, tx_main2);
+  auto side1   = GenerateWithTransaction(genesis, tx_side1);
+
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main1));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*main2));
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*side1));
+  ASSERT_EQ(chain_->GetHeaviestBlockHash(), main2->body.hash);
+
+  DigestSet const candidates{tx_main1, tx_main2, tx_side1, tx_other};
+
+  // check from the heaviest tip
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main2->body.hash, candidates),
+            (DigestSet{tx_main1, tx_main2}));
+
+  // check from part way down the heaviest chain
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main1->body.hash, candidates),
+            (DigestSet{tx_main1}));
+
+  // check from the side chain
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(side1->body.hash, candidates),
+            (DigestSet{tx_side1}));
+
+  // removing the block should also remove its transactions
+  ASSERT_TRUE(chain_->RemoveBlock(main2->body.hash));
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(main1->body.hash, candidates),
+            (DigestSet{tx_main1}));
+  EXPECT_TRUE(chain_->DetectDuplicateTransactions(main1->body.hash, DigestSet{tx_main2}).empty());
+}
+
+TEST_P(MainChainTests, CheckDuplicateTransactionDetectionOfStoredBlocks)
+{
+  using fetch::ledger::Digest;
+  using fetch::ledger::DigestSet;
+  using fetch::ledger::FINALITY_PERIOD;
+
+  Digest const tx_first{"First transaction .............."};
+  Digest const tx_other{"Other transaction .............."};
+
+  auto genesis = generator_->Generate();
+  auto first   = GenerateWithTransaction(genesis, tx_first);
+  ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*first));
+
+  // build enough blocks on top that the first block is flushed and trimmed from the cache
+  BlockPtr block = first;
+  for (uint64_t i = 0; i < (4 * FINALITY_PERIOD); ++i)
+  {
+    block = generator_->Generate(block);
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*block));
+  }
+
+  DigestSet const candidates{tx_first, tx_other};
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(block->body.hash, candidates),
+            (DigestSet{tx_first}));
+
+  if (MainChain::Mode::CREATE_PERSISTENT_DB == GetParam())
+  {
+    // the stored index should still be available once the chain has been reloaded
+    chain_.reset();
+    chain_ = std::make_unique<MainChain>(MainChain::Mode::LOAD_PERSISTENT_DB);
+
+    auto const heaviest = chain_->GetHeaviestBlockHash();
+    EXPECT_EQ(chain_->DetectDuplicateTransactions(heaviest, candidates), (DigestSet{tx_first}));
+  }
+}
+
+TEST_P(MainChainTests, CheckTransactionIndexOnlyCoversCachedBlocks)
+{
+  using fetch::ledger::Digest;
+  using fetch::ledger::DigestSet;
+  using fetch::ledger::FINALITY_PERIOD;
+
+  static constexpr uint64_t NUM_BLOCKS = 4 * FINALITY_PERIOD;
+
+  auto genesis = generator_->Generate();
+
+  // build a chain where every block contains a single transaction
+  DigestSet transactions{};
+  BlockPtr  block = genesis;
+  for (uint64_t i = 0; i < NUM_BLOCKS; ++i)
+  {
+    std::string text = "Transaction " + std::to_string(i) + " ";
+    text.resize(32, '.');
+
+    Digest const tx{text};
+
+    block = GenerateWithTransaction(block, tx);
+    ASSERT_EQ(BlockStatus::ADDED, chain_->AddBlock(*block));
+
+    transactions.insert(tx);
+  }
+
+  if (MainChain::Mode::IN_MEMORY_DB == GetParam())
+  {
+    // without a block store every block stays in the cache
+    EXPECT_EQ(chain_->GetTransactionIndexSize(), NUM_BLOCKS);
+  }
+  else
+  {
+    // blocks written to the block store are removed from the in-memory index
+    EXPECT_LE(chain_->GetTransactionIndexSize(), FINALITY_PERIOD + 1);
+  }
+
+  // all the transactions must still be detected
+  EXPECT_EQ(chain_->DetectDuplicateTransactions(block->body.hash, transactions), transactions);
+}
+
 INSTANTIATE_TEST_CASE_P(ParamBased, MainChainTests,
                         ::testing::Values(MainChain::Mode::CREATE_PERSISTENT_DB,
                                           MainChain::Mode::IN_MEMORY_DB), );
@@ -46,8 +46,6 @@ public:
     ON_CALL(*this, HasTransaction(_))
         .WillByDefault(Invoke(&fake, &FakeStorageUnit::HasTransaction));
 
-    ON_CALL(*this, PollRecentTx(_)).WillByDefault(Invoke(&fake, &FakeStorageUnit::PollRecentTx));
-
     ON_CALL(*this, CurrentHash()).WillByDefault(Invoke(&fake, &FakeStorageUnit::CurrentHash));
     ON_CALL(*this, LastCommitHash()).WillByDefault(Invoke(&fake, &FakeStorageUnit::LastCommitHash));
     ON_CALL(*this, RevertToHash(_, _)).WillByDefault(Invoke(&fake, &FakeStorageUnit::RevertToHash));
@@ -66,8 +64,6 @@ public:
   MOCK_METHOD1(HasTransaction, bool(Digest const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(DigestSet const &));
 
-  MOCK_METHOD1(PollRecentTx, TxLayouts(uint32_t));
-
   MOCK_METHOD0(CurrentHash, Hash());
   MOCK_METHOD0(LastCommitHash, Hash());
   MOCK_METHOD2(RevertToHash, bool(Hash const &, uint64_t));
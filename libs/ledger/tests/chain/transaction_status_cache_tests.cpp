@@ -124,6 +124,27 @@ TEST_F(TransactionStatusCacheTests, CheckPruning)
   EXPECT_EQ(TransactionStatus::EXECUTED, cache_->Query(tx3));
 }
 
+TEST_F(TransactionStatusCacheTests, CheckBatchUpdate)
+{
+  auto tx1 = GenerateDigest();
+  auto tx2 = GenerateDigest();
+  auto tx3 = GenerateDigest();
+
+  cache_->Update(TransactionStatusCache::Digests{tx1, tx2}, TransactionStatus::PENDING);
+
+  EXPECT_EQ(TransactionStatus::PENDING, cache_->Query(tx1));
+  EXPECT_EQ(TransactionStatus::PENDING, cache_->Query(tx2));
+  EXPECT_EQ(TransactionStatus::UNKNOWN, cache_->Query(tx3));
+
+  Timepoint const future_time_point = Clock::now() + std::chrono::hours{25};
+  cache_->Update(TransactionStatusCache::Digests{tx2, tx3}, TransactionStatus::MINED,
+                 future_time_point);
+
+  EXPECT_EQ(TransactionStatus::UNKNOWN, cache_->Query(tx1));
+  EXPECT_EQ(TransactionStatus::MINED, cache_->Query(tx2));
+  EXPECT_EQ(TransactionStatus::MINED, cache_->Query(tx3));
+}
+
 TEST_F(TransactionStatusCacheTests, CheckStatusStrings)
 {
   EXPECT_STREQ("Unknown", ToString(TransactionStatus::UNKNOWN));
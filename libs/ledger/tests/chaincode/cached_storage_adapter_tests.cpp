@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/storage_unit/cached_storage_adapter.hpp"
+#include "mock_storage_unit.hpp"
+
+#include <gmock/gmock.h>
+
+#include <memory>
+
+namespace {
+
+using ::testing::_;
+using fetch::ledger::CachedStorageAdapter;
+using fetch::storage::ResourceAddress;
+
+using MockStorageUnitPtr = std::unique_ptr<MockStorageUnit>;
+
+class CachedStorageAdapterTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    storage_ = std::make_unique<MockStorageUnit>();
+  }
+
+  MockStorageUnitPtr storage_;
+};
+
+TEST_F(CachedStorageAdapterTests, CheckPrefetchedValuesAreServedFromCache)
+{
+  ResourceAddress const present{"foo.state.present"};
+  ResourceAddress const missing{"foo.state.missing"};
+
+  storage_->GetFake().Set(present, "value");
+
+  CachedStorageAdapter cache{*storage_};
+
+  // both resources are requested from the storage engine during the prefetch
+  EXPECT_CALL(*storage_, Get(present)).Times(1);
+  EXPECT_CALL(*storage_, Get(missing)).Times(1);
+  EXPECT_CALL(*storage_, Set(_, _)).Times(0);
+
+  cache.Prefetch({present, missing});
+
+  // the present resource must be served from the cache
+  auto const doc = cache.Get(present);
+  EXPECT_FALSE(doc.failed);
+  EXPECT_EQ(doc.document, "value");
+
+  // prefetching a resource which is already cached does not cause a further lookup
+  cache.Prefetch({present});
+
+  // unmodified prefetched values are never written back to the storage engine
+  cache.Flush();
+}
+
+TEST_F(CachedStorageAdapterTests, CheckModifiedPrefetchedValuesAreFlushed)
+{
+  ResourceAddress const address{"foo.state.value"};
+
+  storage_->GetFake().Set(address, "original");
+
+  CachedStorageAdapter cache{*storage_};
+
+  EXPECT_CALL(*storage_, Get(address)).Times(1);
+  EXPECT_CALL(*storage_, Set(address, fetch::byte_array::ConstByteArray{"updated"})).Times(1);
+
+  cache.Prefetch({address});
+  cache.Set(address, "updated");
+  cache.Flush();
+}
+
+TEST_F(CachedStorageAdapterTests, CheckPrefetchedMissingValuesAreNotRequestedAgain)
+{
+  ResourceAddress const missing{"foo.state.missing"};
+
+  CachedStorageAdapter cache{*storage_};
+
+  // the resource is only requested from the storage engine during the prefetch
+  EXPECT_CALL(*storage_, Get(missing)).Times(1);
+
+  cache.Prefetch({missing});
+  cache.Prefetch({missing});
+
+  EXPECT_TRUE(cache.Get(missing).failed);
+
+  // once written the resource is served from the cache
+  cache.Set(missing, "created");
+  auto const doc = cache.Get(missing);
+  EXPECT_FALSE(doc.failed);
+  EXPECT_EQ(doc.document, "created");
+
+  EXPECT_EQ(cache.GetStatistics().misses, 0u);
+}
+
+TEST_F(CachedStorageAdapterTests, CheckStatisticsTrackPrefetchUsage)
+{
+  ResourceAddress const used{"foo.state.used"};
+  ResourceAddress const unused{"foo.state.unused"};
+  ResourceAddress const other{"foo.state.other"};
+
+  storage_->GetFake().Set(other, "other");
+
+  CachedStorageAdapter cache{*storage_};
+
+  // the prefetched values are provided externally so no lookups should be made for them
+  EXPECT_CALL(*storage_, Get(used)).Times(0);
+  EXPECT_CALL(*storage_, Get(unused)).Times(0);
+  EXPECT_CALL(*storage_, Get(other)).Times(1);
+
+  fetch::storage::Document used_doc{};
+  used_doc.document = "used";
+
+  fetch::storage::Document unused_doc{};
+  unused_doc.document = "unused";
+
+  cache.Populate({used, unused}, {used_doc, unused_doc});
+
+  EXPECT_EQ(cache.Get(used).document, "used");
+  EXPECT_EQ(cache.Get(used).document, "used");
+  EXPECT_EQ(cache.Get(other).document, "other");
+
+  auto const stats = cache.GetStatistics();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.prefetched, 2u);
+  EXPECT_EQ(stats.wasted, 1u);
+
+  EXPECT_EQ(cache.GetCachedKeys().size(), 3u);
+}
+
+}  // namespace
@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "test_executable.hpp"
+
+#include <gtest/gtest.h>
+
+#include <memory>
+#include <string>
+
+namespace {
+
+using fetch::ledger::CompiledContractCache;
+using fetch::vm::Executable;
+
+using CompiledContractCachePtr = std::unique_ptr<CompiledContractCache>;
+
+constexpr char const *PREFIX  = "compiled_contract_cache_test";
+constexpr uint64_t    VERSION = 0x1234;
+
+class CompiledContractCacheTests : public ::testing::Test
+{
+protected:
+  void SetUp() override
+  {
+    cache_ = std::make_unique<CompiledContractCache>();
+    cache_->New(PREFIX);
+  }
+
+  CompiledContractCachePtr cache_;
+};
+
+TEST_F(CompiledContractCacheTests, CheckStoredExecutableIsRetrieved)
+{
+  auto const digest = CreateDigest("function main() endfunction");
+
+  cache_->Set(digest, VERSION, CreateExecutable());
+
+  Executable executable{};
+  ASSERT_TRUE(cache_->Get(digest, VERSION, executable));
+
+  EXPECT_EQ(executable.name, "contract");
+  ASSERT_EQ(executable.strings.size(), 1u);
+  EXPECT_EQ(executable.strings[0], "hello");
+
+  auto const *function = executable.FindFunction("main");
+  ASSERT_NE(function, nullptr);
+  EXPECT_EQ(function->num_variables, 1);
+  ASSERT_EQ(function->instructions.size(), 2u);
+  EXPECT_EQ(function->instructions[0].opcode, fetch::vm::Opcodes::PushString);
+  EXPECT_EQ(function->FindLineNumber(1), 1u);
+
+  auto const stats = cache_->GetStatistics();
+  EXPECT_EQ(stats.hits, 1u);
+  EXPECT_EQ(stats.misses, 0u);
+}
+
+TEST_F(CompiledContractCacheTests, CheckVersionMismatchIsAMiss)
+{
+  auto const digest = CreateDigest("function main() endfunction");
+
+  cache_->Set(digest, VERSION, CreateExecutable());
+
+  Executable executable{};
+  EXPECT_FALSE(cache_->Get(digest, VERSION + 1, executable));
+  EXPECT_FALSE(cache_->Get(CreateDigest("function other() endfunction"), VERSION, executable));
+
+  auto const stats = cache_->GetStatistics();
+  EXPECT_EQ(stats.hits, 0u);
+  EXPECT_EQ(stats.misses, 1u);
+  EXPECT_EQ(stats.stale, 1u);
+}
+
+TEST_F(CompiledContractCacheTests, CheckExecutablesArePersisted)
+{
+  auto const digest = CreateDigest("function main() endfunction");
+
+  cache_->Set(digest, VERSION, CreateExecutable());
+  cache_.reset();
+
+  // reopen the cache from disk
+  CompiledContractCache cache{};
+  cache.Load(PREFIX);
+
+  Executable executable{};
+  ASSERT_TRUE(cache.Get(digest, VERSION, executable));
+  EXPECT_EQ(executable.functions.size(), 1u);
+}
+
+}  // namespace
@@ -0,0 +1,173 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "ledger/chaincode/compiled_contract_cache.hpp"
+#include "ledger/chaincode/executable_cache.hpp"
+#include "test_executable.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::ledger::CompiledContractCache;
+using fetch::ledger::ExecutableCache;
+using fetch::vm::Executable;
+
+constexpr uint64_t VERSION = 0x1234;
+
+std::size_t const EXECUTABLE_SIZE = ExecutableCache::EstimateSize(CreateExecutable());
+
+// emulate the contract construction: lookup and on a miss compile and store the executable
+ExecutableCache::ExecutablePtr Load(ExecutableCache &cache, std::size_t index)
+{
+  auto const digest     = CreateDigest(index);
+  auto       executable = cache.Get(digest, VERSION);
+
+  if (!executable)
+  {
+    executable = cache.Set(digest, VERSION, CreateExecutable());
+  }
+
+  return executable;
+}
+
+TEST(ExecutableCacheTests, CheckExecutablesAreShared)
+{
+  ExecutableCache cache{};
+
+  auto const digest = CreateDigest(0);
+
+  EXPECT_FALSE(cache.Get(digest, VERSION));
+
+  auto const stored = cache.Set(digest, VERSION, CreateExecutable());
+  ASSERT_TRUE(stored);
+
+  // all lookups return the same immutable instance
+  EXPECT_EQ(cache.Get(digest, VERSION), stored);
+  EXPECT_EQ(cache.Get(digest, VERSION), stored);
+
+  // an executable generated for a different opcode table is discarded
+  EXPECT_FALSE(cache.Get(digest, VERSION + 1));
+  EXPECT_FALSE(cache.Get(digest, VERSION));
+
+  auto const stats = cache.GetStatistics();
+  EXPECT_EQ(stats.hits, 2u);
+  EXPECT_EQ(stats.misses, 3u);
+  EXPECT_EQ(stats.entries, 0u);
+  EXPECT_EQ(stats.size_bytes, 0u);
+  EXPECT_DOUBLE_EQ(stats.hit_rate, 0.4);
+}
+
+TEST(ExecutableCacheTests, CheckSizeIsBounded)
+{
+  static constexpr std::size_t NUM_CONTRACTS = 100;
+
+  ExecutableCache cache{10 * EXECUTABLE_SIZE, 0};
+
+  for (std::size_t i = 0; i < NUM_CONTRACTS; ++i)
+  {
+    EXPECT_TRUE(Load(cache, i));
+  }
+
+  auto const stats = cache.GetStatistics();
+  EXPECT_LE(stats.size_bytes, stats.capacity_bytes);
+  EXPECT_EQ(stats.size_bytes, stats.entries * EXECUTABLE_SIZE);
+  EXPECT_EQ(stats.evicted + stats.rejected, NUM_CONTRACTS - stats.entries);
+  EXPECT_GT(stats.entries, 0u);
+}
+
+TEST(ExecutableCacheTests, CheckFrequentlyUsedEntriesSurviveScans)
+{
+  ExecutableCache cache{8 * EXECUTABLE_SIZE, 0};
+
+  auto const hot = Load(cache, 0);
+  for (std::size_t i = 0; i < 10; ++i)
+  {
+    EXPECT_EQ(Load(cache, 0), hot);
+  }
+
+  // a scan of contracts which are only used once must not displace the popular contract
+  for (std::size_t i = 1; i <= 100; ++i)
+  {
+    Load(cache, i);
+  }
+
+  EXPECT_EQ(cache.Get(CreateDigest(0), VERSION), hot);
+  EXPECT_GT(cache.GetStatistics().rejected, 0u);
+}
+
+TEST(ExecutableCacheTests, CheckPersistentCacheIsConsulted)
+{
+  auto persistent = std::make_shared<CompiledContractCache>();
+  persistent->New("executable_cache_test");
+
+  {
+    ExecutableCache cache{ExecutableCache::DEFAULT_CAPACITY_BYTES, 0, persistent};
+    Load(cache, 0);
+  }
+
+  ExecutableCache cache{ExecutableCache::DEFAULT_CAPACITY_BYTES, 0, persistent};
+
+  auto const executable = cache.Get(CreateDigest(0), VERSION);
+  ASSERT_TRUE(executable);
+  EXPECT_EQ(executable->name, "contract");
+
+  // subsequent lookups are served from memory
+  EXPECT_EQ(cache.Get(CreateDigest(0), VERSION), executable);
+
+  auto const stats = cache.GetStatistics();
+  EXPECT_EQ(stats.loaded, 1u);
+  EXPECT_EQ(stats.hits, 1u);
+}
+
+TEST(ExecutableCacheTests, CheckConcurrentAccess)
+{
+  static constexpr std::size_t NUM_THREADS   = 4;
+  static constexpr std::size_t NUM_LOOKUPS   = 1000;
+  static constexpr std::size_t NUM_CONTRACTS = 32;
+
+  ExecutableCache cache{16 * EXECUTABLE_SIZE, 2};
+
+  std::vector<std::thread> threads;
+  for (std::size_t t = 0; t < NUM_THREADS; ++t)
+  {
+    threads.emplace_back([&cache, t]() {
+      for (std::size_t i = 0; i < NUM_LOOKUPS; ++i)
+      {
+        EXPECT_TRUE(Load(cache, ((i * 7) + t) % NUM_CONTRACTS));
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  auto const stats = cache.GetStatistics();
+  EXPECT_EQ(stats.hits + stats.misses, NUM_THREADS * NUM_LOOKUPS);
+  EXPECT_LE(stats.size_bytes, stats.capacity_bytes);
+}
+
+}  // namespace
@@ -167,12 +167,6 @@ public:
     return true;
   };
 
-  // Does nothing
-  TxLayouts PollRecentTx(uint32_t) override
-  {
-    return {};
-  }
-
 private:
   mutex_type             mutex_;
   transaction_store_type transactions_;
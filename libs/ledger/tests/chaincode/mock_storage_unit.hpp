@@ -47,7 +47,6 @@ public:
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::AddTransaction));
     ON_CALL(*this, GetTransaction(_, _))
         .WillByDefault(Invoke(&fake_, &FakeStorageUnit::GetTransaction));
-    ON_CALL(*this, PollRecentTx(_)).WillByDefault(Invoke(&fake_, &FakeStorageUnit::PollRecentTx));
   }
 
   MOCK_METHOD1(Get, Document(ResourceAddress const &));
@@ -67,8 +66,6 @@ public:
   MOCK_METHOD1(HasTransaction, bool(fetch::byte_array::ConstByteArray const &));
   MOCK_METHOD1(IssueCallForMissingTxs, void(fetch::ledger::DigestSet const &));
 
-  MOCK_METHOD1(PollRecentTx, TxLayouts(uint32_t));
-
   FakeStorageUnit &GetFake()
   {
     return fake_;
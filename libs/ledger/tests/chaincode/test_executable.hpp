@@ -0,0 +1,77 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/sha256.hpp"
+#include "vm/generator.hpp"
+#include "vm/opcodes.hpp"
+
+#include <cstddef>
+#include <string>
+
+/**
+ * Create the digest which identifies a contract with the given source
+ *
+ * @param source The source of the contract
+ * @return The digest of the source
+ */
+inline fetch::byte_array::ConstByteArray CreateDigest(std::string const &source)
+{
+  fetch::crypto::SHA256 hash;
+  hash.Update(source);
+  return hash.Final();
+}
+
+/**
+ * Create the digest which identifies the index-th test contract
+ *
+ * @param index The index of the contract
+ * @return The digest of the contract
+ */
+inline fetch::byte_array::ConstByteArray CreateDigest(std::size_t index)
+{
+  return CreateDigest("contract " + std::to_string(index));
+}
+
+/**
+ * Create a small executable with a single main function, as the compiler would produce for a
+ * contract
+ *
+ * @return The executable
+ */
+inline fetch::vm::Executable CreateExecutable()
+{
+  using fetch::vm::Executable;
+
+  Executable executable{"contract"};
+  executable.strings.emplace_back("hello");
+
+  Executable::Function function{"main", {}, 0, fetch::vm::TypeIds::Void};
+  function.AddVariable("value", fetch::vm::TypeIds::Int32, 1);
+
+  Executable::Instruction instruction{fetch::vm::Opcodes::PushString};
+  instruction.index = 0;
+  function.AddInstruction(instruction);
+  function.AddInstruction(Executable::Instruction{fetch::vm::Opcodes::Return});
+  function.pc_to_line_map_[0] = 1;
+
+  executable.AddFunction(function);
+
+  return executable;
+}
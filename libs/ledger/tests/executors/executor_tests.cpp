@@ -0,0 +1,310 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/executor.hpp"
+
+#include "mock_storage_unit.hpp"
+
+#include <gmock/gmock.h>
+
+#include <chrono>
+#include <cstddef>
+#include <future>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace {
+
+using fetch::BitVector;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::Digest;
+using fetch::ledger::Executor;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+using fetch::storage::ResourceAddress;
+using ::testing::_;
+using ::testing::Invoke;
+
+using Status         = Executor::Status;
+using StorageUnit    = MockStorageUnit;
+using StorageUnitPtr = std::shared_ptr<StorageUnit>;
+using TransactionPtr = std::shared_ptr<Transaction const>;
+using Clock          = std::chrono::steady_clock;
+
+/**
+ * Executor which exposes the learned contract keys
+ */
+class TestExecutor : public Executor
+{
+public:
+  using Executor::Executor;
+  using Executor::LearnContractKeys;
+  using Executor::LookupLearnedKeys;
+};
+
+using ExecutorPtr = std::unique_ptr<TestExecutor>;
+
+class ExecutorTests : public ::testing::Test
+{
+protected:
+  static constexpr uint64_t BALANCE = 1000;
+
+  void SetUp() override
+  {
+    storage_  = std::make_shared<StorageUnit>();
+    executor_ = std::make_unique<TestExecutor>(storage_);
+
+    shards_.set(0, 1);
+  }
+
+  void TearDown() override
+  {
+    executor_.reset();
+    storage_.reset();
+  }
+
+  /**
+   * Create (and store) a transfer between two funded accounts
+   */
+  TransactionPtr CreateTransfer()
+  {
+    ECDSASigner const signer{};
+    Address const     from{signer.identity()};
+    Address const     to{ECDSASigner{}.identity()};
+
+    auto tx = TransactionBuilder()
+                  .From(from)
+                  .Transfer(to, 10)
+                  .ValidUntil(100)
+                  .ChargeRate(1)
+                  .ChargeLimit(10)
+                  .Signer(signer.identity())
+                  .Seal()
+                  .Sign(signer)
+                  .Build();
+
+    // both of the token balances exist before the transaction is executed
+    executor_->SettleFees(from, BALANCE, 0);
+    executor_->SettleFees(to, BALANCE, 0);
+    storage_->GetFake().AddTransaction(*tx);
+
+    return tx;
+  }
+
+  /**
+   * Block the transaction lookups for the specified transaction until they are released, returning
+   * a future which is ready once the first lookup has started
+   */
+  std::future<void> HoldTransactionLookup(Digest const &digest)
+  {
+    started_ = std::make_shared<std::promise<void>>();
+    release_ = std::make_shared<std::promise<void>>();
+
+    auto started = started_;
+    auto release = release_->get_future().share();
+
+    ON_CALL(*storage_, GetTransaction(digest, _))
+        .WillByDefault(Invoke([this, started, release](Digest const &d, Transaction &tx) mutable {
+          // only the first lookup is signalled
+          if (started)
+          {
+            started->set_value();
+            started.reset();
+          }
+
+          release.wait();
+          return storage_->GetFake().GetTransaction(d, tx);
+        }));
+
+    return started_->get_future();
+  }
+
+  void ReleaseTransactionLookup()
+  {
+    release_->set_value();
+  }
+
+  template <typename Predicate>
+  static bool WaitFor(Predicate &&predicate)
+  {
+    auto const deadline = Clock::now() + std::chrono::seconds{5};
+
+    while (!predicate())
+    {
+      if (Clock::now() >= deadline)
+      {
+        return false;
+      }
+
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+
+    return true;
+  }
+
+  StorageUnitPtr                      storage_;
+  ExecutorPtr                         executor_;
+  BitVector                           shards_{1};
+  std::shared_ptr<std::promise<void>> started_;
+  std::shared_ptr<std::promise<void>> release_;
+};
+
+constexpr uint64_t ExecutorTests::BALANCE;
+
+TEST_F(ExecutorTests, CheckPrefetchIsUsedByExecution)
+{
+  auto const tx = CreateTransfer();
+
+  // wait for the worker to start on the prefetch before the transaction is executed
+  auto started = HoldTransactionLookup(tx->digest());
+  executor_->Prefetch(tx->digest(), shards_);
+  started.wait();
+  ReleaseTransactionLookup();
+
+  // the transaction has already been retrieved by the prefetch worker
+  EXPECT_CALL(*storage_, GetTransaction(tx->digest(), _)).Times(0);
+
+  auto const result = executor_->Execute(tx->digest(), 1, 0, shards_);
+  EXPECT_EQ(result.status, Status::SUCCESS);
+
+  // both of the token balances were fetched ahead of execution and then used
+  auto const stats = executor_->GetStatistics();
+  EXPECT_EQ(stats.prefetched, 2u);
+  EXPECT_EQ(stats.wasted, 0u);
+  EXPECT_EQ(stats.misses, 0u);
+}
+
+TEST_F(ExecutorTests, CheckMismatchedPrefetchIsDiscarded)
+{
+  auto const expected = CreateTransfer();
+  auto const actual   = CreateTransfer();
+
+  auto started = HoldTransactionLookup(expected->digest());
+  executor_->Prefetch(expected->digest(), shards_);
+  started.wait();
+
+  // a different transaction is executed, so the (incomplete) speculation is dropped
+  auto const result = executor_->Execute(actual->digest(), 1, 0, shards_);
+  EXPECT_EQ(result.status, Status::SUCCESS);
+
+  ReleaseTransactionLookup();
+
+  // once the worker completes the stale speculation its state is recorded as wasted
+  EXPECT_TRUE(WaitFor([this]() { return executor_->GetStatistics().wasted == 2u; }));
+
+  // the balances were also fetched (and used) by the execution itself
+  auto const stats = executor_->GetStatistics();
+  EXPECT_EQ(stats.prefetched, 4u);
+  EXPECT_EQ(stats.wasted, 2u);
+}
+
+TEST_F(ExecutorTests, CheckSupersededPrefetchIsDiscarded)
+{
+  auto const first  = CreateTransfer();
+  auto const second = CreateTransfer();
+
+  // the second request is made while the worker is still busy with the first one
+  auto started = HoldTransactionLookup(first->digest());
+  executor_->Prefetch(first->digest(), shards_);
+  started.wait();
+  executor_->Prefetch(second->digest(), shards_);
+  ReleaseTransactionLookup();
+
+  auto const result = executor_->Execute(second->digest(), 1, 0, shards_);
+  EXPECT_EQ(result.status, Status::SUCCESS);
+
+  // the state of the first speculation is never used
+  EXPECT_TRUE(WaitFor([this]() { return executor_->GetStatistics().wasted == 2u; }));
+
+  auto const stats = executor_->GetStatistics();
+  EXPECT_EQ(stats.prefetched, 4u);
+  EXPECT_EQ(stats.wasted, 2u);
+}
+
+TEST_F(ExecutorTests, CheckLearnedKeysAreEvictedLeastRecentlyUsedFirst)
+{
+  using Keys = fetch::ledger::StorageInterface::Keys;
+
+  auto const name = [](std::size_t index) { return "contract." + std::to_string(index); };
+
+  Keys const keys{ResourceAddress{"fetch.token.state.a"}, ResourceAddress{"fetch.token.state.b"}};
+
+  for (std::size_t i = 0; i < Executor::MAX_LEARNED_CONTRACTS; ++i)
+  {
+    executor_->LearnContractKeys(name(i), keys);
+  }
+
+  // executing the first contract again makes it the most recently used
+  executor_->LearnContractKeys(name(0), keys);
+
+  // learning a new contract evicts the least recently used one
+  executor_->LearnContractKeys(name(Executor::MAX_LEARNED_CONTRACTS), keys);
+
+  Keys learned{};
+  EXPECT_TRUE(executor_->LookupLearnedKeys(name(0), learned));
+  EXPECT_EQ(learned, keys);
+  EXPECT_FALSE(executor_->LookupLearnedKeys(name(1), learned));
+  EXPECT_TRUE(executor_->LookupLearnedKeys(name(2), learned));
+  EXPECT_TRUE(executor_->LookupLearnedKeys(name(Executor::MAX_LEARNED_CONTRACTS), learned));
+}
+
+TEST_F(ExecutorTests, CheckLearnedKeysAreBounded)
+{
+  using Keys = fetch::ledger::StorageInterface::Keys;
+
+  Keys keys{};
+  for (std::size_t i = 0; i < (2 * Executor::MAX_LEARNED_KEYS); ++i)
+  {
+    keys.emplace_back(ResourceAddress{"fetch.token.state." + std::to_string(i)});
+  }
+
+  executor_->LearnContractKeys("contract", keys);
+
+  Keys learned{};
+  ASSERT_TRUE(executor_->LookupLearnedKeys("contract", learned));
+  EXPECT_EQ(learned.size(), std::size_t{Executor::MAX_LEARNED_KEYS});
+}
+
+TEST_F(ExecutorTests, CheckShutdownWhilePrefetchIsInFlight)
+{
+  auto const tx = CreateTransfer();
+
+  auto started = HoldTransactionLookup(tx->digest());
+  executor_->Prefetch(tx->digest(), shards_);
+  started.wait();
+
+  // release the lookup shortly after the executor has started to shut down
+  std::thread releaser{[this]() {
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    ReleaseTransactionLookup();
+  }};
+
+  // the destructor must wait for the worker rather than leave it running
+  executor_.reset();
+  releaser.join();
+
+  EXPECT_TRUE(::testing::Mock::VerifyAndClearExpectations(storage_.get()));
+}
+
+}  // namespace
@@ -0,0 +1,457 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/service_ids.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chain/transaction_rpc_serializers.hpp"
+#include "ledger/shard_config.hpp"
+#include "ledger/storage_unit/storage_unit_client.hpp"
+#include "network/muddle/muddle_endpoint.hpp"
+#include "network/muddle/rpc/server.hpp"
+#include "network/service/promise.hpp"
+#include "storage/document_store_protocol.hpp"
+#include "storage/new_revertible_document_store.hpp"
+#include "storage/object_store_protocol.hpp"
+#include "storage/resource_mapper.hpp"
+#include "storage/transient_object_store.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::ShardConfigs;
+using fetch::ledger::StorageUnitClient;
+using fetch::muddle::MuddleEndpoint;
+using fetch::muddle::NetworkId;
+using fetch::muddle::Subscription;
+using fetch::storage::NewRevertibleDocumentStore;
+using fetch::storage::ResourceAddress;
+using fetch::storage::ResourceID;
+using fetch::storage::RevertibleDocumentStoreProtocol;
+
+using RpcServer       = fetch::muddle::rpc::Server;
+using Keys            = StorageUnitClient::Keys;
+using KeyValues       = StorageUnitClient::KeyValues;
+using TransactionList = StorageUnitClient::TransactionList;
+using TxStore         = fetch::storage::TransientObjectStore<Transaction>;
+using TxStoreProtocol = fetch::storage::ObjectStoreProtocol<Transaction>;
+using StorePtr        = std::unique_ptr<NewRevertibleDocumentStore>;
+using ProtocolPtr     = std::unique_ptr<RevertibleDocumentStoreProtocol>;
+using TxStorePtr      = std::unique_ptr<TxStore>;
+using TxProtocolPtr   = std::unique_ptr<TxStoreProtocol>;
+using RpcServerPtr    = std::unique_ptr<RpcServer>;
+using ClientPtr       = std::unique_ptr<StorageUnitClient>;
+
+/**
+ * Muddle endpoint which delivers exchanges directly to the other endpoints of the same network,
+ * recording the number of requests that it receives
+ */
+class LoopbackEndpoint : public MuddleEndpoint
+{
+public:
+  using EndpointMap = std::unordered_map<Address, LoopbackEndpoint *>;
+
+  LoopbackEndpoint(EndpointMap &network, Address address)
+    : network_{network}
+    , address_{std::move(address)}
+  {
+    network_[address_] = this;
+  }
+
+  ~LoopbackEndpoint() override
+  {
+    network_.erase(address_);
+  }
+
+  void Send(Address const & /*address*/, uint16_t /*service*/, uint16_t /*channel*/,
+            Payload const & /*message*/) override
+  {
+    throw std::runtime_error("Send is not supported");
+  }
+
+  void Send(Address const &address, uint16_t /*service*/, uint16_t /*channel*/,
+            uint16_t message_num, Payload const &payload) override
+  {
+    Lookup(address).Resolve(message_num, payload);
+  }
+
+  void Broadcast(uint16_t /*service*/, uint16_t /*channel*/, Payload const & /*payload*/) override
+  {}
+
+  Response Exchange(Address const &address, uint16_t service, uint16_t channel,
+                    Payload const &request) override
+  {
+    auto           promise = fetch::service::MakePromise();
+    uint16_t const counter = counter_++;
+
+    pending_[counter] = promise;
+    Lookup(address).Receive(address_, service, channel, counter, request);
+
+    return Response{promise};
+  }
+
+  SubscriptionPtr Subscribe(uint16_t service, uint16_t channel) override
+  {
+    auto &subscription = subscriptions_[(uint32_t{service} << 16u) | channel];
+    if (!subscription)
+    {
+      subscription = std::make_shared<Subscription>();
+    }
+
+    return subscription;
+  }
+
+  SubscriptionPtr Subscribe(Address const & /*address*/, uint16_t service,
+                            uint16_t channel) override
+  {
+    return Subscribe(service, channel);
+  }
+
+  NetworkId const &network_id() const override
+  {
+    return network_id_;
+  }
+
+  AddressList GetDirectlyConnectedPeers() const override
+  {
+    return {};
+  }
+
+  std::size_t requests{0};  ///< The number of requests received
+
+private:
+  using PromiseMap = std::unordered_map<uint16_t, fetch::service::Promise>;
+
+  LoopbackEndpoint &Lookup(Address const &address)
+  {
+    auto it = network_.find(address);
+    if (it == network_.end())
+    {
+      throw std::runtime_error("Unknown address");
+    }
+
+    return *it->second;
+  }
+
+  void Receive(Address const &from, uint16_t service, uint16_t channel, uint16_t counter,
+               Payload const &payload)
+  {
+    ++requests;
+    Subscribe(service, channel)->Dispatch(from, service, channel, counter, payload, from);
+  }
+
+  void Resolve(uint16_t counter, Payload const &payload)
+  {
+    auto it = pending_.find(counter);
+    if (it != pending_.end())
+    {
+      it->second->Fulfill(payload);
+      pending_.erase(it);
+    }
+  }
+
+  EndpointMap &                                 network_;
+  Address const                                 address_;
+  NetworkId                                     network_id_{"TEST"};
+  std::unordered_map<uint32_t, SubscriptionPtr> subscriptions_{};
+  PromiseMap                                    pending_{};
+  uint16_t                                      counter_{0};
+};
+
+using EndpointPtr = std::unique_ptr<LoopbackEndpoint>;
+
+/**
+ * The state database, transaction store and RPC protocols of a single lane
+ */
+struct Lane
+{
+  EndpointPtr   endpoint;
+  StorePtr      store;
+  ProtocolPtr   protocol;
+  TxStorePtr    tx_store;
+  TxProtocolPtr tx_protocol;
+  RpcServerPtr  server;
+};
+
+using Lanes = std::vector<Lane>;
+
+class StorageUnitClientTests : public ::testing::Test
+{
+protected:
+  static constexpr uint32_t LOG2_NUM_LANES = 2;
+  static constexpr uint32_t NUM_LANES      = 1u << LOG2_NUM_LANES;
+
+  void SetUp() override
+  {
+    ShardConfigs shards(NUM_LANES);
+    lanes_.resize(NUM_LANES);
+
+    for (uint32_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+      auto &cfg             = shards[lane];
+      cfg.lane_id           = lane;
+      cfg.num_lanes         = NUM_LANES;
+      cfg.internal_identity = std::make_shared<ECDSASigner>();
+
+      std::string const prefix = "storage_unit_client_tests_lane" + std::to_string(lane) + "_";
+
+      auto &state = lanes_[lane];
+
+      state.endpoint = std::make_unique<LoopbackEndpoint>(
+          network_, cfg.internal_identity->identity().identifier());
+
+      state.store = std::make_unique<NewRevertibleDocumentStore>();
+      state.store->New(prefix + "state.db", prefix + "state_deltas.db", prefix + "state_index.db",
+                       prefix + "state_index_deltas.db", false);
+
+      state.protocol =
+          std::make_unique<RevertibleDocumentStoreProtocol>(state.store.get(), lane, NUM_LANES);
+
+      state.tx_store = std::make_unique<TxStore>(LOG2_NUM_LANES);
+      state.tx_store->New(prefix + "transaction.db", prefix + "transaction_index.db", true);
+      state.tx_protocol = std::make_unique<TxStoreProtocol>(state.tx_store.get());
+
+      state.server = std::make_unique<RpcServer>(*state.endpoint, fetch::SERVICE_LANE_CTRL,
+                                                 fetch::CHANNEL_RPC);
+      state.server->Add(fetch::RPC_STATE, state.protocol.get());
+      state.server->Add(fetch::RPC_TX_STORE, state.tx_protocol.get());
+    }
+
+    endpoint_ = std::make_unique<LoopbackEndpoint>(network_, ConstByteArray{"client"});
+    client_   = std::make_unique<StorageUnitClient>(*endpoint_, shards, LOG2_NUM_LANES);
+  }
+
+  void TearDown() override
+  {
+    client_.reset();
+    endpoint_.reset();
+    lanes_.clear();
+  }
+
+  /**
+   * Create a series of keys which are spread across all of the lanes
+   */
+  static Keys CreateKeys(std::size_t count)
+  {
+    Keys keys{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      keys.emplace_back(ResourceAddress{"fetch.token.state." + std::to_string(i)});
+    }
+
+    return keys;
+  }
+
+  /**
+   * Create a series of transactions, which will be spread across all of the lanes
+   */
+  static TransactionList CreateTransactions(std::size_t count)
+  {
+    ECDSASigner const signer{};
+    Address const     address{signer.identity()};
+
+    TransactionList txs{};
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      txs.emplace_back(TransactionBuilder()
+                           .From(address)
+                           .Transfer(address, 1)
+                           .ValidUntil(1000 + i)
+                           .ChargeLimit(1)
+                           .Signer(signer.identity())
+                           .Seal()
+                           .Sign(signer)
+                           .Build());
+    }
+
+    return txs;
+  }
+
+  static ConstByteArray ValueOf(ResourceAddress const &key)
+  {
+    return "value of " + key.address();
+  }
+
+  void ResetRequests()
+  {
+    for (auto &lane : lanes_)
+    {
+      lane.endpoint->requests = 0;
+    }
+  }
+
+  LoopbackEndpoint::EndpointMap network_{};
+  Lanes                         lanes_{};
+  EndpointPtr                   endpoint_;
+  ClientPtr                     client_;
+};
+
+constexpr uint32_t StorageUnitClientTests::LOG2_NUM_LANES;
+constexpr uint32_t StorageUnitClientTests::NUM_LANES;
+
+TEST_F(StorageUnitClientTests, CheckSetBatchStoresValuesOnTheirLanes)
+{
+  auto const keys = CreateKeys(32);
+
+  KeyValues key_values{};
+  for (auto const &key : keys)
+  {
+    key_values.emplace_back(key, ValueOf(key));
+  }
+
+  client_->SetBatch(key_values);
+
+  // a single request is made to each of the lanes
+  for (auto const &lane : lanes_)
+  {
+    EXPECT_EQ(lane.endpoint->requests, 1u);
+  }
+
+  // each of the values is only present on the lane which owns it
+  for (auto const &key_value : key_values)
+  {
+    ResourceID const rid{key_value.first.as_resource_id()};
+
+    for (uint32_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+      auto const doc = lanes_[lane].store->Get(rid);
+
+      if (lane == rid.lane(LOG2_NUM_LANES))
+      {
+        ASSERT_FALSE(doc.failed);
+        EXPECT_EQ(doc.document, key_value.second);
+      }
+      else
+      {
+        EXPECT_TRUE(doc.failed);
+      }
+    }
+  }
+}
+
+TEST_F(StorageUnitClientTests, CheckGetBatchReturnsDocumentsInRequestOrder)
+{
+  auto const keys = CreateKeys(32);
+
+  // only every other key is stored
+  KeyValues key_values{};
+  for (std::size_t i = 0; i < keys.size(); i += 2)
+  {
+    key_values.emplace_back(keys[i], ValueOf(keys[i]));
+  }
+
+  client_->SetBatch(key_values);
+  ResetRequests();
+
+  auto const documents = client_->GetBatch(keys);
+  ASSERT_EQ(documents.size(), keys.size());
+
+  // a single request is made to each of the lanes
+  for (auto const &lane : lanes_)
+  {
+    EXPECT_EQ(lane.endpoint->requests, 1u);
+  }
+
+  for (std::size_t i = 0; i < keys.size(); ++i)
+  {
+    if ((i % 2) == 0)
+    {
+      ASSERT_FALSE(documents[i].failed);
+      EXPECT_EQ(documents[i].document, ValueOf(keys[i]));
+    }
+    else
+    {
+      EXPECT_TRUE(documents[i].failed);
+    }
+  }
+}
+
+TEST_F(StorageUnitClientTests, CheckBatchesOnlyContactTheRequiredLanes)
+{
+  ResourceAddress const key{"fetch.token.state.single"};
+  auto const            owner = key.lane(LOG2_NUM_LANES);
+
+  client_->SetBatch({{key, "value"}});
+
+  auto const documents = client_->GetBatch({key});
+  ASSERT_EQ(documents.size(), 1u);
+  EXPECT_FALSE(documents[0].failed);
+  EXPECT_EQ(documents[0].document, "value");
+
+  for (uint32_t lane = 0; lane < NUM_LANES; ++lane)
+  {
+    EXPECT_EQ(lanes_[lane].endpoint->requests, (lane == owner) ? 2u : 0u);
+  }
+
+  // empty batches do not generate any requests
+  ResetRequests();
+  client_->SetBatch({});
+  EXPECT_TRUE(client_->GetBatch({}).empty());
+
+  for (auto const &lane : lanes_)
+  {
+    EXPECT_EQ(lane.endpoint->requests, 0u);
+  }
+}
+
+TEST_F(StorageUnitClientTests, CheckAddTransactionsStoresTransactionsOnTheirLanes)
+{
+  auto const txs = CreateTransactions(32);
+
+  client_->AddTransactions(txs);
+
+  // a single request is made to each of the lanes
+  for (auto const &lane : lanes_)
+  {
+    EXPECT_EQ(lane.endpoint->requests, 1u);
+  }
+
+  // each of the transactions is only present on the lane which owns it
+  for (auto const &tx : txs)
+  {
+    ResourceID const rid{tx->digest()};
+
+    for (uint32_t lane = 0; lane < NUM_LANES; ++lane)
+    {
+      EXPECT_EQ(lanes_[lane].tx_store->Has(rid), lane == rid.lane(LOG2_NUM_LANES));
+    }
+
+    Transaction stored{};
+    ASSERT_TRUE(client_->GetTransaction(tx->digest(), stored));
+    EXPECT_EQ(stored.digest(), tx->digest());
+  }
+}
+
+}  // namespace
@@ -0,0 +1,283 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "core/runnable.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
+#include "core/serializers/stl_types.hpp"
+#include "core/service_ids.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/chain/transaction_layout.hpp"
+#include "ledger/chain/transaction_layout_rpc_serializers.hpp"
+#include "ledger/chain/transaction_rpc_serializers.hpp"
+#include "ledger/storage_unit/transaction_feed.hpp"
+#include "network/muddle/muddle_endpoint.hpp"
+#include "storage/resource_mapper.hpp"
+#include "storage/transient_object_store.hpp"
+
+#include "gtest/gtest.h"
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::core::Runnable;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::Transaction;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::TransactionFeedCredit;
+using fetch::ledger::TransactionFeedPublisher;
+using fetch::ledger::TransactionLayout;
+using fetch::muddle::MuddleEndpoint;
+using fetch::muddle::NetworkId;
+using fetch::muddle::Subscription;
+using fetch::serializers::ByteArrayBuffer;
+using fetch::storage::ResourceID;
+
+using TxStore      = TransactionFeedPublisher::TxStore;
+using TxLayouts    = std::vector<TransactionLayout>;
+using RunnablePtr  = std::shared_ptr<Runnable>;
+using TxStorePtr   = std::unique_ptr<TxStore>;
+using PublisherPtr = std::unique_ptr<TransactionFeedPublisher>;
+
+/**
+ * Muddle endpoint which records the messages sent through it and allows messages to be delivered
+ * to its subscriptions
+ */
+class FakeEndpoint : public MuddleEndpoint
+{
+public:
+  struct Message
+  {
+    Address  address;
+    uint16_t channel;
+    Payload  payload;
+  };
+
+  using Messages = std::vector<Message>;
+
+  void Send(Address const &address, uint16_t /*service*/, uint16_t channel,
+            Payload const &message) override
+  {
+    sent.push_back(Message{address, channel, message});
+  }
+
+  void Send(Address const &address, uint16_t service, uint16_t channel, uint16_t /*message_num*/,
+            Payload const &payload) override
+  {
+    Send(address, service, channel, payload);
+  }
+
+  void Broadcast(uint16_t /*service*/, uint16_t /*channel*/, Payload const & /*payload*/) override
+  {}
+
+  Response Exchange(Address const & /*address*/, uint16_t /*service*/, uint16_t /*channel*/,
+                    Payload const & /*request*/) override
+  {
+    throw std::runtime_error("Exchange is not supported");
+  }
+
+  SubscriptionPtr Subscribe(uint16_t /*service*/, uint16_t channel) override
+  {
+    auto &subscription = subscriptions_[channel];
+    if (!subscription)
+    {
+      subscription = std::make_shared<Subscription>();
+    }
+
+    return subscription;
+  }
+
+  SubscriptionPtr Subscribe(Address const & /*address*/, uint16_t service,
+                            uint16_t channel) override
+  {
+    return Subscribe(service, channel);
+  }
+
+  NetworkId const &network_id() const override
+  {
+    return network_id_;
+  }
+
+  AddressList GetDirectlyConnectedPeers() const override
+  {
+    return {};
+  }
+
+  void Deliver(Address const &from, uint16_t channel, Payload const &payload)
+  {
+    Subscribe(fetch::SERVICE_LANE_CTRL, channel)
+        ->Dispatch(from, fetch::SERVICE_LANE_CTRL, channel, 0, payload, from);
+  }
+
+  Messages sent{};
+
+private:
+  std::unordered_map<uint16_t, SubscriptionPtr> subscriptions_{};
+  NetworkId                                     network_id_{"TEST"};
+};
+
+class TransactionFeedTests : public ::testing::Test
+{
+protected:
+  static constexpr uint64_t WINDOW = 100;
+
+  void SetUp() override
+  {
+    store_     = std::make_unique<TxStore>(0);
+    publisher_ = std::make_unique<TransactionFeedPublisher>(endpoint_, *store_);
+  }
+
+  void TearDown() override
+  {
+    publisher_.reset();
+    store_.reset();
+  }
+
+  void AddTransactions(std::size_t count)
+  {
+    ECDSASigner const signer{};
+    Address const     address{signer.identity()};
+
+    for (std::size_t i = 0; i < count; ++i)
+    {
+      auto const tx = TransactionBuilder()
+                          .From(address)
+                          .TargetChainCode("foo.bar.baz", fetch::BitVector{})
+                          .Action("action")
+                          .ValidUntil(1000 + i)
+                          .ChargeLimit(500)
+                          .Signer(signer.identity())
+                          .Seal()
+                          .Sign(signer)
+                          .Build();
+
+      store_->Set(ResourceID{tx->digest()}, *tx, true);
+    }
+  }
+
+  void GrantCredit(uint64_t credit)
+  {
+    ByteArrayBuffer buffer;
+    buffer << TransactionFeedCredit{credit, WINDOW};
+
+    endpoint_.Deliver(SUBSCRIBER, fetch::CHANNEL_TX_FEED_CREDIT, buffer.data());
+  }
+
+  void Publish()
+  {
+    RunnablePtr runnable = publisher_->GetWeakRunnable().lock();
+    ASSERT_TRUE(runnable);
+
+    runnable->Execute();
+  }
+
+  TxLayouts TakeBatch()
+  {
+    TxLayouts layouts{};
+
+    if (!endpoint_.sent.empty())
+    {
+      auto const message = endpoint_.sent.front();
+      endpoint_.sent.erase(endpoint_.sent.begin());
+
+      EXPECT_EQ(message.address, SUBSCRIBER);
+      EXPECT_EQ(message.channel, fetch::CHANNEL_TX_FEED);
+
+      ByteArrayBuffer buffer{message.payload};
+      buffer >> layouts;
+    }
+
+    return layouts;
+  }
+
+  static ConstByteArray const SUBSCRIBER;
+
+  FakeEndpoint endpoint_;
+  TxStorePtr   store_;
+  PublisherPtr publisher_;
+};
+
+constexpr uint64_t   TransactionFeedTests::WINDOW;
+ConstByteArray const TransactionFeedTests::SUBSCRIBER{"subscriber"};
+
+TEST_F(TransactionFeedTests, CheckLayoutsAreHeldWithoutSubscribers)
+{
+  AddTransactions(5);
+
+  Publish();
+  EXPECT_TRUE(endpoint_.sent.empty());
+}
+
+TEST_F(TransactionFeedTests, CheckLayoutsAreHeldUntilCreditIsGranted)
+{
+  AddTransactions(5);
+
+  // subscribe without granting any credit, nothing should be sent
+  GrantCredit(0);
+  Publish();
+  EXPECT_TRUE(endpoint_.sent.empty());
+
+  // grant credit for some of the layouts
+  GrantCredit(3);
+  Publish();
+  EXPECT_EQ(TakeBatch().size(), 3u);
+  EXPECT_TRUE(endpoint_.sent.empty());
+
+  // the credit has been used up, the remaining layouts should be held
+  Publish();
+  EXPECT_TRUE(endpoint_.sent.empty());
+
+  // grant more credit than is needed, the remaining layouts should be delivered
+  GrantCredit(10);
+  Publish();
+  EXPECT_EQ(TakeBatch().size(), 2u);
+  EXPECT_TRUE(endpoint_.sent.empty());
+
+  // the remaining credit is kept for new layouts
+  AddTransactions(4);
+  Publish();
+  EXPECT_EQ(TakeBatch().size(), 4u);
+}
+
+TEST_F(TransactionFeedTests, CheckCreditIsLimitedToTheWindow)
+{
+  AddTransactions(5);
+
+  GrantCredit(WINDOW);
+  GrantCredit(WINDOW);
+
+  Publish();
+  EXPECT_EQ(TakeBatch().size(), 5u);
+
+  // only the window, less the layouts already sent, should remain
+  AddTransactions(static_cast<std::size_t>(WINDOW));
+  Publish();
+  EXPECT_EQ(TakeBatch().size(), WINDOW - 5);
+}
+
+}  // namespace
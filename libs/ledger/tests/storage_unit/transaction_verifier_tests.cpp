@@ -0,0 +1,133 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/const_byte_array.hpp"
+#include "crypto/ecdsa.hpp"
+#include "ledger/chain/address.hpp"
+#include "ledger/chain/transaction.hpp"
+#include "ledger/chain/transaction_builder.hpp"
+#include "ledger/storage_unit/transaction_sinks.hpp"
+#include "ledger/transaction_verifier.hpp"
+
+#include "gtest/gtest.h"
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <unordered_set>
+
+namespace {
+
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::ECDSASigner;
+using fetch::ledger::Address;
+using fetch::ledger::TransactionBuilder;
+using fetch::ledger::TransactionSink;
+using fetch::ledger::TransactionVerifier;
+
+using TransactionList = TransactionVerifier::TransactionList;
+using Digests         = std::unordered_set<ConstByteArray>;
+
+/**
+ * Transaction sink which fails to accept a single nominated transaction
+ */
+class FailingSink : public TransactionSink
+{
+public:
+  void OnTransaction(TransactionPtr const &tx) override
+  {
+    std::lock_guard<std::mutex> lock(lock_);
+
+    if (tx->digest() == failing)
+    {
+      throw std::runtime_error("Unable to accept transaction");
+    }
+
+    received.insert(tx->digest());
+    condition_.notify_all();
+  }
+
+  bool WaitFor(std::size_t count, std::chrono::milliseconds timeout)
+  {
+    std::unique_lock<std::mutex> lock(lock_);
+    return condition_.wait_for(lock, timeout, [this, count]() { return received.size() >= count; });
+  }
+
+  ConstByteArray failing{};
+  Digests        received{};
+
+private:
+  std::mutex              lock_;
+  std::condition_variable condition_;
+};
+
+TransactionList CreateTransactions(std::size_t count)
+{
+  ECDSASigner const signer{};
+  Address const     address{signer.identity()};
+
+  TransactionList txs{};
+  for (std::size_t i = 0; i < count; ++i)
+  {
+    txs.emplace_back(TransactionBuilder()
+                         .From(address)
+                         .TargetChainCode("foo.bar.baz", fetch::BitVector{})
+                         .Action("action")
+                         .ValidUntil(1000 + i)
+                         .ChargeLimit(500)
+                         .Signer(signer.identity())
+                         .Seal()
+                         .Sign(signer)
+                         .Build());
+  }
+
+  return txs;
+}
+
+TEST(TransactionVerifierTests, CheckSinkFailureDoesNotDropTheRestOfTheBatch)
+{
+  static constexpr std::size_t NUM_TXS = 16;
+
+  auto txs = CreateTransactions(NUM_TXS);
+
+  Digests expected{};
+  for (auto const &tx : txs)
+  {
+    expected.insert(tx->digest());
+  }
+
+  // the first transaction of the batch is rejected by the sink
+  FailingSink sink{};
+  sink.failing = txs.front()->digest();
+  expected.erase(sink.failing);
+
+  TransactionVerifier verifier{sink, 1, "Verifier"};
+  verifier.Start();
+  verifier.AddTransactions(std::move(txs));
+
+  EXPECT_TRUE(sink.WaitFor(NUM_TXS - 1, std::chrono::seconds{10}));
+
+  verifier.Stop();
+
+  EXPECT_EQ(sink.received, expected);
+}
+
+}  // namespace
@@ -672,6 +672,97 @@ BENCHMARK_TEMPLATE(BM_TransposeDot, fetch::fixed_point::FixedPoint<16, 16>, 512,
 BENCHMARK_TEMPLATE(BM_TransposeDot, fetch::fixed_point::FixedPoint<32, 32>, 512, 512)
     ->Unit(benchmark::kMillisecond);
 
+/**
+ * The naive triple loop which Dot was previously computed with, kept as a baseline
+ */
+template <class T>
+void NaiveDot(fetch::math::Tensor<T> const &A, fetch::math::Tensor<T> const &B,
+              fetch::math::Tensor<T> &ret)
+{
+  using SizeType = fetch::math::SizeType;
+
+  for (SizeType i(0); i < A.shape()[0]; ++i)
+  {
+    for (SizeType j(0); j < B.shape()[1]; ++j)
+    {
+      ret.At(i, j) = A.At(i, 0) * B.At(0, j);
+      for (SizeType k(1); k < A.shape()[1]; ++k)
+      {
+        ret.At(i, j) += A.At(i, k) * B.At(k, j);
+      }
+    }
+  }
+}
+
+template <class T>
+void BM_DotNaive(benchmark::State &state)
+{
+  using SizeType = fetch::math::SizeType;
+
+  auto const n = static_cast<SizeType>(state.range(0));
+
+  fetch::math::Tensor<T> a(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> b(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> ret(std::vector<SizeType>{n, n});
+
+  for (auto _ : state)
+  {
+    NaiveDot(a, b, ret);
+  }
+
+  // report the number of multiply-adds
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0) * state.range(0));
+}
+
+template <class T>
+void BM_DotBlocked(benchmark::State &state)
+{
+  using SizeType = fetch::math::SizeType;
+
+  auto const n = static_cast<SizeType>(state.range(0));
+
+  fetch::math::Tensor<T> a(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> b(std::vector<SizeType>{n, n});
+  fetch::math::Tensor<T> ret(std::vector<SizeType>{n, n});
+
+  for (auto _ : state)
+  {
+    fetch::math::Dot(a, b, ret);
+  }
+
+  // report the number of multiply-adds
+  state.SetItemsProcessed(state.iterations() * state.range(0) * state.range(0) * state.range(0));
+}
+
+BENCHMARK_TEMPLATE(BM_DotNaive, float)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_DotNaive, double)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK_TEMPLATE(BM_DotNaive, fetch::fixed_point::FixedPoint<32, 32>)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_TEMPLATE(BM_DotBlocked, float)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DotBlocked, double)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+BENCHMARK_TEMPLATE(BM_DotBlocked, fetch::fixed_point::FixedPoint<32, 32>)
+    ->RangeMultiplier(2)
+    ->Range(32, 2048)
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
 template <class T, int C, int H, int W>
 void BM_DynamicStitch(benchmark::State &state)
 {
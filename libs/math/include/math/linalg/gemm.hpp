@@ -0,0 +1,375 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "math/base_types.hpp"
+#include "vectorise/threading/pool.hpp"
+
+#include <algorithm>
+#include <exception>
+#include <future>
+#include <thread>
+#include <vector>
+
+namespace fetch {
+namespace math {
+namespace linalg {
+
+/**
+ * The pool of worker threads shared by all of the matrix multiplications
+ */
+inline threading::Pool &GemmWorkers()
+{
+  static threading::Pool pool{std::max(1u, std::thread::hardware_concurrency()), "Gemm"};
+  return pool;
+}
+
+/**
+ * Read only view of a column major matrix, which can optionally be read as its transpose
+ *
+ * @tparam T The element type
+ */
+template <typename T>
+struct MatrixView
+{
+  T const *data{nullptr};
+  SizeType leading_dimension{0};  ///< The distance (in elements) between the start of two columns
+  bool     transposed{false};
+
+  T const &operator()(SizeType i, SizeType j) const
+  {
+    return transposed ? data[j + (i * leading_dimension)] : data[i + (j * leading_dimension)];
+  }
+
+  MatrixView Offset(SizeType i, SizeType j) const
+  {
+    return {&(*this)(i, j), leading_dimension, transposed};
+  }
+};
+
+/**
+ * Packed, cache blocked general matrix multiply C = op(A).op(B) for column major matrices
+ *
+ * The computation follows the usual Goto / BLIS decomposition. Panels of B (KC x NC) and blocks of
+ * A (MC x KC) are copied into contiguous buffers in the order in which the micro kernel reads them,
+ * so that the A block stays resident in the L2 cache and the kernel streams through both operands
+ * linearly. The MR x NR micro kernel has compile time bounds so that the accumulators are kept in
+ * registers and the inner loop (down a column of C) is vectorised by the compiler for the
+ * floating point types. The fixed point types run the same loop with scalar arithmetic.
+ *
+ * Large problems are split along the longer dimension of C and the parts are computed in parallel,
+ * each part packing its own operands.
+ *
+ * @tparam T The element type
+ */
+template <typename T>
+class Gemm
+{
+public:
+  /// @name Blocking Parameters
+  /// @{
+  static constexpr SizeType MR = 8;     ///< Height of the micro kernel tile
+  static constexpr SizeType NR = 4;     ///< Width of the micro kernel tile
+  static constexpr SizeType MC = 128;   ///< Height of the packed block of A
+  static constexpr SizeType KC = 256;   ///< Depth of the packed blocks of A and B
+  static constexpr SizeType NC = 2048;  ///< Width of the packed panel of B
+  /// @}
+
+  /// The minimum number of multiply-adds before the computation is split over multiple threads
+  static constexpr SizeType PARALLEL_THRESHOLD = SizeType{1} << 21u;
+
+  static void Compute(SizeType m, SizeType n, SizeType k, MatrixView<T> const &a,
+                      MatrixView<T> const &b, T *c, SizeType ldc, bool accumulate);
+
+private:
+  static void ComputeSerial(SizeType m, SizeType n, SizeType k, MatrixView<T> const &a,
+                            MatrixView<T> const &b, T *c, SizeType ldc, bool accumulate);
+  static void PackA(MatrixView<T> const &a, SizeType mc, SizeType kc, T *packed);
+  static void PackB(MatrixView<T> const &b, SizeType kc, SizeType nc, T *packed);
+  static void MicroKernel(SizeType kc, T const *a, T const *b, T *c, SizeType ldc, SizeType mr,
+                          SizeType nr, bool accumulate);
+
+  static SizeType RoundUp(SizeType value, SizeType multiple);
+};
+
+template <typename T>
+constexpr SizeType Gemm<T>::MR;
+template <typename T>
+constexpr SizeType Gemm<T>::NR;
+template <typename T>
+constexpr SizeType Gemm<T>::MC;
+template <typename T>
+constexpr SizeType Gemm<T>::KC;
+template <typename T>
+constexpr SizeType Gemm<T>::NC;
+template <typename T>
+constexpr SizeType Gemm<T>::PARALLEL_THRESHOLD;
+
+/**
+ * Compute C = op(A).op(B), or C += op(A).op(B) when accumulating
+ *
+ * @param m The number of rows of op(A) and C
+ * @param n The number of columns of op(B) and C
+ * @param k The number of columns of op(A) and rows of op(B)
+ * @param a The view of A
+ * @param b The view of B
+ * @param c The pointer to the first element of C
+ * @param ldc The leading dimension of C
+ * @param accumulate Whether to add the product to the existing contents of C
+ */
+template <typename T>
+void Gemm<T>::Compute(SizeType m, SizeType n, SizeType k, MatrixView<T> const &a,
+                      MatrixView<T> const &b, T *c, SizeType ldc, bool accumulate)
+{
+  if ((m == 0) || (n == 0))
+  {
+    return;
+  }
+
+  // determine how many parts the problem should be split into
+  SizeType num_parts{1};
+  if ((m * n * k) >= PARALLEL_THRESHOLD)
+  {
+    SizeType const num_threads = std::max(1u, std::thread::hardware_concurrency());
+    SizeType const max_parts   = (std::max(m, n) + MC - 1) / MC;
+
+    num_parts = std::min(num_threads, max_parts);
+  }
+
+  if (num_parts <= 1)
+  {
+    ComputeSerial(m, n, k, a, b, c, ldc, accumulate);
+    return;
+  }
+
+  // split C along its longer dimension, in multiples of the micro kernel tile
+  bool const     split_columns = n >= m;
+  SizeType const length        = split_columns ? n : m;
+  SizeType const part_size =
+      RoundUp((length + num_parts - 1) / num_parts, split_columns ? NR : MR);
+
+  std::vector<std::future<void>> parts{};
+  parts.reserve(num_parts);
+
+  for (SizeType offset = part_size; offset < length; offset += part_size)
+  {
+    SizeType const size = std::min(part_size, length - offset);
+
+    if (split_columns)
+    {
+      parts.emplace_back(GemmWorkers().Dispatch([=, &a, &b]() {
+        ComputeSerial(m, size, k, a, b.Offset(0, offset), c + (offset * ldc), ldc, accumulate);
+      }));
+    }
+    else
+    {
+      parts.emplace_back(GemmWorkers().Dispatch([=, &a, &b]() {
+        ComputeSerial(size, n, k, a.Offset(offset, 0), b, c + offset, ldc, accumulate);
+      }));
+    }
+  }
+
+  // the calling thread computes the first part
+  std::exception_ptr error{};
+  try
+  {
+    if (split_columns)
+    {
+      ComputeSerial(m, part_size, k, a, b, c, ldc, accumulate);
+    }
+    else
+    {
+      ComputeSerial(part_size, n, k, a, b, c, ldc, accumulate);
+    }
+  }
+  catch (...)
+  {
+    error = std::current_exception();
+  }
+
+  // the other parts refer to the operands, so they must all complete before returning
+  for (auto &part : parts)
+  {
+    part.wait();
+  }
+
+  if (error)
+  {
+    std::rethrow_exception(error);
+  }
+
+  for (auto &part : parts)
+  {
+    part.get();
+  }
+}
+
+/**
+ * Internal: Compute the (part of the) product on the calling thread
+ */
+template <typename T>
+void Gemm<T>::ComputeSerial(SizeType m, SizeType n, SizeType k, MatrixView<T> const &a,
+                            MatrixView<T> const &b, T *c, SizeType ldc, bool accumulate)
+{
+  if (k == 0)
+  {
+    if (!accumulate)
+    {
+      for (SizeType j = 0; j < n; ++j)
+      {
+        std::fill(c + (j * ldc), c + (j * ldc) + m, T(0));
+      }
+    }
+
+    return;
+  }
+
+  std::vector<T> packed_a(MC * KC);
+  std::vector<T> packed_b(std::min(k, KC) * RoundUp(std::min(n, NC), NR));
+
+  for (SizeType jc = 0; jc < n; jc += NC)
+  {
+    SizeType const nc = std::min(NC, n - jc);
+
+    for (SizeType pc = 0; pc < k; pc += KC)
+    {
+      SizeType const kc = std::min(KC, k - pc);
+
+      // the first pass over the depth overwrites C (unless accumulating)
+      bool const accumulate_block = accumulate || (pc > 0);
+
+      PackB(b.Offset(pc, jc), kc, nc, packed_b.data());
+
+      for (SizeType ic = 0; ic < m; ic += MC)
+      {
+        SizeType const mc = std::min(MC, m - ic);
+
+        PackA(a.Offset(ic, pc), mc, kc, packed_a.data());
+
+        for (SizeType jr = 0; jr < nc; jr += NR)
+        {
+          for (SizeType ir = 0; ir < mc; ir += MR)
+          {
+            MicroKernel(kc, packed_a.data() + (ir * kc), packed_b.data() + (jr * kc),
+                        c + (ic + ir) + ((jc + jr) * ldc), ldc, std::min(MR, mc - ir),
+                        std::min(NR, nc - jr), accumulate_block);
+          }
+        }
+      }
+    }
+  }
+}
+
+/**
+ * Internal: Pack a block of A into slivers of MR rows, each stored one column after another. The
+ * last sliver is padded with zeros.
+ */
+template <typename T>
+void Gemm<T>::PackA(MatrixView<T> const &a, SizeType mc, SizeType kc, T *packed)
+{
+  for (SizeType ir = 0; ir < mc; ir += MR)
+  {
+    SizeType const mr = std::min(MR, mc - ir);
+
+    for (SizeType p = 0; p < kc; ++p)
+    {
+      for (SizeType i = 0; i < mr; ++i)
+      {
+        packed[i] = a(ir + i, p);
+      }
+
+      std::fill(packed + mr, packed + MR, T(0));
+      packed += MR;
+    }
+  }
+}
+
+/**
+ * Internal: Pack a panel of B into slivers of NR columns, each stored one row after another. The
+ * last sliver is padded with zeros.
+ */
+template <typename T>
+void Gemm<T>::PackB(MatrixView<T> const &b, SizeType kc, SizeType nc, T *packed)
+{
+  for (SizeType jr = 0; jr < nc; jr += NR)
+  {
+    SizeType const nr = std::min(NR, nc - jr);
+
+    for (SizeType p = 0; p < kc; ++p)
+    {
+      for (SizeType j = 0; j < nr; ++j)
+      {
+        packed[j] = b(p, jr + j);
+      }
+
+      std::fill(packed + nr, packed + NR, T(0));
+      packed += NR;
+    }
+  }
+}
+
+/**
+ * Internal: Compute an MR x NR tile of C from a packed sliver of A and a packed sliver of B, only
+ * the top left mr x nr part of the tile is written back
+ */
+template <typename T>
+void Gemm<T>::MicroKernel(SizeType kc, T const *a, T const *b, T *c, SizeType ldc, SizeType mr,
+                          SizeType nr, bool accumulate)
+{
+  T tile[NR][MR];
+  for (auto &column : tile)
+  {
+    std::fill(column, column + MR, T(0));
+  }
+
+  for (SizeType p = 0; p < kc; ++p)
+  {
+    for (SizeType j = 0; j < NR; ++j)
+    {
+      T const b_pj = b[j];
+
+      for (SizeType i = 0; i < MR; ++i)
+      {
+        tile[j][i] += a[i] * b_pj;
+      }
+    }
+
+    a += MR;
+    b += NR;
+  }
+
+  for (SizeType j = 0; j < nr; ++j)
+  {
+    T *c_j = c + (j * ldc);
+
+    for (SizeType i = 0; i < mr; ++i)
+    {
+      c_j[i] = accumulate ? c_j[i] + tile[j][i] : tile[j][i];
+    }
+  }
+}
+
+template <typename T>
+SizeType Gemm<T>::RoundUp(SizeType value, SizeType multiple)
+{
+  return ((value + multiple - 1) / multiple) * multiple;
+}
+
+}  // namespace linalg
+}  // namespace math
+}  // namespace fetch
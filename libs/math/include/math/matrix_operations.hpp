@@ -23,6 +23,7 @@
 #include "math/base_types.hpp"
 #include "math/comparison.hpp"
 #include "math/fundamental_operators.hpp"  // add, subtract etc.
+#include "math/linalg/gemm.hpp"
 
 namespace fetch {
 namespace math {
@@ -741,25 +742,30 @@ T ArgMax(std::vector<T> const &obj1)
   return ret;
 }
 
+/**
+ * Routine for C = A.B, computed with the packed and cache blocked matrix multiply
+ * @param A
+ * @param B
+ * @param ret
+ * @return
+ */
 template <typename ArrayType>
 fetch::math::meta::IfIsMathArray<ArrayType, void> Dot(ArrayType const &A, ArrayType const &B,
                                                       ArrayType &ret)
 {
+  using Type = typename ArrayType::Type;
+  using View = linalg::MatrixView<Type>;
+
   ASSERT(A.shape().size() == 2);
   ASSERT(B.shape().size() == 2);
   ASSERT(A.shape()[1] == B.shape()[0]);
+  ASSERT(A.shape()[0] == ret.shape()[0]);
+  ASSERT(B.shape()[1] == ret.shape()[1]);
 
-  for (SizeType i(0); i < A.shape()[0]; ++i)
-  {
-    for (SizeType j(0); j < B.shape()[1]; ++j)
-    {
-      ret.At(i, j) = A.At(i, 0) * B.At(0, j);
-      for (SizeType k(1); k < A.shape()[1]; ++k)
-      {
-        ret.At(i, j) += A.At(i, k) * B.At(k, j);
-      }
-    }
-  }
+  linalg::Gemm<Type>::Compute(A.shape()[0], B.shape()[1], A.shape()[1],
+                              View{A.data().pointer(), A.padded_height(), false},
+                              View{B.data().pointer(), B.padded_height(), false},
+                              ret.data().pointer(), ret.padded_height(), false);
 }
 
 template <typename ArrayType>
@@ -772,7 +778,7 @@ ArrayType Dot(ArrayType const &A, ArrayType const &B)
 }
 
 /**
- * Naive routine for C = A.T(B)
+ * Routine for C += A.T(B), computed with the packed and cache blocked matrix multiply
  * @param A
  * @param B
  * @param ret
@@ -782,22 +788,19 @@ template <class ArrayType>
 fetch::math::meta::IfIsMathArray<ArrayType, void> DotTranspose(ArrayType const &A,
                                                                ArrayType const &B, ArrayType &ret)
 {
+  using Type = typename ArrayType::Type;
+  using View = linalg::MatrixView<Type>;
+
   ASSERT(A.shape().size() == 2);
   ASSERT(B.shape().size() == 2);
   ASSERT(A.shape()[1] == B.shape()[1]);
   ASSERT(A.shape()[0] == ret.shape()[0]);
   ASSERT(B.shape()[0] == ret.shape()[1]);
 
-  for (size_t i(0); i < A.shape()[0]; ++i)
-  {
-    for (size_t j(0); j < B.shape()[0]; ++j)
-    {
-      for (size_t k(0); k < A.shape()[1]; ++k)
-      {
-        ret.At(i, j) += A.At(i, k) * B.At(j, k);
-      }
-    }
-  }
+  linalg::Gemm<Type>::Compute(A.shape()[0], B.shape()[0], A.shape()[1],
+                              View{A.data().pointer(), A.padded_height(), false},
+                              View{B.data().pointer(), B.padded_height(), true},
+                              ret.data().pointer(), ret.padded_height(), true);
 }
 
 template <typename ArrayType>
@@ -811,7 +814,7 @@ fetch::math::meta::IfIsMathArray<ArrayType, ArrayType> DotTranspose(ArrayType co
 }
 
 /**
- * Naive routine for C = T(A).B
+ * Routine for C += T(A).B, computed with the packed and cache blocked matrix multiply
  * @param A
  * @param B
  * @param ret
@@ -821,20 +824,17 @@ template <class ArrayType>
 fetch::math::meta::IfIsMathArray<ArrayType, void> TransposeDot(ArrayType const &A,
                                                                ArrayType const &B, ArrayType &ret)
 {
+  using Type = typename ArrayType::Type;
+  using View = linalg::MatrixView<Type>;
+
   ASSERT(A.shape()[0] == B.shape()[0]);
   ASSERT(A.shape()[1] == ret.shape()[0]);
   ASSERT(B.shape()[1] == ret.shape()[1]);
 
-  for (size_t i(0); i < A.shape()[1]; ++i)
-  {
-    for (size_t j(0); j < B.shape()[1]; ++j)
-    {
-      for (size_t k(0); k < A.shape()[0]; ++k)
-      {
-        ret.At(i, j) += A.At(k, i) * B.At(k, j);
-      }
-    }
-  }
+  linalg::Gemm<Type>::Compute(A.shape()[1], B.shape()[1], A.shape()[0],
+                              View{A.data().pointer(), A.padded_height(), true},
+                              View{B.data().pointer(), B.padded_height(), false},
+                              ret.data().pointer(), ret.padded_height(), true);
 }
 
 template <class ArrayType>
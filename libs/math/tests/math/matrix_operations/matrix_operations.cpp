@@ -750,6 +750,116 @@ TYPED_TEST(FreeFunctionsTest, TransposeDot)
   EXPECT_NEAR(static_cast<double>(output(2, 3)), 59, 1e-5);
 }
 
+namespace {
+
+/**
+ * Fill a tensor with small integer values, so that the products are exact for all the types
+ */
+template <typename ArrayType>
+void FillSmallIntegers(ArrayType &array, fetch::random::LinearCongruentialGenerator &rng)
+{
+  using DataType = typename ArrayType::Type;
+
+  for (auto &value : array)
+  {
+    value = DataType(static_cast<int>(rng() % 7u) - 3);
+  }
+}
+
+/**
+ * Reference (naive) routine for C = op(A).op(B)
+ */
+template <typename ArrayType>
+ArrayType ReferenceDot(ArrayType const &A, ArrayType const &B, bool transpose_a, bool transpose_b)
+{
+  using DataType = typename ArrayType::Type;
+
+  SizeType const m = transpose_a ? A.shape()[1] : A.shape()[0];
+  SizeType const k = transpose_a ? A.shape()[0] : A.shape()[1];
+  SizeType const n = transpose_b ? B.shape()[0] : B.shape()[1];
+
+  ArrayType ret{{m, n}};
+  for (SizeType i = 0; i < m; ++i)
+  {
+    for (SizeType j = 0; j < n; ++j)
+    {
+      DataType sum{0};
+      for (SizeType p = 0; p < k; ++p)
+      {
+        sum += (transpose_a ? A.At(p, i) : A.At(i, p)) * (transpose_b ? B.At(j, p) : B.At(p, j));
+      }
+      ret.At(i, j) = sum;
+    }
+  }
+
+  return ret;
+}
+
+template <typename ArrayType>
+void ExpectEqualMatrices(ArrayType const &expected, ArrayType const &actual)
+{
+  ASSERT_EQ(expected.shape(), actual.shape());
+
+  for (SizeType i = 0; i < expected.shape()[0]; ++i)
+  {
+    for (SizeType j = 0; j < expected.shape()[1]; ++j)
+    {
+      ASSERT_NEAR(static_cast<double>(expected.At(i, j)), static_cast<double>(actual.At(i, j)),
+                  1e-5);
+    }
+  }
+}
+
+// sizes which are not multiples of the blocking parameters and large enough to be threaded
+constexpr SizeType BLOCKED_M = 131;
+constexpr SizeType BLOCKED_K = 261;
+constexpr SizeType BLOCKED_N = 67;
+
+}  // namespace
+
+TYPED_TEST(FreeFunctionsTest, Dot_Blocked)
+{
+  fetch::random::LinearCongruentialGenerator rng{};
+
+  TypeParam array1{{BLOCKED_M, BLOCKED_K}};
+  TypeParam array2{{BLOCKED_K, BLOCKED_N}};
+  FillSmallIntegers(array1, rng);
+  FillSmallIntegers(array2, rng);
+
+  // the output is overwritten
+  TypeParam output{{BLOCKED_M, BLOCKED_N}};
+  FillSmallIntegers(output, rng);
+  fetch::math::Dot(array1, array2, output);
+
+  ExpectEqualMatrices(ReferenceDot(array1, array2, false, false), output);
+}
+
+TYPED_TEST(FreeFunctionsTest, DotTranspose_Blocked)
+{
+  fetch::random::LinearCongruentialGenerator rng{};
+
+  TypeParam array1{{BLOCKED_N, BLOCKED_K}};
+  TypeParam array2{{BLOCKED_M, BLOCKED_K}};
+  FillSmallIntegers(array1, rng);
+  FillSmallIntegers(array2, rng);
+
+  ExpectEqualMatrices(ReferenceDot(array1, array2, false, true),
+                      fetch::math::DotTranspose(array1, array2));
+}
+
+TYPED_TEST(FreeFunctionsTest, TransposeDot_Blocked)
+{
+  fetch::random::LinearCongruentialGenerator rng{};
+
+  TypeParam array1{{BLOCKED_K, BLOCKED_M}};
+  TypeParam array2{{BLOCKED_K, BLOCKED_N}};
+  FillSmallIntegers(array1, rng);
+  FillSmallIntegers(array2, rng);
+
+  ExpectEqualMatrices(ReferenceDot(array1, array2, true, false),
+                      fetch::math::TransposeDot(array1, array2));
+}
+
 TYPED_TEST(FreeFunctionsTest, DynamicStitch)
 {
   using SizeType = typename TypeParam::SizeType;
@@ -0,0 +1,54 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/metric.hpp"
+
+#include <cstdint>
+#include <string>
+
+namespace fetch {
+namespace metrics {
+
+/**
+ * Monotonically increasing counter. Each thread updates its own shard so that increments from
+ * different threads do not contend on the same cache line.
+ */
+class Counter : public Metric
+{
+public:
+  using Metric::Metric;
+
+  void Increment(uint64_t amount = 1)
+  {
+    shards_[LocalShard()].value.fetch_add(amount, std::memory_order_relaxed);
+  }
+
+  uint64_t value() const
+  {
+    return Sum(shards_);
+  }
+
+  void ToStream(std::ostream &stream) const override;
+
+private:
+  Shards shards_{};
+};
+
+}  // namespace metrics
+}  // namespace fetch
@@ -0,0 +1,66 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/metric.hpp"
+
+#include <atomic>
+#include <string>
+
+namespace fetch {
+namespace metrics {
+
+/**
+ * A value which can be arbitrarily set, for example the size of a queue
+ */
+class Gauge : public Metric
+{
+public:
+  using Metric::Metric;
+
+  void Set(double value)
+  {
+    value_.store(value, std::memory_order_relaxed);
+  }
+
+  void Increment(double amount = 1.0)
+  {
+    double current = value_.load(std::memory_order_relaxed);
+    while (!value_.compare_exchange_weak(current, current + amount, std::memory_order_relaxed))
+    {
+    }
+  }
+
+  void Decrement(double amount = 1.0)
+  {
+    Increment(-amount);
+  }
+
+  double value() const
+  {
+    return value_.load(std::memory_order_relaxed);
+  }
+
+  void ToStream(std::ostream &stream) const override;
+
+private:
+  std::atomic<double> value_{0.0};
+};
+
+}  // namespace metrics
+}  // namespace fetch
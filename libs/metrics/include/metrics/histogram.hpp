@@ -0,0 +1,126 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/metric.hpp"
+
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+namespace fetch {
+namespace metrics {
+
+/**
+ * Latency histogram with HDR-style log-linear buckets.
+ *
+ * Each power of two range of nanosecond values is split into a fixed number of linear sub-buckets
+ * which bounds the relative error of any recorded value to 1 / SUB_BUCKETS. Recording only
+ * involves relaxed increments on the calling thread's shard.
+ */
+class Histogram : public Metric
+{
+public:
+  static constexpr std::size_t SUB_BUCKET_BITS = 3;
+  static constexpr std::size_t SUB_BUCKETS     = 1u << SUB_BUCKET_BITS;
+  static constexpr std::size_t MAX_EXPONENT    = 40;  ///< Values are clamped at ~18 minutes
+  static constexpr std::size_t NUM_BUCKETS = (MAX_EXPONENT - SUB_BUCKET_BITS + 1) * SUB_BUCKETS;
+
+  using Buckets = std::array<uint64_t, NUM_BUCKETS>;
+
+  struct Snapshot
+  {
+    Buckets  buckets{};
+    uint64_t count{0};
+    uint64_t sum{0};
+
+    uint64_t ValueAtPercentile(double percentile) const;
+  };
+
+  using Metric::Metric;
+
+  /**
+   * Record a latency value
+   *
+   * @param nanoseconds The duration in nanoseconds
+   */
+  void Record(uint64_t nanoseconds)
+  {
+    auto &shard = shards_[LocalShard()];
+    shard.buckets[BucketIndex(nanoseconds)].fetch_add(1, std::memory_order_relaxed);
+    shard.sum.fetch_add(nanoseconds, std::memory_order_relaxed);
+  }
+
+  template <typename Rep, typename Period>
+  void Record(std::chrono::duration<Rep, Period> const &duration)
+  {
+    auto const nanoseconds = std::chrono::duration_cast<std::chrono::nanoseconds>(duration).count();
+    Record(static_cast<uint64_t>(nanoseconds < 0 ? 0 : nanoseconds));
+  }
+
+  Snapshot GetSnapshot() const;
+
+  void ToStream(std::ostream &stream) const override;
+
+  static std::size_t BucketIndex(uint64_t value);
+  static uint64_t    BucketUpperBound(std::size_t index);
+
+private:
+  struct alignas(64) HistogramShard
+  {
+    std::array<std::atomic<uint64_t>, NUM_BUCKETS> buckets{};
+    std::atomic<uint64_t>                          sum{0};
+  };
+
+  std::array<HistogramShard, NUM_SHARDS> shards_{};
+};
+
+/**
+ * Records the lifetime of the timer object into a histogram
+ */
+class HistogramTimer
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+
+  explicit HistogramTimer(Histogram &histogram)
+    : histogram_{histogram}
+  {}
+
+  HistogramTimer(HistogramTimer const &) = delete;
+  HistogramTimer(HistogramTimer &&)      = delete;
+
+  ~HistogramTimer()
+  {
+    histogram_.Record(Clock::now() - start_);
+  }
+
+  HistogramTimer &operator=(HistogramTimer const &) = delete;
+  HistogramTimer &operator=(HistogramTimer &&) = delete;
+
+private:
+  Histogram &     histogram_;
+  Timepoint const start_{Clock::now()};
+};
+
+}  // namespace metrics
+}  // namespace fetch
@@ -0,0 +1,88 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <iosfwd>
+#include <string>
+
+namespace fetch {
+namespace metrics {
+
+/**
+ * Base class for all the metrics which are exposed through the registry
+ */
+class Metric
+{
+public:
+  static constexpr std::size_t NUM_SHARDS = 8;
+
+  // Construction / Destruction
+  Metric(std::string name, std::string description);
+  Metric(Metric const &) = delete;
+  Metric(Metric &&)      = delete;
+  virtual ~Metric()      = default;
+
+  std::string const &name() const
+  {
+    return name_;
+  }
+
+  std::string const &description() const
+  {
+    return description_;
+  }
+
+  /**
+   * Write the metric to the stream in the Prometheus text exposition format
+   *
+   * @param stream The output stream
+   */
+  virtual void ToStream(std::ostream &stream) const = 0;
+
+  // Operators
+  Metric &operator=(Metric const &) = delete;
+  Metric &operator=(Metric &&) = delete;
+
+protected:
+  /**
+   * A value which is updated independently by the threads mapped to it, padded so that each
+   * shard occupies its own cache line
+   */
+  struct alignas(64) Shard
+  {
+    std::atomic<uint64_t> value{0};
+  };
+
+  using Shards = std::array<Shard, NUM_SHARDS>;
+
+  static std::size_t LocalShard();
+  static uint64_t    Sum(Shards const &shards);
+
+  void WriteHeader(std::ostream &stream, char const *type) const;
+
+private:
+  std::string const name_;
+  std::string const description_;
+};
+
+}  // namespace metrics
+}  // namespace fetch
@@ -0,0 +1,78 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/counter.hpp"
+#include "metrics/gauge.hpp"
+#include "metrics/histogram.hpp"
+
+#include <iosfwd>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+
+namespace fetch {
+namespace metrics {
+
+/**
+ * Process wide collection of named metrics.
+ *
+ * Looking up a metric takes the registry lock, so callers are expected to look up the metrics
+ * they update once (typically on construction) and keep the returned reference. The metrics
+ * themselves are never removed so the references remain valid for the lifetime of the process.
+ */
+class Registry
+{
+public:
+  // Singleton instance
+  static Registry &Instance();
+
+  // Construction / Destruction
+  Registry()                 = default;
+  Registry(Registry const &) = delete;
+  Registry(Registry &&)      = delete;
+  ~Registry()                = default;
+
+  /// @name Metric Lookup
+  /// @{
+  Counter &  LookupCounter(std::string const &name, std::string const &description);
+  Gauge &    LookupGauge(std::string const &name, std::string const &description);
+  Histogram &LookupHistogram(std::string const &name, std::string const &description);
+  /// @}
+
+  void        Collect(std::ostream &stream) const;
+  std::size_t size() const;
+
+  // Operators
+  Registry &operator=(Registry const &) = delete;
+  Registry &operator=(Registry &&) = delete;
+
+private:
+  using MetricPtr = std::unique_ptr<Metric>;
+  using MetricMap = std::map<std::string, MetricPtr>;
+
+  template <typename T>
+  T &Lookup(std::string const &name, std::string const &description);
+
+  mutable std::mutex lock_;
+  MetricMap          metrics_;
+};
+
+}  // namespace metrics
+}  // namespace fetch
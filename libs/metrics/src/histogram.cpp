@@ -0,0 +1,178 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/histogram.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <ostream>
+
+namespace fetch {
+namespace metrics {
+namespace {
+
+constexpr std::size_t MIN_EXPOSED_EXPONENT   = 10;  ///< The smallest exposed bound is ~1us
+constexpr double      NANOSECONDS_PER_SECOND = 1e9;
+constexpr int         BOUND_PRECISION        = 12;
+
+}  // namespace
+
+/**
+ * Determine the value below which the given percentage of recorded values fall. The value is
+ * reported as the upper bound of the bucket in which it was recorded.
+ *
+ * @param percentile The percentile in the range [0, 100]
+ * @return The value at the percentile
+ */
+uint64_t Histogram::Snapshot::ValueAtPercentile(double percentile) const
+{
+  if (count == 0)
+  {
+    return 0;
+  }
+
+  auto const target = static_cast<uint64_t>(
+      std::ceil(std::min(std::max(percentile, 0.0), 100.0) / 100.0 * static_cast<double>(count)));
+
+  uint64_t total{0};
+  for (std::size_t i = 0; i < NUM_BUCKETS; ++i)
+  {
+    total += buckets[i];
+    if ((total >= target) && (total > 0))
+    {
+      return BucketUpperBound(i);
+    }
+  }
+
+  return BucketUpperBound(NUM_BUCKETS - 1);
+}
+
+/**
+ * Collect the values from all the shards
+ *
+ * @return The snapshot of the histogram
+ */
+Histogram::Snapshot Histogram::GetSnapshot() const
+{
+  Snapshot snapshot{};
+
+  for (auto const &shard : shards_)
+  {
+    for (std::size_t i = 0; i < NUM_BUCKETS; ++i)
+    {
+      snapshot.buckets[i] += shard.buckets[i].load(std::memory_order_relaxed);
+    }
+    snapshot.sum += shard.sum.load(std::memory_order_relaxed);
+  }
+
+  for (auto const &bucket : snapshot.buckets)
+  {
+    snapshot.count += bucket;
+  }
+
+  return snapshot;
+}
+
+/**
+ * Write the histogram in the Prometheus format. In order to keep the exposition compact the
+ * cumulative counts are reported at power of two boundaries (in seconds) rather than for each of
+ * the internal buckets.
+ *
+ * @param stream The output stream
+ */
+void Histogram::ToStream(std::ostream &stream) const
+{
+  auto const snapshot = GetSnapshot();
+
+  WriteHeader(stream, "histogram");
+
+  // the bounds are exact powers of two which require more than the default precision
+  auto const precision = stream.precision(BOUND_PRECISION);
+
+  std::size_t index{0};
+  uint64_t    cumulative{0};
+  for (std::size_t exponent = MIN_EXPOSED_EXPONENT; exponent <= MAX_EXPONENT; ++exponent)
+  {
+    uint64_t const bound = uint64_t{1} << exponent;
+
+    // accumulate all the buckets whose values are strictly less than the bound
+    for (; (index < NUM_BUCKETS) && (BucketUpperBound(index) < bound); ++index)
+    {
+      cumulative += snapshot.buckets[index];
+    }
+
+    stream << name() << "_bucket{le=\"" << (static_cast<double>(bound) / NANOSECONDS_PER_SECOND)
+           << "\"} " << cumulative << '\n';
+  }
+
+  auto const sum = static_cast<double>(snapshot.sum) / NANOSECONDS_PER_SECOND;
+
+  stream << name() << "_bucket{le=\"+Inf\"} " << snapshot.count << '\n';
+  stream << name() << "_sum " << sum << '\n';
+  stream << name() << "_count " << snapshot.count << '\n';
+
+  stream.precision(precision);
+}
+
+/**
+ * Map a value onto its bucket
+ *
+ * @param value The input value
+ * @return The index of the bucket
+ */
+std::size_t Histogram::BucketIndex(uint64_t value)
+{
+  // small values are mapped linearly
+  if (value < SUB_BUCKETS)
+  {
+    return static_cast<std::size_t>(value);
+  }
+
+  auto const exponent = static_cast<std::size_t>(63 - __builtin_clzll(value));
+  if (exponent >= MAX_EXPONENT)
+  {
+    return NUM_BUCKETS - 1;
+  }
+
+  auto const shift      = exponent - SUB_BUCKET_BITS;
+  auto const sub_bucket = static_cast<std::size_t>(value >> shift) - SUB_BUCKETS;
+
+  return ((shift + 1) * SUB_BUCKETS) + sub_bucket;
+}
+
+/**
+ * Determine the largest value which is mapped onto the bucket
+ *
+ * @param index The index of the bucket
+ * @return The inclusive upper bound of the bucket
+ */
+uint64_t Histogram::BucketUpperBound(std::size_t index)
+{
+  if (index < SUB_BUCKETS)
+  {
+    return index;
+  }
+
+  auto const shift      = (index / SUB_BUCKETS) - 1;
+  auto const sub_bucket = index % SUB_BUCKETS;
+
+  return ((SUB_BUCKETS + sub_bucket + 1) << shift) - 1;
+}
+
+}  // namespace metrics
+}  // namespace fetch
@@ -0,0 +1,110 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/metric.hpp"
+
+#include <cctype>
+#include <ostream>
+#include <stdexcept>
+#include <utility>
+
+namespace fetch {
+namespace metrics {
+namespace {
+
+/**
+ * Determine if the name is a valid Prometheus metric name, i.e. [a-zA-Z_:][a-zA-Z0-9_:]*
+ */
+bool IsValidName(std::string const &name)
+{
+  if (name.empty() || std::isdigit(static_cast<unsigned char>(name[0])))
+  {
+    return false;
+  }
+
+  for (char c : name)
+  {
+    if (!(std::isalnum(static_cast<unsigned char>(c)) || (c == '_') || (c == ':')))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+}  // namespace
+
+Metric::Metric(std::string name, std::string description)
+  : name_{std::move(name)}
+  , description_{std::move(description)}
+{
+  if (!IsValidName(name_))
+  {
+    throw std::runtime_error("Invalid metric name: " + name_);
+  }
+}
+
+/**
+ * Determine the shard to be updated by the calling thread. Threads are assigned shards in a round
+ * robin fashion the first time they update any metric.
+ *
+ * @return The shard index for the calling thread
+ */
+std::size_t Metric::LocalShard()
+{
+  static std::atomic<std::size_t> next_shard{0};
+  thread_local std::size_t const  shard = next_shard++ % NUM_SHARDS;
+
+  return shard;
+}
+
+uint64_t Metric::Sum(Shards const &shards)
+{
+  uint64_t total{0};
+  for (auto const &shard : shards)
+  {
+    total += shard.value.load(std::memory_order_relaxed);
+  }
+  return total;
+}
+
+void Metric::WriteHeader(std::ostream &stream, char const *type) const
+{
+  stream << "# HELP " << name_ << ' ';
+  for (char c : description_)
+  {
+    switch (c)
+    {
+    case '\\':
+      stream << "\\\\";
+      break;
+    case '\n':
+      stream << "\\n";
+      break;
+    default:
+      stream << c;
+      break;
+    }
+  }
+  stream << '\n';
+  stream << "# TYPE " << name_ << ' ' << type << '\n';
+}
+
+}  // namespace metrics
+}  // namespace fetch
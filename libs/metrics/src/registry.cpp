@@ -0,0 +1,98 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/registry.hpp"
+
+#include <ostream>
+#include <stdexcept>
+
+namespace fetch {
+namespace metrics {
+
+Registry &Registry::Instance()
+{
+  static Registry instance;
+  return instance;
+}
+
+Counter &Registry::LookupCounter(std::string const &name, std::string const &description)
+{
+  return Lookup<Counter>(name, description);
+}
+
+Gauge &Registry::LookupGauge(std::string const &name, std::string const &description)
+{
+  return Lookup<Gauge>(name, description);
+}
+
+Histogram &Registry::LookupHistogram(std::string const &name, std::string const &description)
+{
+  return Lookup<Histogram>(name, description);
+}
+
+/**
+ * Write all the registered metrics to the stream in the Prometheus text exposition format
+ *
+ * @param stream The output stream
+ */
+void Registry::Collect(std::ostream &stream) const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+
+  for (auto const &element : metrics_)
+  {
+    element.second->ToStream(stream);
+  }
+}
+
+std::size_t Registry::size() const
+{
+  std::lock_guard<std::mutex> lock(lock_);
+  return metrics_.size();
+}
+
+/**
+ * Lookup (creating if necessary) a metric of the specified type
+ *
+ * @tparam T The type of the metric
+ * @param name The name of the metric
+ * @param description The description of the metric, used only when the metric is created
+ * @return The reference to the metric
+ */
+template <typename T>
+T &Registry::Lookup(std::string const &name, std::string const &description)
+{
+  std::lock_guard<std::mutex> lock(lock_);
+
+  auto it = metrics_.find(name);
+  if (it == metrics_.end())
+  {
+    it = metrics_.emplace(name, std::make_unique<T>(name, description)).first;
+  }
+
+  auto *typed_metric = dynamic_cast<T *>(it->second.get());
+  if (typed_metric == nullptr)
+  {
+    throw std::runtime_error("Metric " + name + " has already been registered with another type");
+  }
+
+  return *typed_metric;
+}
+
+}  // namespace metrics
+}  // namespace fetch
@@ -0,0 +1,148 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "metrics/registry.hpp"
+
+#include <gtest/gtest.h>
+
+#include <chrono>
+#include <cstdint>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+using fetch::metrics::Histogram;
+using fetch::metrics::Registry;
+
+TEST(MetricsTests, CheckCountersAggregateAcrossThreads)
+{
+  static constexpr std::size_t NUM_THREADS    = 4;
+  static constexpr std::size_t NUM_INCREMENTS = 10000;
+
+  Registry registry;
+  auto &   counter = registry.LookupCounter("test_events_total", "Events");
+
+  std::vector<std::thread> threads;
+  for (std::size_t i = 0; i < NUM_THREADS; ++i)
+  {
+    threads.emplace_back([&counter]() {
+      for (std::size_t j = 0; j < NUM_INCREMENTS; ++j)
+      {
+        counter.Increment();
+      }
+    });
+  }
+
+  for (auto &thread : threads)
+  {
+    thread.join();
+  }
+
+  EXPECT_EQ(counter.value(), NUM_THREADS * NUM_INCREMENTS);
+
+  // subsequent lookups return the same metric
+  EXPECT_EQ(&registry.LookupCounter("test_events_total", "Events"), &counter);
+  EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(MetricsTests, CheckInvalidLookupsAreRejected)
+{
+  Registry registry;
+  registry.LookupCounter("test_value", "Value");
+
+  EXPECT_THROW(registry.LookupGauge("test_value", "Value"), std::runtime_error);
+  EXPECT_THROW(registry.LookupCounter("0_invalid", "Invalid"), std::runtime_error);
+  EXPECT_THROW(registry.LookupCounter("test-invalid", "Invalid"), std::runtime_error);
+  EXPECT_EQ(registry.size(), 1u);
+}
+
+TEST(MetricsTests, CheckHistogramBucketsBoundTheRelativeError)
+{
+  // the buckets are contiguous
+  for (std::size_t i = 1; i < Histogram::NUM_BUCKETS; ++i)
+  {
+    ASSERT_EQ(Histogram::BucketIndex(Histogram::BucketUpperBound(i - 1) + 1), i);
+    ASSERT_EQ(Histogram::BucketIndex(Histogram::BucketUpperBound(i)), i);
+  }
+
+  for (uint64_t value : {0ull, 7ull, 8ull, 1000ull, 123456789ull, 1ull << 39u})
+  {
+    auto const upper = Histogram::BucketUpperBound(Histogram::BucketIndex(value));
+    EXPECT_GE(upper, value);
+    EXPECT_LE(static_cast<double>(upper - value),
+              static_cast<double>(value) / static_cast<double>(Histogram::SUB_BUCKETS));
+  }
+
+  // values beyond the range are clamped into the last bucket
+  EXPECT_EQ(Histogram::BucketIndex(~uint64_t{0}), Histogram::NUM_BUCKETS - 1);
+}
+
+TEST(MetricsTests, CheckHistogramPercentiles)
+{
+  Registry registry;
+  auto &   histogram = registry.LookupHistogram("test_latency_seconds", "Latency");
+
+  for (uint64_t i = 1; i <= 1000; ++i)
+  {
+    histogram.Record(std::chrono::microseconds{i});
+  }
+
+  auto const snapshot = histogram.GetSnapshot();
+  EXPECT_EQ(snapshot.count, 1000u);
+  EXPECT_EQ(snapshot.sum, 500500000u);
+
+  auto const median = snapshot.ValueAtPercentile(50.0);
+  EXPECT_GE(median, 500000u);
+  EXPECT_LE(median, 500000u + 500000u / Histogram::SUB_BUCKETS);
+
+  auto const p99 = snapshot.ValueAtPercentile(99.0);
+  EXPECT_GE(p99, 990000u);
+  EXPECT_LE(p99, 990000u + 990000u / Histogram::SUB_BUCKETS);
+}
+
+TEST(MetricsTests, CheckPrometheusExposition)
+{
+  Registry registry;
+  registry.LookupCounter("test_requests_total", "The number of requests").Increment(3);
+  registry.LookupGauge("test_queue_size", "The size of the queue").Set(5);
+
+  auto &histogram = registry.LookupHistogram("test_duration_seconds", "The duration");
+  histogram.Record(std::chrono::microseconds{3});
+  histogram.Record(std::chrono::milliseconds{2});
+
+  std::ostringstream stream;
+  registry.Collect(stream);
+
+  auto const text = stream.str();
+  EXPECT_NE(text.find("# HELP test_requests_total The number of requests\n"
+                      "# TYPE test_requests_total counter\n"
+                      "test_requests_total 3\n"),
+            std::string::npos);
+  EXPECT_NE(text.find("# TYPE test_queue_size gauge\ntest_queue_size 5\n"), std::string::npos);
+  EXPECT_NE(text.find("# TYPE test_duration_seconds histogram\n"), std::string::npos);
+  EXPECT_NE(text.find("test_duration_seconds_bucket{le=\"1.024e-06\"} 0\n"), std::string::npos);
+  EXPECT_NE(text.find("test_duration_seconds_bucket{le=\"0.002097152\"} 2\n"), std::string::npos);
+  EXPECT_NE(text.find("test_duration_seconds_bucket{le=\"+Inf\"} 2\n"), std::string::npos);
+  EXPECT_NE(text.find("test_duration_seconds_count 2\n"), std::string::npos);
+}
+
+}  // namespace
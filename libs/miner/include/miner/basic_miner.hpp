@@ -60,6 +60,7 @@ public:
   /// @{
   void     EnqueueTransaction(ledger::Transaction const &tx) override;
   void     EnqueueTransaction(ledger::TransactionLayout const &layout) override;
+  void     EnqueueTransactions(TransactionLayouts const &layouts) override;
   void     GenerateBlock(Block &block, std::size_t num_lanes, std::size_t num_slices,
                          MainChain const &chain) override;
   uint64_t GetBacklog() const override;
@@ -86,6 +87,8 @@ private:
   static bool SortByFee(TransactionLayout const &a, TransactionLayout const &b);
   /// @}
 
+  void AddPendingTransaction(ledger::TransactionLayout const &layout);
+
   /// @name Configuration
   /// @{
   uint32_t       log2_num_lanes_;   ///< The log2 of the number of lanes
@@ -83,7 +83,33 @@ void BasicMiner::EnqueueTransaction(ledger::Transaction const &tx)
 void BasicMiner::EnqueueTransaction(ledger::TransactionLayout const &layout)
 {
   FETCH_LOCK(pending_lock_);
+  AddPendingTransaction(layout);
+}
+
+/**
+ * Add a series of transaction layouts to the internal queue. The pending queue lock is only taken
+ * once for the whole batch.
+ *
+ * @param layouts The layouts to be added to the queue
+ */
+void BasicMiner::EnqueueTransactions(TransactionLayouts const &layouts)
+{
+  FETCH_LOCK(pending_lock_);
+
+  for (auto const &layout : layouts)
+  {
+    AddPendingTransaction(layout);
+  }
+}
 
+/**
+ * Internal: Add a transaction layout to the pending queue. The caller must hold the pending queue
+ * lock.
+ *
+ * @param layout The layout to be added to the queue
+ */
+void BasicMiner::AddPendingTransaction(ledger::TransactionLayout const &layout)
+{
   if (layout.mask().size() != (1u << log2_num_lanes_))
   {
     FETCH_LOG_WARN(LOGGING_NAME, "Disgarding layout due to incompatible mask size");
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/serializers/byte_array_buffer.hpp"
+#include "crypto/ecdsa.hpp"
+#include "network/muddle/packet.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::byte_array::ConstByteArray;
+using fetch::crypto::ECDSASigner;
+using fetch::muddle::Packet;
+using fetch::serializers::ByteArrayBuffer;
+
+/**
+ * Build the wire format of a signed packet with a payload of the specified size
+ *
+ * @param payload_size The size of the payload in bytes
+ * @return The serialized packet
+ */
+ConstByteArray CreateWirePacket(std::size_t payload_size)
+{
+  ECDSASigner signer{};
+  signer.GenerateKeys();
+
+  ByteArray payload;
+  payload.Resize(payload_size);
+  for (std::size_t i = 0; i < payload_size; ++i)
+  {
+    payload[i] = static_cast<uint8_t>(i);
+  }
+
+  Packet packet{signer.identity().identifier(), 0};
+  packet.SetService(1);
+  packet.SetProtocol(2);
+  packet.SetMessageNum(3);
+  packet.SetTTL(40);
+  packet.SetPayload(payload);
+  packet.Sign(signer);
+
+  ByteArrayBuffer buffer;
+  buffer << packet;
+
+  return buffer.data();
+}
+
+/**
+ * Relay a packet the way the router did previously: decode into a new packet (copying the wire
+ * data), decrement the TTL and then serialize the packet again for each outbound connection
+ */
+void Packet_RelayReserialize(benchmark::State &state)
+{
+  auto const payload_size = static_cast<std::size_t>(state.range(0));
+  auto const fan_out      = static_cast<std::size_t>(state.range(1));
+  auto const wire         = CreateWirePacket(payload_size);
+
+  for (auto _ : state)
+  {
+    ByteArrayBuffer input{wire};
+
+    auto packet = std::make_shared<Packet>();
+    input >> *packet;
+    packet->SetTTL(static_cast<uint8_t>(packet->GetTTL() - 1));
+
+    for (std::size_t i = 0; i < fan_out; ++i)
+    {
+      ByteArrayBuffer output;
+      output << *packet;
+
+      benchmark::DoNotOptimize(output.data().pointer());
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wire.size() * fan_out));
+}
+
+/**
+ * Relay a packet by retaining its wire buffer: the TTL is patched in place and the same buffer is
+ * handed to every outbound connection
+ */
+void Packet_RelayZeroCopy(benchmark::State &state)
+{
+  auto const payload_size = static_cast<std::size_t>(state.range(0));
+  auto const fan_out      = static_cast<std::size_t>(state.range(1));
+  auto const wire         = CreateWirePacket(payload_size);
+
+  for (auto _ : state)
+  {
+    // the network layer provides a freshly allocated buffer for each received message
+    state.PauseTiming();
+    ConstByteArray input = wire.Copy();
+    state.ResumeTiming();
+
+    auto packet = std::make_shared<Packet>();
+    packet->FromBuffer(input);
+    packet->SetTTL(static_cast<uint8_t>(packet->GetTTL() - 1));
+
+    for (std::size_t i = 0; i < fan_out; ++i)
+    {
+      benchmark::DoNotOptimize(packet->ToBuffer().pointer());
+    }
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(wire.size() * fan_out));
+}
+
+void RelayArguments(benchmark::internal::Benchmark *b)
+{
+  for (int64_t payload_size : {64, 1024, 64 * 1024})
+  {
+    for (int64_t fan_out : {1, 8})
+    {
+      b->Args({payload_size, fan_out});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Packet_RelayReserialize)->Apply(RelayArguments);
+BENCHMARK(Packet_RelayZeroCopy)->Apply(RelayArguments);
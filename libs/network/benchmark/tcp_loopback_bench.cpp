@@ -0,0 +1,195 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "metrics/registry.hpp"
+#include "network/management/network_manager.hpp"
+#include "network/tcp/tcp_client.hpp"
+#include "network/tcp/tcp_server.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::network::NetworkManager;
+using fetch::network::TCPClient;
+using fetch::network::TCPServer;
+using fetch::network::message_type;
+
+using Counter = std::atomic<std::size_t>;
+
+constexpr std::size_t MESSAGES_PER_ITERATION = 1000;
+constexpr uint16_t    BASE_PORT              = 8750;
+
+/**
+ * The socket operations performed by all the TCP clients in this process
+ */
+struct SocketCounts
+{
+  uint64_t reads{0};
+  uint64_t writes{0};
+
+  static SocketCounts Sample()
+  {
+    auto &registry = fetch::metrics::Registry::Instance();
+
+    SocketCounts counts;
+    counts.reads  = registry.LookupCounter("tcp_client_socket_reads_total", "").value();
+    counts.writes = registry.LookupCounter("tcp_client_socket_writes_total", "").value();
+
+    return counts;
+  }
+};
+
+class CountingServer : public TCPServer
+{
+public:
+  CountingServer(uint16_t port, NetworkManager const &network_manager)
+    : TCPServer(port, network_manager)
+  {}
+
+  void PushRequest(connection_handle_type, message_type const &) override
+  {
+    ++received;
+  }
+
+  Counter received{0};
+};
+
+class CountingClient : public TCPClient
+{
+public:
+  explicit CountingClient(NetworkManager const &network_manager)
+    : TCPClient(network_manager)
+  {
+    OnMessage([this](message_type const &) { ++received; });
+  }
+
+  ~CountingClient()
+  {
+    TCPClient::Cleanup();
+  }
+
+  Counter received{0};
+};
+
+void WaitFor(Counter const &counter, std::size_t target)
+{
+  while (counter < target)
+  {
+    std::this_thread::yield();
+  }
+}
+
+message_type CreateMessage(std::size_t size)
+{
+  ByteArray message;
+  message.Resize(size);
+  return message;
+}
+
+/**
+ * Stream messages over loopback in the direction specified by the second argument (0: from the
+ * client to the server, 1: from the server to the client). Only the client side of the connection
+ * is counted in the socket statistics, i.e. writes when sending and reads when receiving.
+ */
+void Tcp_Loopback(benchmark::State &state)
+{
+  static uint16_t next_port = BASE_PORT;
+
+  auto const message_size     = static_cast<std::size_t>(state.range(0));
+  bool const server_to_client = state.range(1) != 0;
+  auto const port             = next_port++;
+
+  NetworkManager network_manager{"TcpBench", 2};
+  network_manager.Start();
+
+  CountingServer server{port, network_manager};
+  server.Start();
+
+  CountingClient client{network_manager};
+  client.Connect("127.0.0.1", port);
+  if (!client.WaitForAlive(3000))
+  {
+    state.SkipWithError("Unable to connect to server");
+    return;
+  }
+
+  auto const message = CreateMessage(message_size);
+
+  std::size_t  expected{0};
+  SocketCounts start = SocketCounts::Sample();
+
+  for (auto _ : state)
+  {
+    expected += MESSAGES_PER_ITERATION;
+
+    if (server_to_client)
+    {
+      for (std::size_t i = 0; i < MESSAGES_PER_ITERATION; ++i)
+      {
+        server.Broadcast(message);
+      }
+
+      WaitFor(client.received, expected);
+    }
+    else
+    {
+      for (std::size_t i = 0; i < MESSAGES_PER_ITERATION; ++i)
+      {
+        client.Send(message);
+      }
+
+      WaitFor(server.received, expected);
+    }
+  }
+
+  SocketCounts const end      = SocketCounts::Sample();
+  auto const         messages = static_cast<double>(expected);
+
+  state.SetItemsProcessed(static_cast<int64_t>(expected));
+  state.SetBytesProcessed(static_cast<int64_t>(expected * message_size));
+  state.counters["reads_per_msg"]  = static_cast<double>(end.reads - start.reads) / messages;
+  state.counters["writes_per_msg"] = static_cast<double>(end.writes - start.writes) / messages;
+
+  client.Close();
+  server.Stop();
+  network_manager.Stop();
+}
+
+void LoopbackArguments(benchmark::internal::Benchmark *b)
+{
+  for (int64_t direction : {0, 1})
+  {
+    for (int64_t message_size : {64, 1024, 16 * 1024})
+    {
+      b->Args({message_size, direction});
+    }
+  }
+}
+
+}  // namespace
+
+BENCHMARK(Tcp_Loopback)->Apply(LoopbackArguments)->UseRealTime();
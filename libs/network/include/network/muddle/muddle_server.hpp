@@ -87,13 +87,14 @@ private:
     {
       LOG_STACK_TRACE_POINT;
       // un-marshall the data
-      ByteArrayBuffer buffer(msg);
-
       auto packet = std::make_shared<Packet>();
 
       {
         LOG_STACK_TRACE_POINT;
-        buffer >> *packet;
+        if (!packet->FromBuffer(msg))
+        {
+          throw std::runtime_error("Unable to decode packet");
+        }
       }
 
       // dispatch the message to router
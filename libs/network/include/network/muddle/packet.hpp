@@ -19,9 +19,12 @@
 
 #include "core/byte_array/byte_array.hpp"
 #include "core/byte_array/const_byte_array.hpp"
+#include "core/serializers/byte_array.hpp"
 #include "core/serializers/byte_array_buffer.hpp"
+#include "core/serializers/stl_types.hpp"
 #include "crypto/prover.hpp"
 #include "crypto/verifier.hpp"
+#include "crypto/verifier_cache.hpp"
 
 #include <array>
 #include <cstdint>
@@ -77,6 +80,7 @@ public:
   using Address    = byte_array::ConstByteArray;
   using Payload    = byte_array::ConstByteArray;
   using Stamp      = byte_array::ConstByteArray;
+  using Buffer     = byte_array::ConstByteArray;
 
   struct RoutingHeader
   {
@@ -150,6 +154,12 @@ public:
   void Sign(crypto::Prover &prover);
   bool Verify() const;
 
+  /// @name Wire Format
+  /// @{
+  bool          FromBuffer(Buffer const &buffer);
+  Buffer const &ToBuffer() const;
+  /// @}
+
 private:
   RoutingHeader header_;   ///< The header containing primarily routing information
   Payload       payload_;  ///< The payload of the message
@@ -159,6 +169,10 @@ private:
   mutable Address target_;
   mutable Address sender_;
 
+  ///< Cached wire format of the packet, shared by all the connections it is sent to
+  mutable Buffer buffer_;
+  mutable bool   buffer_shared_{false};
+
   void         SetStamped(bool set = true) noexcept;
   BinaryHeader StaticHeader() const noexcept;
 
@@ -304,6 +318,23 @@ inline void Packet::SetTTL(uint8_t ttl) noexcept
 {
   header_.ttl = ttl;
   // stamps are not invalidated
+
+  if (!buffer_.empty())
+  {
+    if (buffer_shared_)
+    {
+      // the buffer could be queued for sending on a connection so it must not be modified
+      buffer_ = Buffer{};
+    }
+    else
+    {
+      // The buffer is exclusively owned by this packet (the network layer allocates a new buffer
+      // for each received message) and has not yet been handed to any connection, so the first
+      // word of the header (which contains the TTL) can be patched in place.
+      Buffer const &buffer = buffer_;
+      std::memcpy(const_cast<uint8_t *>(buffer.pointer()), &header_, sizeof(uint32_t));
+    }
+  }
 }
 
 inline void Packet::SetService(uint16_t service_num) noexcept
@@ -352,6 +383,10 @@ inline void Packet::SetPayload(Payload const &payload)
 inline void Packet::SetStamped(bool set) noexcept
 {
   header_.stamped = set;
+
+  // all the modifications (other than the TTL) to the packet invalidate the wire format
+  buffer_        = Buffer{};
+  buffer_shared_ = false;
 }
 
 inline Packet::BinaryHeader Packet::StaticHeader() const noexcept
@@ -384,8 +419,9 @@ inline bool Packet::Verify() const
   {
     return false;  // null signature is not genuine in non-trusted networks
   }
-  auto retVal = crypto::Verify(
-      GetSender(), (serializers::ByteArrayBuffer() << StaticHeader() << payload_).data(), stamp_);
+  auto retVal = crypto::VerifierCache::Default().Verify(
+      crypto::Identity{GetSender()},
+      (serializers::ByteArrayBuffer() << StaticHeader() << payload_).data(), stamp_);
   return retVal;
 }
 
@@ -407,6 +443,92 @@ void Deserialize(T &serializer, Packet &packet)
   {
     serializer >> packet.stamp_;
   }
+
+  packet.buffer_        = Packet::Buffer{};
+  packet.buffer_shared_ = false;
+}
+
+/**
+ * Populate the packet from its wire format. The payload and stamp of the packet reference the
+ * buffer directly (no copies are made) and the buffer is retained so that the packet can be
+ * relayed without being serialized again.
+ *
+ * @param buffer The received wire format of the packet
+ * @return true if successful, otherwise false
+ */
+inline bool Packet::FromBuffer(Buffer const &buffer)
+{
+  std::size_t offset{0};
+
+  auto const read_size = [&buffer, &offset](uint64_t &size) {
+    if (buffer.size() < offset + sizeof(uint64_t))
+    {
+      return false;
+    }
+
+    std::memcpy(&size, buffer.pointer() + offset, sizeof(uint64_t));
+    offset += sizeof(uint64_t);
+
+    return (buffer.size() - offset) >= size;
+  };
+
+  if (buffer.size() < HEADER_SIZE)
+  {
+    return false;
+  }
+
+  std::memcpy(&header_, buffer.pointer(), HEADER_SIZE);
+  offset += HEADER_SIZE;
+
+  uint64_t payload_size{0};
+  if (!read_size(payload_size))
+  {
+    return false;
+  }
+
+  payload_ = buffer.SubArray(offset, payload_size);
+  offset += payload_size;
+
+  stamp_ = Stamp{};
+  if (header_.stamped)
+  {
+    uint64_t stamp_size{0};
+    if (!read_size(stamp_size))
+    {
+      return false;
+    }
+
+    stamp_ = buffer.SubArray(offset, stamp_size);
+    offset += stamp_size;
+  }
+
+  target_        = Address{};
+  sender_        = Address{};
+  buffer_        = (offset == buffer.size()) ? buffer : buffer.SubArray(0, offset);
+  buffer_shared_ = false;
+
+  return true;
+}
+
+/**
+ * Get the wire format of the packet, serializing it if required. Once the buffer has been
+ * returned it is treated as shared and will never be modified in place.
+ *
+ * @return The wire format of the packet
+ */
+inline Packet::Buffer const &Packet::ToBuffer() const
+{
+  if (buffer_.empty())
+  {
+    serializers::ByteArrayBuffer buffer;
+    buffer.Append(*this);
+
+    buffer_ = buffer.data();
+  }
+
+  buffer_shared_ = true;
+
+  return buffer_;
 }
 
 }  // namespace muddle
@@ -19,6 +19,7 @@
 
 #include "core/mutex.hpp"
 #include "crypto/prover.hpp"
+#include "metrics/registry.hpp"
 #include "network/details/thread_pool.hpp"
 #include "network/management/abstract_connection.hpp"
 #include "network/muddle/blacklist.hpp"
@@ -28,8 +29,12 @@
 #include "network/muddle/subscription_registrar.hpp"
 #include "network/p2pservice/p2p_service_defs.hpp"
 
+#include <array>
+#include <atomic>
 #include <chrono>
+#include <cstdint>
 #include <memory>
+#include <mutex>
 
 namespace fetch {
 namespace muddle {
@@ -62,6 +67,16 @@ public:
 
   using RoutingTable = std::unordered_map<Packet::RawAddress, RoutingData>;
 
+  struct RoutingStats
+  {
+    uint64_t packets_routed{0};              ///< The number of packets passed through the router
+    uint64_t routing_time_ns{0};             ///< The total time spent routing packets
+    uint64_t routing_table_lock_waits{0};    ///< The number of contended routing table accesses
+    uint64_t routing_table_lock_wait_ns{0};  ///< The total time spent waiting for the table
+    uint64_t echo_cache_lock_waits{0};       ///< The number of contended echo cache accesses
+    uint64_t echo_cache_lock_wait_ns{0};     ///< The total time spent waiting for the echo cache
+  };
+
   static constexpr char const *LOGGING_NAME = "Router";
 
   // Helper functions
@@ -110,6 +125,11 @@ public:
   RoutingTable GetRoutingTable() const;
   /// @}
 
+  /// @name Statistics
+  /// @{
+  RoutingStats GetRoutingStats() const;
+  /// @}
+
   bool HandleToDirectAddress(const Handle &handle, Address &address) const;
 
   /** If this host is connected close their port.
@@ -170,8 +190,42 @@ private:
   using EchoCache  = std::unordered_map<std::size_t, Timepoint>;
   using RawAddress = Packet::RawAddress;
   using BlackList  = fetch::muddle::Blacklist;
+  using ShardMutex = std::mutex;
+  using ShardLock  = std::unique_lock<ShardMutex>;
+  using Counter    = std::atomic<uint64_t>;
 
   static constexpr std::size_t NUMBER_OF_ROUTER_THREADS = 10;
+  static constexpr std::size_t NUMBER_OF_SHARDS         = 16;
+
+  /**
+   * The counters for the accesses to a sharded structure which could not acquire the shard lock
+   * immediately
+   */
+  struct LockStats
+  {
+    Counter waits{0};    ///< The number of contended lock acquisitions
+    Counter wait_ns{0};  ///< The total time spent waiting for the locks
+  };
+
+  struct RoutingTableShard
+  {
+    mutable ShardMutex lock;
+    RoutingTable       table;  ///< The part of the routing table (Protected by lock)
+  };
+
+  struct EchoCacheShard
+  {
+    ShardMutex lock;
+    EchoCache  cache;  ///< The part of the echo cache (Protected by lock)
+  };
+
+  using RoutingTableShards = std::array<RoutingTableShard, NUMBER_OF_SHARDS>;
+  using EchoCacheShards    = std::array<EchoCacheShard, NUMBER_OF_SHARDS>;
+
+  RoutingTableShard &      LookupShard(RawAddress const &address);
+  RoutingTableShard const &LookupShard(RawAddress const &address) const;
+
+  static ShardLock AcquireShardLock(ShardMutex &lock, LockStats &stats);
 
   bool AssociateHandleWithAddress(Handle handle, Packet::RawAddress const &address, bool direct);
 
@@ -201,14 +255,25 @@ private:
   Prover *              prover_          = nullptr;
   bool                  sign_broadcasts_ = false;
 
-  mutable Mutex routing_table_lock_{__LINE__, __FILE__};
-  RoutingTable  routing_table_;  ///< The map routing table from address to handle (Protected by
-                                 ///< routing_table_lock_)
+  /// Serialises all the modifications to the routing table. Lookups only require the lock of the
+  /// shard that contains the address.
+  mutable Mutex      routing_table_lock_{__LINE__, __FILE__};
+  RoutingTableShards routing_table_;  ///< The map routing table from address to handle (Sharded by
+                                      ///< address, modifications protected by routing_table_lock_)
   HandleMap
       routing_table_handles_;  ///< The map of handles to address (Protected by routing_table_lock_)
 
-  mutable Mutex echo_cache_lock_{__LINE__, __FILE__};
-  EchoCache     echo_cache_;
+  EchoCacheShards echo_cache_;  ///< The echo cache (Sharded by echo id)
+
+  /// @name Statistics
+  /// @{
+  Counter             packets_routed_{0};
+  Counter             routing_time_ns_{0};
+  mutable LockStats   routing_table_lock_stats_;
+  LockStats           echo_cache_lock_stats_;
+  metrics::Histogram &routing_duration_;  ///< Routing latency (shared by all routers)
+  metrics::Counter &  packets_dropped_;   ///< Expired and echoed packets (shared by all routers)
+  /// @}
 
   ThreadPool dispatch_thread_pool_;
 
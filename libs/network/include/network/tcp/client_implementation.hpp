@@ -27,9 +27,12 @@
 #include "network/message.hpp"
 
 #include "core/mutex.hpp"
+#include "metrics/registry.hpp"
 #include "network/fetch_asio.hpp"
 #include "network/management/abstract_connection.hpp"
+#include "network/tcp/framing.hpp"
 
+#include <array>
 #include <atomic>
 #include <memory>
 #include <mutex>
@@ -53,6 +56,10 @@ public:
 
   TCPClientImplementation(network_manager_type const &network_manager) noexcept
     : networkManager_(network_manager)
+    , socket_reads_(metrics::Registry::Instance().LookupCounter(
+          "tcp_client_socket_reads_total", "The number of completed socket reads"))
+    , socket_writes_(metrics::Registry::Instance().LookupCounter(
+          "tcp_client_socket_writes_total", "The number of socket writes issued"))
   {}
 
   TCPClientImplementation(TCPClientImplementation const &rhs) = delete;
@@ -144,7 +151,7 @@ public:
             {
               this->SetAddress(endpoint.address().to_string());
               this->SetPort(uint16_t(port.AsInt()));
-              ReadHeader();
+              Read();
             }
             else
             {
@@ -182,9 +189,8 @@ public:
     return !socket_.expired() && connected_;
   }
 
-  void Send(message_type const &omsg) override
+  void Send(message_type const &msg) override
   {
-    message_type msg = omsg.Copy();
     LOG_STACK_TRACE_POINT;
     if (!connected_)
     {
@@ -192,6 +198,7 @@ public:
       return;
     }
 
+    // the buffer is shared rather than copied, messages are never modified once they are sent
     {
       std::lock_guard<mutex_type> lock(queue_mutex_);
       write_queue_.push_back(msg);
@@ -247,7 +254,7 @@ public:
   }
 
 private:
-  static const uint64_t networkMagic_ = 0xFE7C80A1FE7C80A1;
+  using write_buffers_type = std::vector<asio::const_buffer>;
 
   network_manager_type networkManager_;
   // IO objects should be guaranteed to have lifetime less than the
@@ -266,7 +273,20 @@ private:
   mutable mutex_type callback_mutex_;
   std::atomic<bool>  connected_{false};
 
-  void ReadHeader() noexcept
+  // Only accessed from within the strand
+  FrameReader           reader_;
+  FrameReader::Messages read_messages_;
+  FrameWriter           writer_;
+  write_buffers_type    write_buffers_;
+
+  metrics::Counter &socket_reads_;   ///< Completed reads (shared by all clients)
+  metrics::Counter &socket_writes_;  ///< Issued writes (shared by all clients)
+
+  /**
+   * Read the next chunk of data from the socket into the ring buffer. A single read may contain
+   * several messages which are dispatched before the next read is issued.
+   */
+  void Read() noexcept
   {
     LOG_STACK_TRACE_POINT;
     auto strand = strand_.lock();
@@ -276,123 +296,70 @@ private:
     }
     assert(strand->running_in_this_thread());
 
-    self_type             self   = shared_from_this();
-    auto                  socket = socket_.lock();
-    byte_array::ByteArray header;
-    header.Resize(2 * sizeof(uint64_t));
+    self_type self   = shared_from_this();
+    auto      socket = socket_.lock();
 
-    auto cb = [this, self, socket, header, strand](std::error_code ec, std::size_t) {
+    auto cb = [this, self, socket, strand](std::error_code ec, std::size_t len) {
       shared_self_type selfLock = self.lock();
       if (!selfLock)
       {
         return;
       }
 
-      if (!ec)
-      {
-        FETCH_LOG_DEBUG(LOGGING_NAME, "Read message header.");
-        ReadBody(header);
-      }
-      else
+      if (ec)
       {
         // We expect to get an ec here when the socked is closed via a post
-        FETCH_LOG_INFO(LOGGING_NAME, "Socket closed inside ReadHeader: ", ec.message());
+        FETCH_LOG_INFO(LOGGING_NAME, "Socket closed inside Read: ", ec.message());
         SignalLeave();
+        return;
       }
-    };
-
-    if (socket)
-    {
-      assert(strand->running_in_this_thread());
-      asio::async_read(*socket, asio::buffer(header.pointer(), header.size()), strand->wrap(cb));
-
-      bool const previously_connected = connected_.exchange(true);
-
-      if (!previously_connected)
-      {
-        SignalConnectionSuccess();
-      }
-    }
-    else
-    {
-      FETCH_LOG_INFO(LOGGING_NAME, "Socket no longer valid in ReadHeader");
-      connected_ = false;
-      SignalLeave();
-    }
-  }
-
-  void ReadBody(byte_array::ByteArray const &header) noexcept
-  {
-    LOG_STACK_TRACE_POINT;
-    auto strand = strand_.lock();
-    assert(strand->running_in_this_thread());
-
-    assert(header.size() >= sizeof(networkMagic_));
-    uint64_t magic = *reinterpret_cast<const uint64_t *>(header.pointer());
-    uint64_t size  = *reinterpret_cast<const uint64_t *>(header.pointer() + sizeof(uint64_t));
-
-    if (magic != networkMagic_)
-    {
-      byte_array::ByteArray dummy;
-      SetHeader(dummy, 0);
-      dummy.Resize(16);
 
-      FETCH_LOG_ERROR(LOGGING_NAME,
-                      "Magic incorrect during network read:\ngot:      ", ToHex(header),
-                      "\nExpected: ", ToHex(byte_array::ByteArray(dummy)));
-      return;
-    }
-
-    byte_array::ByteArray message;
-    message.Resize(size);
+      socket_reads_.Increment();
+      reader_.Commit(len);
 
-    self_type self   = shared_from_this();
-    auto      socket = socket_.lock();
-    auto      cb     = [this, self, message, socket, strand](std::error_code ec, std::size_t len) {
-      FETCH_UNUSED(len);
-
-      shared_self_type selfLock = self.lock();
-      if (!selfLock)
+      read_messages_.clear();
+      if (!reader_.Extract(read_messages_))
       {
+        FETCH_LOG_ERROR(LOGGING_NAME, "Magic incorrect during network read");
         return;
       }
 
-      if (!ec)
+      FETCH_LOG_DEBUG(LOGGING_NAME, "Read ", read_messages_.size(), " messages.");
+      for (auto const &message : read_messages_)
       {
         SignalMessage(message);
-        ReadHeader();
-      }
-      else
-      {
-        FETCH_LOG_ERROR(LOGGING_NAME, "Reading body failed, dying: ", ec, ec.message());
-        SignalLeave();
       }
+      read_messages_.clear();
+
+      Read();
     };
 
     if (socket)
     {
+      FrameReader::Regions regions;
+      std::size_t const    num_regions = reader_.GetReadRegions(regions);
+      assert(num_regions > 0);
+
+      std::array<asio::mutable_buffer, 2> buffers{
+          {asio::buffer(regions[0].data, regions[0].size),
+           (num_regions > 1) ? asio::buffer(regions[1].data, regions[1].size)
+                             : asio::mutable_buffer{}}};
+
       assert(strand->running_in_this_thread());
-      asio::async_read(*socket, asio::buffer(message.pointer(), message.size()), strand->wrap(cb));
-    }
-    else
-    {
-      FETCH_LOG_ERROR(LOGGING_NAME, "Invalid socket when attempting to read body");
-      SignalLeave();
-    }
-  }
+      socket->async_read_some(buffers, strand->wrap(cb));
 
-  static void SetHeader(byte_array::ByteArray &header, uint64_t bufSize)
-  {
-    header.Resize(16);
+      bool const previously_connected = connected_.exchange(true);
 
-    for (std::size_t i = 0; i < 8; ++i)
-    {
-      header[i] = uint8_t((networkMagic_ >> i * 8) & 0xff);
+      if (!previously_connected)
+      {
+        SignalConnectionSuccess();
+      }
     }
-
-    for (std::size_t i = 0; i < 8; ++i)
+    else
     {
-      header[i + 8] = uint8_t((bufSize >> i * 8) & 0xff);
+      FETCH_LOG_INFO(LOGGING_NAME, "Socket no longer valid in Read");
+      connected_ = false;
+      SignalLeave();
     }
   }
 
@@ -413,7 +380,7 @@ private:
       }
     }
 
-    message_type buffer;
+    // coalesce the queued messages into a single scatter-gather write
     {
       std::lock_guard<mutex_type> lock(queue_mutex_);
       if (write_queue_.empty())
@@ -422,21 +389,20 @@ private:
         can_write_ = true;
         return;
       }
-      buffer = write_queue_.front();
-      write_queue_.pop_front();
+      writer_.Fill(write_queue_);
     }
 
-    byte_array::ByteArray header;
-    SetHeader(header, buffer.size());
-
-    std::vector<asio::const_buffer> buffers{asio::buffer(header.pointer(), header.size()),
-                                            asio::buffer(buffer.pointer(), buffer.size())};
+    writer_.GetBuffers(write_buffers_, [](uint8_t const *data, std::size_t size) {
+      return asio::const_buffer(data, size);
+    });
 
     auto socket = socket_.lock();
 
-    auto cb = [this, selfLock, socket, buffer, header](std::error_code ec, std::size_t len) {
+    auto cb = [this, selfLock, socket](std::error_code ec, std::size_t len) {
       FETCH_UNUSED(len);
 
+      writer_.Clear();
+
       {
         std::lock_guard<mutex_type> lock(can_write_mutex_);
         can_write_ = true;
@@ -463,11 +429,13 @@ private:
     if (socket && strand)
     {
       assert(strand->running_in_this_thread());
-      asio::async_write(*socket, buffers, strand->wrap(cb));
+      socket_writes_.Increment();
+      asio::async_write(*socket, write_buffers_, strand->wrap(cb));
     }
     else
     {
       FETCH_LOG_ERROR(LOGGING_NAME, "Failed to lock socket in WriteNext!");
+      writer_.Clear();
       SignalLeave();
     }
   }
@@ -0,0 +1,146 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "network/message.hpp"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace fetch {
+namespace network {
+
+/**
+ * The TCP messages are framed with a 16 byte header containing the network magic followed by the
+ * size of the payload (both little endian 64 bit values)
+ */
+struct Framing
+{
+  static constexpr uint64_t    MAGIC       = 0xFE7C80A1FE7C80A1;
+  static constexpr std::size_t HEADER_SIZE = 2 * sizeof(uint64_t);
+
+  static void     EncodeHeader(uint8_t *header, uint64_t size);
+  static uint64_t DecodeWord(uint8_t const *data);
+};
+
+/**
+ * Reads framed messages from a stream into a ring buffer so that a single read from the socket
+ * can deliver several messages at a time.
+ *
+ * The caller requests the regions into which data should be read (GetReadRegions), reports the
+ * amount of data which was read (Commit) and then extracts any completed messages (Extract).
+ * Messages which are too large to ever fit in the ring are read directly into their own buffer.
+ */
+class FrameReader
+{
+public:
+  static constexpr std::size_t DEFAULT_CAPACITY = 64 * 1024;  ///< Must be a power of 2
+
+  struct Region
+  {
+    uint8_t *   data;
+    std::size_t size;
+  };
+
+  using Regions  = std::array<Region, 2>;
+  using Messages = std::vector<message_type>;
+
+  explicit FrameReader(std::size_t capacity = DEFAULT_CAPACITY);
+  FrameReader(FrameReader const &) = delete;
+  FrameReader(FrameReader &&)      = delete;
+  ~FrameReader()                   = default;
+
+  std::size_t GetReadRegions(Regions &regions);
+  void        Commit(std::size_t length);
+  bool        Extract(Messages &messages);
+
+  std::size_t capacity() const
+  {
+    return capacity_;
+  }
+
+  /// The number of bytes currently buffered in the ring
+  std::size_t buffered() const
+  {
+    return static_cast<std::size_t>(write_index_ - read_index_);
+  }
+
+  // Operators
+  FrameReader &operator=(FrameReader const &) = delete;
+  FrameReader &operator=(FrameReader &&) = delete;
+
+private:
+  void Peek(uint8_t *output, std::size_t length) const;
+  void Read(uint8_t *output, std::size_t length);
+
+  std::size_t const    capacity_;
+  std::size_t const    mask_;
+  std::vector<uint8_t> ring_;
+  uint64_t             read_index_{0};
+  uint64_t             write_index_{0};
+
+  byte_array::ByteArray large_message_;         ///< Message being read outside of the ring
+  std::size_t           large_message_offset_{0};
+  bool                  large_message_pending_{false};
+};
+
+/**
+ * Coalesces the messages of a write queue so that they can be written to the socket with a single
+ * scatter-gather write. The headers of all the messages in the batch share a single allocation.
+ */
+class FrameWriter
+{
+public:
+  static constexpr std::size_t MAX_BATCH_BYTES    = 256 * 1024;
+  static constexpr std::size_t MAX_BATCH_MESSAGES = 32;  ///< Two buffers per message
+
+  std::size_t Fill(message_queue_type &queue);
+  void        Clear();
+
+  template <typename Buffer, typename Factory>
+  void GetBuffers(std::vector<Buffer> &buffers, Factory &&make_buffer) const
+  {
+    buffers.clear();
+    for (std::size_t i = 0; i < messages_.size(); ++i)
+    {
+      buffers.push_back(make_buffer(headers_.pointer() + (i * Framing::HEADER_SIZE),
+                                    Framing::HEADER_SIZE));
+      buffers.push_back(make_buffer(messages_[i].pointer(), messages_[i].size()));
+    }
+  }
+
+  bool empty() const
+  {
+    return messages_.empty();
+  }
+
+  std::size_t size() const
+  {
+    return messages_.size();
+  }
+
+private:
+  std::vector<message_type> messages_;
+  byte_array::ByteArray     headers_;
+};
+
+}  // namespace network
+}  // namespace fetch
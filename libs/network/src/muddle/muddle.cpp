@@ -337,10 +337,12 @@ void Muddle::CreateTcpClient(Uri const &peer)
     try
     {
       // un-marshall the data
-      serializers::ByteArrayBuffer buffer(msg);
-
       auto packet = std::make_shared<Packet>();
-      buffer >> *packet;
+      if (!packet->FromBuffer(msg))
+      {
+        FETCH_LOG_WARN(LOGGING_NAME, "Unable to decode packet from ", peer.ToString());
+        return;
+      }
 
       // dispatch the message to router
       router_.Route(conn_handle, packet);
@@ -27,6 +27,8 @@
 #include "network/muddle/muddle_register.hpp"
 #include "network/muddle/packet.hpp"
 
+#include <atomic>
+#include <chrono>
 #include <cstring>
 #include <memory>
 #include <random>
@@ -165,6 +167,45 @@ std::string DescribePacket(Packet const &packet)
   return oss.str();
 }
 
+/**
+ * Scoped timer which accumulates the time taken to route a packet
+ */
+class RoutingTimer
+{
+public:
+  using Clock     = std::chrono::steady_clock;
+  using Timepoint = Clock::time_point;
+  using Counter   = std::atomic<uint64_t>;
+
+  RoutingTimer(Counter &packets, Counter &total_ns, metrics::Histogram &histogram)
+    : packets_{packets}
+    , total_ns_{total_ns}
+    , histogram_{histogram}
+  {}
+
+  RoutingTimer(RoutingTimer const &) = delete;
+  RoutingTimer(RoutingTimer &&)      = delete;
+
+  ~RoutingTimer()
+  {
+    auto const elapsed =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start_).count();
+
+    ++packets_;
+    total_ns_ += static_cast<uint64_t>(elapsed);
+    histogram_.Record(static_cast<uint64_t>(elapsed));
+  }
+
+  RoutingTimer &operator=(RoutingTimer const &) = delete;
+  RoutingTimer &operator=(RoutingTimer &&) = delete;
+
+private:
+  Counter &           packets_;
+  Counter &           total_ns_;
+  metrics::Histogram &histogram_;
+  Timepoint const     start_{Clock::now()};
+};
+
 }  // namespace
 
 /**
@@ -213,6 +254,10 @@ Router::Router(NetworkId network_id, Address address, MuddleRegister const &reg,
   , network_id_(std::move(network_id))
   , prover_(prover)
   , sign_broadcasts_(prover && sign_broadcasts)
+  , routing_duration_(metrics::Registry::Instance().LookupHistogram(
+        "muddle_router_packet_routing_seconds", "The time taken to route a single packet"))
+  , packets_dropped_(metrics::Registry::Instance().LookupCounter(
+        "muddle_router_packets_dropped_total", "The number of expired or echoed packets dropped"))
   , dispatch_thread_pool_(network::MakeThreadPool(NUMBER_OF_ROUTER_THREADS, "Router"))
 {}
 
@@ -419,8 +464,33 @@ void Router::Broadcast(uint16_t service, uint16_t channel, Payload const &payloa
  */
 Router::RoutingTable Router::GetRoutingTable() const
 {
-  FETCH_LOCK(routing_table_lock_);
-  return routing_table_;
+  RoutingTable table{};
+
+  for (auto &shard : routing_table_)
+  {
+    auto const guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
+    table.insert(shard.table.begin(), shard.table.end());
+  }
+
+  return table;
+}
+
+/**
+ * Get a snapshot of the routing statistics
+ *
+ * @return The routing statistics
+ */
+Router::RoutingStats Router::GetRoutingStats() const
+{
+  RoutingStats stats{};
+  stats.packets_routed             = packets_routed_.load();
+  stats.routing_time_ns            = routing_time_ns_.load();
+  stats.routing_table_lock_waits   = routing_table_lock_stats_.waits.load();
+  stats.routing_table_lock_wait_ns = routing_table_lock_stats_.wait_ns.load();
+  stats.echo_cache_lock_waits      = echo_cache_lock_stats_.waits.load();
+  stats.echo_cache_lock_wait_ns    = echo_cache_lock_stats_.wait_ns.load();
+
+  return stats;
 }
 
 /**
@@ -459,13 +529,17 @@ void Router::Debug(std::string const &prefix) const
                  "direct_address_map_: --------------------------------------");
 
   FETCH_LOG_WARN(LOGGING_NAME, prefix, "routing_table_: --------------------------------------");
-  for (const auto &routing : routing_table_)
+  for (auto &shard : routing_table_)
   {
-    ByteArray output(routing.first.size());
-    std::copy(routing.first.begin(), routing.first.end(), output.pointer());
-    FETCH_LOG_WARN(LOGGING_NAME, prefix, static_cast<std::string>(ToBase64(output)),
-                   " -> handle=", std::to_string(routing.second.handle),
-                   " direct=", routing.second.direct);
+    auto const guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
+    for (const auto &routing : shard.table)
+    {
+      ByteArray output(routing.first.size());
+      std::copy(routing.first.begin(), routing.first.end(), output.pointer());
+      FETCH_LOG_WARN(LOGGING_NAME, prefix, static_cast<std::string>(ToBase64(output)),
+                     " -> handle=", std::to_string(routing.second.handle),
+                     " direct=", routing.second.direct);
+    }
   }
   FETCH_LOG_WARN(LOGGING_NAME, prefix, "routing_table_: --------------------------------------");
   registrar_.Debug(prefix);
@@ -544,17 +618,20 @@ MuddleEndpoint::AddressList Router::GetDirectlyConnectedPeers() const
 {
   AddressList addresses{};
 
-  FETCH_LOCK(routing_table_lock_);
-  for (auto const &entry : routing_table_)
+  for (auto &shard : routing_table_)
   {
-    if (entry.second.direct)
+    auto const guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
+    for (auto const &entry : shard.table)
     {
-      // lookup the connection
-      auto connection = register_.LookupConnection(entry.second.handle).lock();
-
-      if (connection && connection->is_alive())
+      if (entry.second.direct)
       {
-        addresses.emplace_back(ConvertAddress(entry.first));
+        // lookup the connection
+        auto connection = register_.LookupConnection(entry.second.handle).lock();
+
+        if (connection && connection->is_alive())
+        {
+          addresses.emplace_back(ConvertAddress(entry.first));
+        }
       }
     }
   }
@@ -571,15 +648,12 @@ MuddleEndpoint::AddressList Router::GetDirectlyConnectedPeers() const
 bool Router::IsConnected(Address const &target) const
 {
   LOG_STACK_TRACE_POINT;
-  FETCH_LOCK(routing_table_lock_);
+  bool connected = false;
 
-  auto raw_address = ConvertAddress(target);
-  auto iter        = routing_table_.find(raw_address);
-  bool connected   = false;
-
-  if (iter != routing_table_.end())
+  Handle const handle = LookupHandle(ConvertAddress(target));
+  if (handle)
   {
-    auto conn = register_.LookupConnection(iter->second.handle).lock();
+    auto conn = register_.LookupConnection(handle).lock();
     if (conn)
     {
       connected = conn->is_alive();
@@ -617,8 +691,11 @@ bool Router::AssociateHandleWithAddress(Handle handle, Packet::RawAddress const
   {
     FETCH_LOCK(routing_table_lock_);
 
+    auto &shard = LookupShard(address);
+    auto  guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
+
     // lookup (or create) the routing table entry
-    auto &routing_data = routing_table_[address];
+    auto &routing_data = shard.table[address];
 
     bool const is_empty = (routing_data.handle == 0);
 
@@ -694,10 +771,11 @@ Router::Handle Router::LookupHandle(Packet::RawAddress const &address) const
   Handle handle = 0;
 
   {
-    FETCH_LOCK(routing_table_lock_);
+    auto const &shard = LookupShard(address);
+    auto const  guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
 
-    auto address_it = routing_table_.find(address);
-    if (address_it != routing_table_.end())
+    auto address_it = shard.table.find(address);
+    if (address_it != shard.table.end())
     {
       auto const &routing_data = address_it->second;
 
@@ -717,20 +795,28 @@ Router::Handle Router::LookupRandomHandle(Packet::RawAddress const & /*address*/
 {
   static std::random_device rd;
   static std::mt19937       rng(rd());
+  static Mutex              rng_lock{__LINE__, __FILE__};
+
+  std::size_t first_shard{0};
+  std::size_t element_seed{0};
 
   {
-    FETCH_LOCK(routing_table_lock_);
+    FETCH_LOCK(rng_lock);
+    first_shard  = rng() % NUMBER_OF_SHARDS;
+    element_seed = rng();
+  }
 
-    if (!routing_table_.empty())
-    {
-      // decide the random index to access
-      std::uniform_int_distribution<decltype(routing_table_)::size_type> distro(
-          0, routing_table_.size());
-      std::size_t const element = distro(rng);
+  // starting from a random shard, select a random element from the first non-empty shard
+  for (std::size_t i = 0; i < NUMBER_OF_SHARDS; ++i)
+  {
+    auto const &shard = routing_table_[(first_shard + i) % NUMBER_OF_SHARDS];
+    auto const  guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
 
+    if (!shard.table.empty())
+    {
       // advance the iterator to the correct offset
-      auto it = routing_table_.cbegin();
-      std::advance(it, static_cast<std::ptrdiff_t>(element));
+      auto it = shard.table.cbegin();
+      std::advance(it, static_cast<std::ptrdiff_t>(element_seed % shard.table.size()));
 
       return it->second.handle;
     }
@@ -752,7 +838,14 @@ void Router::KillConnection(Handle handle, Address const &peer)
   {
     FETCH_LOCK(routing_table_lock_);
     conn->Close();
-    routing_table_.erase(ConvertAddress(peer));
+
+    auto const raw_address = ConvertAddress(peer);
+    {
+      auto &shard = LookupShard(raw_address);
+      auto  guard = AcquireShardLock(shard.lock, routing_table_lock_stats_);
+      shard.table.erase(raw_address);
+    }
+
     direct_address_map_.erase(handle);
   }
   else
@@ -813,14 +906,11 @@ void Router::SendToConnection(Handle handle, PacketPtr packet)
                                 packet->GetMessageNum());
     }
 
-    // serialize the packet to the buffer
-    serializers::ByteArrayBuffer buffer;
-    buffer << *packet;
-
     FETCH_LOG_DEBUG(LOGGING_NAME, "Sending out", DescribePacket(*packet));
 
-    // dispatch to the connection object
-    conn->Send(buffer.data());
+    // dispatch the wire format of the packet to the connection object, relayed packets retain
+    // the buffer they were received in so no serialization is required
+    conn->Send(packet->ToBuffer());
   }
   else
   {
@@ -837,6 +927,8 @@ void Router::SendToConnection(Handle handle, PacketPtr packet)
 void Router::RoutePacket(PacketPtr packet, bool external)
 {
   LOG_STACK_TRACE_POINT;
+  RoutingTimer const timer{packets_routed_, routing_time_ns_, routing_duration_};
+
   /// Step 1. Determine if we should drop this packet (for whatever reason)
   if (external)
   {
@@ -845,6 +937,7 @@ void Router::RoutePacket(PacketPtr packet, bool external)
     if (packet->GetTTL() <= 2u)
     {
       FETCH_LOG_INFO(LOGGING_NAME, "Message has timed out (TTL): ", DescribePacket(*packet));
+      packets_dropped_.Increment();
       return;
     }
     // decrement the TTL
@@ -853,6 +946,7 @@ void Router::RoutePacket(PacketPtr packet, bool external)
     // if this packet is a broadcast echo we should no longer route this packet
     if (packet->IsBroadcast() && IsEcho(*packet))
     {
+      packets_dropped_.Increment();
       return;
     }
   }
@@ -868,12 +962,8 @@ void Router::RoutePacket(PacketPtr packet, bool external)
       DispatchPacket(packet, address_);
     }
 
-    // serialize the packet to the buffer
-    serializers::ByteArrayBuffer buffer;
-    buffer << *packet;
-
-    // broadcast the data across the network
-    register_.Broadcast(buffer.data());
+    // broadcast the same wire buffer across all of the connections
+    register_.Broadcast(packet->ToBuffer());
   }
   else
   {
@@ -981,16 +1071,17 @@ bool Router::IsEcho(Packet const &packet, bool register_echo)
   std::size_t const index = GenerateEchoId(packet);
 
   {
-    FETCH_LOCK(echo_cache_lock_);
+    auto &shard = echo_cache_[index % NUMBER_OF_SHARDS];
+    auto  guard = AcquireShardLock(shard.lock, echo_cache_lock_stats_);
 
     // lookup if the echo is in the cache
-    auto it = echo_cache_.find(index);
-    if (it == echo_cache_.end())
+    auto it = shard.cache.find(index);
+    if (it == shard.cache.end())
     {
       // register the echo (in needed)
       if (register_echo)
       {
-        echo_cache_[index] = Clock::now();
+        shard.cache[index] = Clock::now();
       }
 
       is_echo = false;
@@ -1006,29 +1097,82 @@ bool Router::IsEcho(Packet const &packet, bool register_echo)
 void Router::CleanEchoCache()
 {
   LOG_STACK_TRACE_POINT;
-  FETCH_LOCK(echo_cache_lock_);
-
   auto const now = Clock::now();
 
-  auto it = echo_cache_.begin();
-  while (it != echo_cache_.end())
+  // each of the shards is trimmed in turn so that routing is never blocked on the whole cache
+  for (auto &shard : echo_cache_)
   {
-    // calculate the time delta
-    auto const delta = now - it->second;
+    auto guard = AcquireShardLock(shard.lock, echo_cache_lock_stats_);
 
-    if (delta > std::chrono::seconds{30})
-    {
-      // remove the element
-      it = echo_cache_.erase(it);
-    }
-    else
+    auto it = shard.cache.begin();
+    while (it != shard.cache.end())
     {
-      // move on to the next element in the cache
-      ++it;
+      // calculate the time delta
+      auto const delta = now - it->second;
+
+      if (delta > std::chrono::seconds{30})
+      {
+        // remove the element
+        it = shard.cache.erase(it);
+      }
+      else
+      {
+        // move on to the next element in the cache
+        ++it;
+      }
     }
   }
 }
 
+/**
+ * Internal: Lookup the routing table shard which contains the specified address
+ *
+ * @param address The address to lookup
+ * @return The reference to the shard
+ */
+Router::RoutingTableShard &Router::LookupShard(RawAddress const &address)
+{
+  return routing_table_[std::hash<RawAddress>{}(address) % NUMBER_OF_SHARDS];
+}
+
+/**
+ * Internal: Lookup the routing table shard which contains the specified address
+ *
+ * @param address The address to lookup
+ * @return The reference to the shard
+ */
+Router::RoutingTableShard const &Router::LookupShard(RawAddress const &address) const
+{
+  return routing_table_[std::hash<RawAddress>{}(address) % NUMBER_OF_SHARDS];
+}
+
+/**
+ * Internal: Acquire the lock for a shard. The uncontended case costs a single try lock, only when
+ * the lock is contended is the wait timed and recorded.
+ *
+ * @param lock The shard lock to be acquired
+ * @param stats The lock statistics to be updated
+ * @return The owning lock for the shard
+ */
+Router::ShardLock Router::AcquireShardLock(ShardMutex &lock, LockStats &stats)
+{
+  ShardLock guard{lock, std::try_to_lock};
+
+  if (!guard.owns_lock())
+  {
+    auto const start = Clock::now();
+    guard.lock();
+
+    auto const waited =
+        std::chrono::duration_cast<std::chrono::nanoseconds>(Clock::now() - start).count();
+
+    ++stats.waits;
+    stats.wait_ns += static_cast<uint64_t>(waited);
+  }
+
+  return guard;
+}
+
 void Router::Blacklist(Address const &target)
 {
   blacklist_.Add(target);
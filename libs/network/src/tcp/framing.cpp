@@ -0,0 +1,261 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "network/tcp/framing.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace fetch {
+namespace network {
+
+constexpr uint64_t    Framing::MAGIC;
+constexpr std::size_t Framing::HEADER_SIZE;
+constexpr std::size_t FrameReader::DEFAULT_CAPACITY;
+constexpr std::size_t FrameWriter::MAX_BATCH_BYTES;
+constexpr std::size_t FrameWriter::MAX_BATCH_MESSAGES;
+
+/**
+ * Encode a message header
+ *
+ * @param header The output buffer (of at least HEADER_SIZE bytes)
+ * @param size The size of the message payload
+ */
+void Framing::EncodeHeader(uint8_t *header, uint64_t size)
+{
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    header[i]     = uint8_t((MAGIC >> i * 8) & 0xff);
+    header[i + 8] = uint8_t((size >> i * 8) & 0xff);
+  }
+}
+
+/**
+ * Decode one of the (little endian) header words
+ *
+ * @param data The pointer to the start of the word
+ * @return The decoded value
+ */
+uint64_t Framing::DecodeWord(uint8_t const *data)
+{
+  uint64_t value{0};
+  for (std::size_t i = 0; i < 8; ++i)
+  {
+    value |= static_cast<uint64_t>(data[i]) << (i * 8);
+  }
+
+  return value;
+}
+
+FrameReader::FrameReader(std::size_t capacity)
+  : capacity_{capacity}
+  , mask_{capacity - 1}
+  , ring_(capacity)
+{
+  assert((capacity_ >= Framing::HEADER_SIZE) && ((capacity_ & mask_) == 0));
+}
+
+/**
+ * Determine the regions into which the next read from the socket should be made
+ *
+ * @param regions The output regions
+ * @return The number of valid regions
+ */
+std::size_t FrameReader::GetReadRegions(Regions &regions)
+{
+  // large messages are read directly into the message buffer
+  if (large_message_pending_)
+  {
+    regions[0] = Region{large_message_.pointer() + large_message_offset_,
+                        large_message_.size() - large_message_offset_};
+    return 1;
+  }
+
+  std::size_t const free_space = capacity_ - buffered();
+  if (free_space == 0)
+  {
+    return 0;
+  }
+
+  // the free space may wrap around the end of the ring
+  std::size_t const start = static_cast<std::size_t>(write_index_) & mask_;
+  std::size_t const first = std::min(free_space, capacity_ - start);
+
+  regions[0] = Region{ring_.data() + start, first};
+
+  if (first == free_space)
+  {
+    return 1;
+  }
+
+  regions[1] = Region{ring_.data(), free_space - first};
+  return 2;
+}
+
+/**
+ * Signal that data has been read into the regions previously requested
+ *
+ * @param length The number of bytes read
+ */
+void FrameReader::Commit(std::size_t length)
+{
+  if (large_message_pending_)
+  {
+    assert(large_message_offset_ + length <= large_message_.size());
+    large_message_offset_ += length;
+  }
+  else
+  {
+    assert(buffered() + length <= capacity_);
+    write_index_ += length;
+  }
+}
+
+/**
+ * Extract all the complete messages which have been read
+ *
+ * @param messages The list to which completed messages are appended
+ * @return true if successful, false if the stream is corrupt (invalid magic)
+ */
+bool FrameReader::Extract(Messages &messages)
+{
+  for (;;)
+  {
+    if (large_message_pending_)
+    {
+      if (large_message_offset_ < large_message_.size())
+      {
+        break;
+      }
+
+      messages.emplace_back(std::move(large_message_));
+      large_message_         = byte_array::ByteArray{};
+      large_message_offset_  = 0;
+      large_message_pending_ = false;
+      continue;
+    }
+
+    if (buffered() < Framing::HEADER_SIZE)
+    {
+      break;
+    }
+
+    uint8_t header[Framing::HEADER_SIZE];
+    Peek(header, Framing::HEADER_SIZE);
+
+    if (Framing::DecodeWord(header) != Framing::MAGIC)
+    {
+      return false;
+    }
+
+    auto const size = static_cast<std::size_t>(Framing::DecodeWord(header + sizeof(uint64_t)));
+
+    if (buffered() >= (Framing::HEADER_SIZE + size))
+    {
+      // the complete message is available in the ring
+      read_index_ += Framing::HEADER_SIZE;
+
+      byte_array::ByteArray message;
+      message.Resize(size);
+      Read(message.pointer(), size);
+
+      messages.emplace_back(std::move(message));
+    }
+    else if ((Framing::HEADER_SIZE + size) > capacity_)
+    {
+      // the message will never fit in the ring, transfer the part which has been read so far and
+      // read the remainder directly into the message
+      read_index_ += Framing::HEADER_SIZE;
+
+      large_message_.Resize(size);
+      large_message_offset_  = buffered();
+      large_message_pending_ = true;
+      Read(large_message_.pointer(), large_message_offset_);
+    }
+    else
+    {
+      break;
+    }
+  }
+
+  return true;
+}
+
+void FrameReader::Peek(uint8_t *output, std::size_t length) const
+{
+  assert(length <= buffered());
+
+  std::size_t const start = static_cast<std::size_t>(read_index_) & mask_;
+  std::size_t const first = std::min(length, capacity_ - start);
+
+  std::memcpy(output, ring_.data() + start, first);
+  std::memcpy(output + first, ring_.data(), length - first);
+}
+
+void FrameReader::Read(uint8_t *output, std::size_t length)
+{
+  Peek(output, length);
+  read_index_ += length;
+}
+
+/**
+ * Move as many messages from the queue into the batch as the budget permits. At least one message
+ * is always taken (if available) regardless of its size.
+ *
+ * @param queue The write queue
+ * @return The number of messages in the batch
+ */
+std::size_t FrameWriter::Fill(message_queue_type &queue)
+{
+  assert(messages_.empty());
+
+  std::size_t total_bytes{0};
+  while (!queue.empty() && (messages_.size() < MAX_BATCH_MESSAGES))
+  {
+    std::size_t const message_bytes = Framing::HEADER_SIZE + queue.front().size();
+    if (!messages_.empty() && ((total_bytes + message_bytes) > MAX_BATCH_BYTES))
+    {
+      break;
+    }
+
+    total_bytes += message_bytes;
+    messages_.emplace_back(std::move(queue.front()));
+    queue.pop_front();
+  }
+
+  // encode all of the headers into a single buffer
+  headers_.Resize(messages_.size() * Framing::HEADER_SIZE);
+  for (std::size_t i = 0; i < messages_.size(); ++i)
+  {
+    Framing::EncodeHeader(headers_.pointer() + (i * Framing::HEADER_SIZE), messages_[i].size());
+  }
+
+  return messages_.size();
+}
+
+/**
+ * Release the messages of the batch once it has been written
+ */
+void FrameWriter::Clear()
+{
+  messages_.clear();
+}
+
+}  // namespace network
+}  // namespace fetch
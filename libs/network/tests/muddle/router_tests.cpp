@@ -205,6 +205,15 @@ TEST_F(RouterTests, CheckExchange)
   // allow enough time for the messages to be sent
   ASSERT_TRUE(messagesA.Wait(1, milliseconds{1500}));
 
+  // the received broadcasts should have been accounted for by the router of node B
+  auto &routerB = dynamic_cast<fetch::muddle::Router &>(endpointB);
+  auto  statsB  = routerB.GetRoutingStats();
+  EXPECT_GE(statsB.packets_routed, 3u);
+  EXPECT_GT(statsB.routing_time_ns, 0u);
+  EXPECT_EQ(routerB.GetRoutingTable().count(
+                fetch::muddle::Router::ConvertAddress(nodeA->identity().identifier())),
+            1u);
+
   nodeB->Stop();
   nodeA->Stop();
 }
@@ -16,6 +16,7 @@
 //
 //------------------------------------------------------------------------------
 
+#include "core/serializers/byte_array_buffer.hpp"
 #include "crypto/ecdsa.hpp"
 #include "network/muddle/packet.hpp"
 
@@ -144,3 +145,74 @@ TEST_F(PacketTests, CheckIndifference)
   EXPECT_TRUE(packet_->IsStamped());
   EXPECT_TRUE(packet_->Verify());
 }
+
+TEST_F(PacketTests, CheckWireFormat)
+{
+  packet_->SetTTL(40);
+  packet_->Sign(*prover_);
+
+  // the wire format must be the same as the serialized packet
+  fetch::serializers::ByteArrayBuffer expected;
+  expected << *packet_;
+
+  auto const buffer = packet_->ToBuffer();
+  EXPECT_EQ(buffer, expected.data());
+
+  // subsequent calls return the same buffer
+  EXPECT_EQ(buffer.pointer(), packet_->ToBuffer().pointer());
+
+  Packet received;
+  ASSERT_TRUE(received.FromBuffer(buffer));
+  EXPECT_EQ(received.GetSender(), packet_->GetSender());
+  EXPECT_EQ(received.GetService(), 1);
+  EXPECT_EQ(received.GetProtocol(), 2);
+  EXPECT_EQ(received.GetMessageNum(), 3);
+  EXPECT_EQ(received.GetTTL(), 40);
+  EXPECT_EQ(received.GetPayload(), response_);
+  EXPECT_TRUE(received.Verify());
+
+  // the payload references the received buffer rather than a copy of it
+  EXPECT_GE(received.GetPayload().pointer(), buffer.pointer());
+  EXPECT_LT(received.GetPayload().pointer(), buffer.pointer() + buffer.size());
+
+  // truncated buffers are rejected
+  Packet truncated;
+  EXPECT_FALSE(truncated.FromBuffer(buffer.SubArray(0, buffer.size() - 1)));
+  EXPECT_FALSE(truncated.FromBuffer(buffer.SubArray(0, Packet::HEADER_SIZE - 1)));
+}
+
+TEST_F(PacketTests, CheckRelayPatchesTTLInPlace)
+{
+  packet_->SetTTL(40);
+  packet_->Sign(*prover_);
+
+  // simulate the packet being received from the network
+  auto const received_buffer = packet_->ToBuffer().Copy();
+
+  Packet relayed;
+  ASSERT_TRUE(relayed.FromBuffer(received_buffer));
+  relayed.SetTTL(39);
+
+  // the received buffer is sent on without being serialized again
+  auto const &buffer = relayed.ToBuffer();
+  EXPECT_EQ(buffer.pointer(), received_buffer.pointer());
+
+  Packet next_hop;
+  ASSERT_TRUE(next_hop.FromBuffer(buffer));
+  EXPECT_EQ(next_hop.GetTTL(), 39);
+  EXPECT_EQ(next_hop.GetPayload(), response_);
+  EXPECT_TRUE(next_hop.Verify());
+
+  // once the buffer has been handed out it must not be modified again
+  relayed.SetTTL(38);
+  EXPECT_NE(relayed.ToBuffer().pointer(), received_buffer.pointer());
+
+  Packet original;
+  ASSERT_TRUE(original.FromBuffer(received_buffer));
+  EXPECT_EQ(original.GetTTL(), 39);
+
+  Packet updated;
+  ASSERT_TRUE(updated.FromBuffer(relayed.ToBuffer()));
+  EXPECT_EQ(updated.GetTTL(), 38);
+  EXPECT_TRUE(updated.Verify());
+}
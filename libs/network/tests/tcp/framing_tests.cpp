@@ -0,0 +1,177 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "network/tcp/framing.hpp"
+
+#include "gtest/gtest.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::network::FrameReader;
+using fetch::network::FrameWriter;
+using fetch::network::Framing;
+using fetch::network::message_queue_type;
+using fetch::network::message_type;
+
+using Stream   = std::vector<uint8_t>;
+using Messages = FrameReader::Messages;
+
+message_type CreateMessage(std::size_t size, uint8_t seed)
+{
+  ByteArray message;
+  message.Resize(size);
+  for (std::size_t i = 0; i < size; ++i)
+  {
+    message[i] = static_cast<uint8_t>(seed + i);
+  }
+
+  return message;
+}
+
+/// Serialise the messages into a byte stream the way they would be written to the socket
+Stream Encode(Messages const &messages)
+{
+  message_queue_type queue(messages.begin(), messages.end());
+
+  Stream      stream;
+  FrameWriter writer;
+  while (!queue.empty())
+  {
+    writer.Fill(queue);
+
+    std::vector<std::pair<uint8_t const *, std::size_t>> buffers;
+    writer.GetBuffers(buffers, [](uint8_t const *data, std::size_t size) {
+      return std::make_pair(data, size);
+    });
+
+    for (auto const &buffer : buffers)
+    {
+      stream.insert(stream.end(), buffer.first, buffer.first + buffer.second);
+    }
+
+    writer.Clear();
+  }
+
+  return stream;
+}
+
+/// Feed the stream into the reader in chunks of (at most) the specified size
+bool Decode(FrameReader &reader, Stream const &stream, std::size_t chunk_size, Messages &output)
+{
+  std::size_t offset = 0;
+  while (offset < stream.size())
+  {
+    FrameReader::Regions regions;
+    std::size_t const    num_regions = reader.GetReadRegions(regions);
+
+    std::size_t read = 0;
+    for (std::size_t i = 0; i < num_regions; ++i)
+    {
+      std::size_t const length =
+          std::min({regions[i].size, chunk_size - read, stream.size() - offset});
+      std::memcpy(regions[i].data, stream.data() + offset, length);
+
+      offset += length;
+      read += length;
+    }
+
+    reader.Commit(read);
+
+    if (!reader.Extract(output))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+TEST(FramingTests, CheckMessagesSurviveTheRing)
+{
+  Messages const input{CreateMessage(10, 1), CreateMessage(0, 2), CreateMessage(40, 3),
+                       CreateMessage(17, 4), CreateMessage(48, 5)};
+
+  Stream const stream = Encode(input);
+
+  for (std::size_t chunk_size : {1u, 7u, 16u, 64u, 1024u})
+  {
+    FrameReader reader{64};
+    Messages    output;
+
+    ASSERT_TRUE(Decode(reader, stream, chunk_size, output));
+    EXPECT_EQ(output, input);
+    EXPECT_EQ(reader.buffered(), 0u);
+  }
+}
+
+TEST(FramingTests, CheckLargeMessagesBypassTheRing)
+{
+  Messages const input{CreateMessage(5, 1), CreateMessage(1000, 2), CreateMessage(3, 3)};
+
+  Stream const stream = Encode(input);
+
+  FrameReader reader{64};
+  Messages    output;
+
+  ASSERT_TRUE(Decode(reader, stream, 100, output));
+  EXPECT_EQ(output, input);
+}
+
+TEST(FramingTests, CheckInvalidMagicIsDetected)
+{
+  Stream stream = Encode({CreateMessage(8, 1)});
+  stream[0] ^= 0xFF;
+
+  FrameReader reader{64};
+  Messages    output;
+
+  EXPECT_FALSE(Decode(reader, stream, 64, output));
+  EXPECT_TRUE(output.empty());
+}
+
+TEST(FramingTests, CheckWriterBatchLimits)
+{
+  FrameWriter writer;
+
+  // the number of messages in a batch is bounded
+  message_queue_type queue(FrameWriter::MAX_BATCH_MESSAGES + 5, CreateMessage(4, 1));
+  EXPECT_EQ(writer.Fill(queue), FrameWriter::MAX_BATCH_MESSAGES);
+  EXPECT_EQ(queue.size(), 5u);
+  writer.Clear();
+
+  // the size of a batch is bounded, although a single message can exceed the budget
+  queue.clear();
+  queue.push_back(CreateMessage(FrameWriter::MAX_BATCH_BYTES, 1));
+  queue.push_back(CreateMessage(4, 2));
+  EXPECT_EQ(writer.Fill(queue), 1u);
+  EXPECT_EQ(queue.size(), 1u);
+  writer.Clear();
+
+  EXPECT_EQ(writer.Fill(queue), 1u);
+  EXPECT_TRUE(queue.empty());
+}
+
+}  // namespace
@@ -0,0 +1,121 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/byte_array/byte_array.hpp"
+#include "core/random/lfg.hpp"
+#include "storage/key_value_index.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace {
+
+using fetch::byte_array::ByteArray;
+using fetch::storage::CachedRandomAccessStack;
+using fetch::storage::KeyValueIndex;
+using fetch::storage::KeyValuePair;
+using fetch::storage::RandomAccessStack;
+
+using KeyValueIndexDirect = KeyValueIndex<KeyValuePair<>, RandomAccessStack<KeyValuePair<>>>;
+using KeyValueIndexCached = KeyValueIndex<KeyValuePair<>, CachedRandomAccessStack<KeyValuePair<>>>;
+
+struct Entry
+{
+  ByteArray key;
+  uint64_t  value;
+};
+using Entries = std::vector<Entry>;
+
+Entries GenerateEntries(std::size_t count)
+{
+  fetch::random::LaggedFibonacciGenerator<> lfg;
+
+  Entries entries(count);
+  for (auto &entry : entries)
+  {
+    entry.key.Resize(256 / 8);
+    for (std::size_t i = 0; i < entry.key.size(); ++i)
+    {
+      entry.key[i] = static_cast<uint8_t>(lfg() >> 9);
+    }
+    entry.value = lfg();
+  }
+
+  return entries;
+}
+
+template <typename Index>
+void KeyValueIndex_SetPerKey(benchmark::State &state)
+{
+  auto const entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    Index index;
+    index.New("kvi_bench.db");
+    state.ResumeTiming();
+
+    for (auto const &entry : entries)
+    {
+      index.Set(entry.key, entry.value, entry.key);
+    }
+
+    benchmark::DoNotOptimize(index.Hash());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename Index>
+void KeyValueIndex_SetBatch(benchmark::State &state)
+{
+  auto const entries = GenerateEntries(static_cast<std::size_t>(state.range(0)));
+
+  for (auto _ : state)
+  {
+    state.PauseTiming();
+    Index index;
+    index.New("kvi_bench.db");
+    state.ResumeTiming();
+
+    typename Index::BatchUpdates updates;
+    updates.reserve(entries.size());
+    for (auto const &entry : entries)
+    {
+      updates.push_back({entry.key, entry.value, entry.key});
+    }
+
+    index.SetBatch(updates);
+
+    benchmark::DoNotOptimize(index.Hash());
+  }
+
+  state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+}  // namespace
+
+BENCHMARK_TEMPLATE(KeyValueIndex_SetPerKey, KeyValueIndexDirect)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(KeyValueIndex_SetBatch, KeyValueIndexDirect)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(KeyValueIndex_SetPerKey, KeyValueIndexCached)->Range(1 << 10, 1 << 16);
+BENCHMARK_TEMPLATE(KeyValueIndex_SetBatch, KeyValueIndexCached)->Range(1 << 10, 1 << 16);
+
+BENCHMARK_MAIN();
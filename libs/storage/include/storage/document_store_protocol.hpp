@@ -19,6 +19,7 @@
 
 #include "core/byte_array/encoders.hpp"
 #include "core/mutex.hpp"
+#include "core/serializers/stl_types.hpp"
 #include "core/threading/synchronised_state.hpp"
 #include "network/service/protocol.hpp"
 #include "storage/document_store.hpp"
@@ -26,6 +27,8 @@
 #include "storage/revertible_document_store.hpp"
 
 #include <map>
+#include <utility>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -38,6 +41,10 @@ public:
   using CallContext            = service::CallContext;
 
   using Identifier = byte_array::ConstByteArray;
+  using Keys       = std::vector<ResourceID>;
+  using Documents  = std::vector<Document>;
+  using KeyValue   = std::pair<ResourceID, byte_array::ConstByteArray>;
+  using KeyValues  = std::vector<KeyValue>;
 
   static constexpr char const *LOGGING_NAME = "RevertibleDocumentStoreProtocol";
 
@@ -55,7 +62,10 @@ public:
 
     LOCK = 20,
     UNLOCK,
-    HAS_LOCK
+    HAS_LOCK,
+
+    GET_BATCH = 30,
+    SET_BATCH
   };
 
   explicit RevertibleDocumentStoreProtocol(NewRevertibleDocumentStore *doc_store)
@@ -65,6 +75,8 @@ public:
     this->Expose(GET, doc_store, &NewRevertibleDocumentStore::Get);
     this->Expose(GET_OR_CREATE, doc_store, &NewRevertibleDocumentStore::GetOrCreate);
     this->Expose(SET, doc_store, &NewRevertibleDocumentStore::Set);
+    this->Expose(GET_BATCH, this, &RevertibleDocumentStoreProtocol::GetBatch);
+    this->Expose(SET_BATCH, this, &RevertibleDocumentStoreProtocol::SetBatch);
 
     // Functionality for hashing/state
     this->Expose(COMMIT, doc_store, &NewRevertibleDocumentStore::Commit);
@@ -160,6 +172,38 @@ public:
     return success;
   }
 
+  /**
+   * Get a series of documents from the store in a single call
+   *
+   * @param keys The resources to be retrieved
+   * @return The documents, in the same order as the requested keys
+   */
+  Documents GetBatch(Keys const &keys)
+  {
+    Documents documents{};
+    documents.reserve(keys.size());
+
+    for (auto const &key : keys)
+    {
+      documents.emplace_back(doc_store_->Get(key));
+    }
+
+    return documents;
+  }
+
+  /**
+   * Set a series of values in the store in a single call
+   *
+   * @param key_values The resources and values to be set
+   */
+  void SetBatch(KeyValues const &key_values)
+  {
+    for (auto const &key_value : key_values)
+    {
+      doc_store_->Set(key_value.first, key_value.second);
+    }
+  }
+
 private:
   Document GetLaneChecked(ResourceID const &rid)
   {
@@ -57,6 +57,7 @@
 // (256), this represents that the node is a leaf. The nodes can contain additional information
 
 #include "crypto/sha256.hpp"
+#include "network/details/thread_pool.hpp"
 #include "storage/cached_random_access_stack.hpp"
 #include "storage/key.hpp"
 #include "storage/new_versioned_random_access_stack.hpp"
@@ -64,9 +65,16 @@
 #include "storage/storage_exception.hpp"
 #include "storage/versioned_random_access_stack.hpp"
 
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
 #include <cstring>
 #include <deque>
+#include <mutex>
+#include <numeric>
 #include <queue>
+#include <unordered_map>
+#include <vector>
 
 namespace fetch {
 namespace storage {
@@ -153,6 +161,29 @@ struct KeyValuePair
   }
 };
 
+namespace details {
+
+/**
+ * The workers which are shared between all the key value indices to rehash large batches. The
+ * number of workers is fixed, so concurrent batches queue for them rather than each creating
+ * their own threads.
+ *
+ * @param workers The number of workers (only used when the pool is first created)
+ * @return The started thread pool
+ */
+inline network::ThreadPool const &BatchRehashPool(std::size_t workers)
+{
+  static network::ThreadPool const pool = [workers]() {
+    auto thread_pool = network::MakeThreadPool(workers, "KVIRehash");
+    thread_pool->Start();
+    return thread_pool;
+  }();
+
+  return pool;
+}
+
+}  // namespace details
+
 /**
  * Allows users to store, retrieve and create key value pairs. Byte arrays are used for the key and
  * must be the correct size. This is written to file.
@@ -345,129 +376,162 @@ public:
   template <typename... Args>
   void Set(byte_array::ConstByteArray const &key_str, Args const &... args)
   {
-    key_type       key(key_str);
-    bool           split;
-    int            pos;
+    index_type     index;
     key_value_pair kv;
-    int            left_right;
 
-    index_type depth;
-    index_type index = FindNearest(key, kv, split, pos, left_right, depth);
+    bool const update_parent = SetLeaf(key_type{key_str}, index, kv, args...);
 
-    bool update_parent = false;
-
-    // Case where the 'nearest' is the root of the tree
-    if (index == key_value_pair::TREE_ROOT_VALUE)
-    {
-      kv.key        = key;
-      kv.parent     = key_value_pair::TREE_ROOT_VALUE;
-      kv.split      = uint16_t{key.size_in_bits()};
-      update_parent = kv.UpdateLeaf(args...);
-
-      index = stack_.Push(kv);
-    }
-    // Case where the nearest node is not a leaf, in that case the tree must be rearranged at that
-    // split
-    else if (split)
+    // Depending on whether the underlying stack is caching or not, we write to it or defer writing
+    // to it by scheduling updates until the next flush
+    if ((kv.parent != index_type(-1)) && (update_parent))
     {
-      key_value_pair left, right, parent;
-      index_type     rid = 0, lid = 0, pid = 0, cid = 0;
-      bool           update_root = (index == root_);
-
-      switch (left_right)
+      if (stack_.DirectWrite())
       {
-      case -1:
-        cid = rid = index;
-        right     = kv;
-
-        pid = right.parent;
-
-        left.key   = key;
-        left.split = uint16_t(key.size_in_bits());
+        UpdateParents(kv.parent, index, kv);
+      }
+      else
+      {
+        schedule_update_[index] = kv;
+      }
+    }
+  }
 
-        left.parent  = stack_.size() + 1;
-        right.parent = stack_.size() + 1;
+  /**
+   * A single key update to be applied as part of a batch
+   */
+  struct BatchUpdate
+  {
+    byte_array::ConstByteArray key;
+    index_type                 value;
+    byte_array::ConstByteArray data;
+  };
+  using BatchUpdates = std::vector<BatchUpdate>;
 
-        update_parent = left.UpdateLeaf(args...);
+  /**
+   * Apply a set of key updates to the trie in a single pass. The updates are applied in key order
+   * (for duplicate keys the last update wins) and each interior node whose merkle hash is
+   * affected is rehashed exactly once, with independent subtrees being hashed in parallel. Each
+   * modified node is then written back to the underlying stack once, and the stack is flushed once
+   * for the whole batch.
+   *
+   * The resulting trie (and root hash) is identical to applying the updates one at a time with
+   * Set(key, value, data).
+   *
+   * @param: updates The set of updates to be applied
+   */
+  void SetBatch(BatchUpdates const &updates)
+  {
+    if (updates.empty())
+    {
+      return;
+    }
 
-        lid = stack_.Push(left);
-        stack_.Set(rid, right);
-        break;
-      case 1:
-        cid = lid = index;
-        left      = kv;
+    // apply the updates in key order so that neighbouring leaves, which share the majority of
+    // their paths through the trie, are inserted together
+    std::vector<std::size_t> order(updates.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::stable_sort(order.begin(), order.end(), [&updates](std::size_t a, std::size_t b) {
+      return updates[a].key < updates[b].key;
+    });
 
-        pid = left.parent;
+    // insert all of the leaves into the trie without updating any of the interior hashes
+    std::vector<index_type> leaves;
+    leaves.reserve(updates.size() + schedule_update_.size());
 
-        right.key   = key;
-        right.split = uint16_t(key.size_in_bits());
+    for (auto const i : order)
+    {
+      auto const &update = updates[i];
 
-        right.parent = stack_.size() + 1;
-        left.parent  = stack_.size() + 1;
+      index_type     index;
+      key_value_pair kv;
+      SetLeaf(key_type{update.key}, index, kv, update.value, update.data);
 
-        update_parent = right.UpdateLeaf(args...);
+      leaves.push_back(index);
+    }
 
-        rid = stack_.Push(right);
-        stack_.Set(lid, left);
-        break;
-      }
+    // any updates that were deferred until the next flush are folded into this batch
+    for (auto const &entry : schedule_update_)
+    {
+      leaves.push_back(entry.first);
+    }
+    schedule_update_.clear();
 
-      kv.split  = uint16_t(pos);
-      kv.left   = lid;
-      kv.right  = rid;
-      kv.parent = pid;
-      index     = stack_.Push(kv);
+    // collect the set of interior nodes (and their children) which need to be rehashed
+    BatchNodes nodes;
+    for (auto const leaf : leaves)
+    {
+      key_value_pair kv;
+      stack_.Get(leaf, kv);
+      nodes[leaf] = BatchNode{kv, false};
 
-      if (update_root)
-      {
-        root_ = index;
-      }
-      else
+      index_type pid = kv.parent;
+      while (pid != key_value_pair::TREE_ROOT_VALUE)
       {
-        stack_.Get(pid, parent);
-        if (parent.left == cid)
+        auto it = nodes.find(pid);
+        if (it == nodes.end())
         {
-          parent.left = index;
+          key_value_pair parent;
+          stack_.Get(pid, parent);
+          it = nodes.emplace(pid, BatchNode{parent, false}).first;
         }
-        else
+        else if (it->second.dirty)
         {
-          parent.right = index;
+          // the remainder of the path has already been visited
+          break;
         }
-        stack_.Set(pid, parent);
+
+        it->second.dirty = true;
+        pid              = it->second.kv.parent;
       }
+    }
 
-      switch (left_right)
+    std::vector<index_type> dirty;
+    for (auto const &entry : nodes)
+    {
+      if (entry.second.dirty)
       {
-      case -1:
-        index = kv.left;
-        kv    = left;
-        break;
-      case 1:
-        index = kv.right;
-        kv    = right;
-        break;
+        dirty.push_back(entry.first);
       }
     }
-    // Case where we are overwriting a leaf that already exists
-    else
+
+    if (dirty.empty())
     {
-      update_parent = kv.UpdateLeaf(args...);
-      stack_.Set(uint64_t(index), kv);
+      stack_.Flush();
+      return;
     }
 
-    // Depending on whether the underlying stack is caching or not, we write to it or defer writing
-    // to it by scheduling updates until the next flush
-    if ((kv.parent != index_type(-1)) && (update_parent))
+    // load the clean siblings of the dirty nodes so that the hashing below does not need to
+    // access the stack
+    for (auto const index : dirty)
     {
-      if (stack_.DirectWrite())
-      {
-        UpdateParents(kv.parent, index, kv);
-      }
-      else
+      key_value_pair const node = nodes[index].kv;
+      for (auto const child : {node.left, node.right})
       {
-        schedule_update_[index] = kv;
+        if (nodes.find(child) == nodes.end())
+        {
+          key_value_pair kv;
+          stack_.Get(child, kv);
+          nodes[child] = BatchNode{kv, false};
+        }
       }
     }
+
+    if (dirty.size() < BATCH_PARALLEL_THRESHOLD)
+    {
+      RehashNodes(nodes, root_);
+    }
+    else
+    {
+      RehashNodesInParallel(nodes, root_);
+    }
+
+    // write back each of the updated nodes exactly once, and flush the stack once for the batch
+    for (auto const index : dirty)
+    {
+      stack_.Set(index, nodes[index].kv);
+    }
+
+    stack_.Flush();
   }
 
   byte_array::ByteArray Hash()
@@ -664,11 +728,278 @@ public:
   }
 
 private:
+  /**
+   * A node that is loaded into memory as part of a batch update
+   */
+  struct BatchNode
+  {
+    key_value_pair kv;
+    bool           dirty;
+  };
+  using BatchNodes = std::unordered_map<index_type, BatchNode>;
+
+  /// Minimum number of modified nodes before the rehashing of a batch is performed in parallel
+  static constexpr std::size_t BATCH_PARALLEL_THRESHOLD = 1024;
+  /// Number of trie levels over which the rehashing of a batch is split across threads
+  static constexpr std::size_t BATCH_PARALLEL_DEPTH = 2;
+  /// Number of pooled workers which assist the calling thread with the rehashing of a batch
+  static constexpr std::size_t BATCH_PARALLEL_WORKERS = (1u << BATCH_PARALLEL_DEPTH) - 1;
+
   stack_type stack_;
 
   uint64_t                                     root_ = 0;
   std::unordered_map<uint64_t, key_value_pair> schedule_update_;
 
+  /**
+   * Insert (or overwrite) the leaf for a key, rearranging the trie as required. The hashes of the
+   * parents of the leaf are not updated.
+   *
+   * @param: key The key
+   * @param: index The location of the leaf on the stack, set on return
+   * @param: kv The leaf, set on return
+   * @param: args The associated information with the key
+   *
+   * @return: true if the parents of the leaf need to be updated, otherwise false
+   */
+  template <typename... Args>
+  bool SetLeaf(key_type const &key, index_type &index, key_value_pair &kv, Args const &... args)
+  {
+    bool       split;
+    int        pos;
+    int        left_right;
+    index_type depth;
+
+    index = FindNearest(key, kv, split, pos, left_right, depth);
+
+    bool update_parent = false;
+
+    // Case where the 'nearest' is the root of the tree
+    if (index == key_value_pair::TREE_ROOT_VALUE)
+    {
+      kv.key        = key;
+      kv.parent     = key_value_pair::TREE_ROOT_VALUE;
+      kv.split      = uint16_t{key.size_in_bits()};
+      update_parent = kv.UpdateLeaf(args...);
+
+      index = stack_.Push(kv);
+    }
+    // Case where the nearest node is not a leaf, in that case the tree must be rearranged at that
+    // split
+    else if (split)
+    {
+      key_value_pair left, right, parent;
+      index_type     rid = 0, lid = 0, pid = 0, cid = 0;
+      bool           update_root = (index == root_);
+
+      switch (left_right)
+      {
+      case -1:
+        cid = rid = index;
+        right     = kv;
+
+        pid = right.parent;
+
+        left.key   = key;
+        left.split = uint16_t(key.size_in_bits());
+
+        left.parent  = stack_.size() + 1;
+        right.parent = stack_.size() + 1;
+
+        update_parent = left.UpdateLeaf(args...);
+
+        lid = stack_.Push(left);
+        stack_.Set(rid, right);
+        break;
+      case 1:
+        cid = lid = index;
+        left      = kv;
+
+        pid = left.parent;
+
+        right.key   = key;
+        right.split = uint16_t(key.size_in_bits());
+
+        right.parent = stack_.size() + 1;
+        left.parent  = stack_.size() + 1;
+
+        update_parent = right.UpdateLeaf(args...);
+
+        rid = stack_.Push(right);
+        stack_.Set(lid, left);
+        break;
+      }
+
+      kv.split  = uint16_t(pos);
+      kv.left   = lid;
+      kv.right  = rid;
+      kv.parent = pid;
+      index     = stack_.Push(kv);
+
+      if (update_root)
+      {
+        root_ = index;
+      }
+      else
+      {
+        stack_.Get(pid, parent);
+        if (parent.left == cid)
+        {
+          parent.left = index;
+        }
+        else
+        {
+          parent.right = index;
+        }
+        stack_.Set(pid, parent);
+      }
+
+      switch (left_right)
+      {
+      case -1:
+        index = kv.left;
+        kv    = left;
+        break;
+      case 1:
+        index = kv.right;
+        kv    = right;
+        break;
+      }
+    }
+    // Case where we are overwriting a leaf that already exists
+    else
+    {
+      update_parent = kv.UpdateLeaf(args...);
+      stack_.Set(uint64_t(index), kv);
+    }
+
+    return update_parent;
+  }
+
+  /**
+   * Recompute the merkle hashes of all the dirty nodes in the subtree rooted at the index specified
+   *
+   * @param: nodes The set of nodes being updated as part of the batch
+   * @param: index The index of the root of the subtree
+   */
+  static void RehashNodes(BatchNodes &nodes, index_type index)
+  {
+    auto &node = nodes.at(index);
+    if (!node.dirty || node.kv.is_leaf())
+    {
+      return;
+    }
+
+    RehashNodes(nodes, node.kv.left);
+    RehashNodes(nodes, node.kv.right);
+
+    node.kv.UpdateNode(nodes.at(node.kv.left).kv, nodes.at(node.kv.right).kv);
+  }
+
+  /**
+   * Collect the dirty subtrees found BATCH_PARALLEL_DEPTH levels below the index specified, along
+   * with the dirty nodes above them (parents before their children)
+   *
+   * @param: nodes The set of nodes being updated as part of the batch
+   * @param: index The index of the root of the subtree
+   * @param: depth The number of levels remaining until the subtrees are reached
+   * @param: subtrees The roots of the independent subtrees
+   * @param: upper The dirty nodes above the subtrees
+   */
+  static void CollectSubtrees(BatchNodes &nodes, index_type index, std::size_t depth,
+                              std::vector<index_type> &subtrees, std::vector<index_type> &upper)
+  {
+    auto const &node = nodes.at(index);
+    if (!node.dirty || node.kv.is_leaf())
+    {
+      return;
+    }
+
+    if (depth == 0)
+    {
+      subtrees.push_back(index);
+      return;
+    }
+
+    upper.push_back(index);
+    CollectSubtrees(nodes, node.kv.left, depth - 1, subtrees, upper);
+    CollectSubtrees(nodes, node.kv.right, depth - 1, subtrees, upper);
+  }
+
+  /**
+   * Recompute the merkle hashes of all the dirty nodes in the subtree rooted at the index
+   * specified. The independent dirty subtrees are shared between the calling thread and the
+   * pooled workers, after which the nodes above them are hashed by the calling thread.
+   *
+   * @param: nodes The set of nodes being updated as part of the batch
+   * @param: index The index of the root of the subtree
+   */
+  static void RehashNodesInParallel(BatchNodes &nodes, index_type index)
+  {
+    struct SharedWork
+    {
+      std::vector<index_type>  subtrees;
+      std::atomic<std::size_t> next{0};
+      std::size_t              completed{0};
+      std::mutex               lock;
+      std::condition_variable  done;
+    };
+
+    auto work = std::make_shared<SharedWork>();
+
+    std::vector<index_type> upper;
+    CollectSubtrees(nodes, index, BATCH_PARALLEL_DEPTH, work->subtrees, upper);
+
+    // hash subtrees until there are none left to claim. The work is shared, so that the calling
+    // thread completes the batch by itself even when no worker is available
+    auto const process = [&nodes](SharedWork &shared) {
+      for (;;)
+      {
+        std::size_t const i = shared.next++;
+        if (i >= shared.subtrees.size())
+        {
+          break;
+        }
+
+        RehashNodes(nodes, shared.subtrees[i]);
+
+        std::lock_guard<std::mutex> guard(shared.lock);
+        if (++shared.completed == shared.subtrees.size())
+        {
+          shared.done.notify_all();
+        }
+      }
+    };
+
+    if (work->subtrees.empty())
+    {
+      return;
+    }
+
+    auto const &pool = details::BatchRehashPool(BATCH_PARALLEL_WORKERS);
+
+    std::size_t const helpers =
+        std::min(work->subtrees.size(), BATCH_PARALLEL_WORKERS + 1) - std::size_t{1};
+    for (std::size_t i = 0; i < helpers; ++i)
+    {
+      // workers which start after all the subtrees have been claimed return immediately
+      pool->Post([work, process]() { process(*work); });
+    }
+
+    process(*work);
+
+    {
+      std::unique_lock<std::mutex> guard(work->lock);
+      work->done.wait(guard, [&work]() { return work->completed == work->subtrees.size(); });
+    }
+
+    // hash the remaining nodes, children before their parents
+    for (auto it = upper.rbegin(); it != upper.rend(); ++it)
+    {
+      auto &node = nodes.at(*it);
+      node.kv.UpdateNode(nodes.at(node.kv.left).kv, nodes.at(node.kv.right).kv);
+    }
+  }
+
   /**
    * Update the parents of a changed node, since this changes the merkle tree
    *
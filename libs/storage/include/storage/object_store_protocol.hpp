@@ -57,8 +57,7 @@ public:
     GET = 0,
     SET,
     SET_BULK,
-    HAS,
-    GET_RECENT
+    HAS
   };
 
   ObjectStoreProtocol(TransientObjectStore<T> *obj_store)
@@ -69,7 +68,6 @@ public:
     this->Expose(SET, this, &self_type::Set);
     this->Expose(SET_BULK, this, &self_type::SetBulk);
     this->Expose(HAS, obj_store, &TransientObjectStore<T>::Has);
-    this->Expose(GET_RECENT, obj_store, &TransientObjectStore<T>::GetRecent);
   }
 
 private:
@@ -48,11 +48,12 @@ template <typename Object>
 class TransientObjectStore
 {
 public:
-  using Callback     = std::function<void(Object const &)>;
-  using Archive      = ObjectStore<Object>;
-  using TxLayouts    = std::vector<ledger::TransactionLayout>;
-  using TxArray      = std::vector<ledger::Transaction>;
-  using WeakRunnable = core::WeakRunnable;
+  using Callback       = std::function<void(Object const &)>;
+  using RecentCallback = std::function<void()>;
+  using Archive        = ObjectStore<Object>;
+  using TxLayouts      = std::vector<ledger::TransactionLayout>;
+  using TxArray        = std::vector<ledger::Transaction>;
+  using WeakRunnable   = core::WeakRunnable;
 
   static constexpr char const *LOGGING_NAME = "TransientObjectStore";
 
@@ -69,7 +70,7 @@ public:
   bool      Has(ResourceID const &rid);
   void      Set(ResourceID const &rid, Object const &object, bool newly_seen);
   bool      Confirm(ResourceID const &rid);
-  TxLayouts GetRecent(uint32_t max_to_poll);
+  TxLayouts PopRecent(uint32_t max_to_pop);
   /// @}
 
   void SetCallback(Callback cb)
@@ -77,6 +78,11 @@ public:
     set_callback_ = std::move(cb);
   }
 
+  void SetRecentCallback(RecentCallback cb)
+  {
+    recent_callback_ = std::move(cb);
+  }
+
   // Operators
   TransientObjectStore &operator=(TransientObjectStore const &) = delete;
   TransientObjectStore &operator=(TransientObjectStore &&) = delete;
@@ -125,6 +131,7 @@ private:
   Queue           confirm_queue_;     ///< The queue of elements to be stored
   RecentQueue     most_recent_seen_;  ///< The queue of elements to be stored
   Callback        set_callback_;      ///< The completion handler
+  RecentCallback  recent_callback_;   ///< Called when a newly seen object has been queued
   Flag            stop_{false};       ///< Flag to signal the stop of the worker
   static constexpr core::Tickets::Count recent_queue_alarm_threshold{RecentQueue::QUEUE_LENGTH >>
                                                                      1};
@@ -349,30 +356,25 @@ bool TransientObjectStore<O>::Get(ResourceID const &rid, O &object)
 }
 
 /**
- * Get the recent transactions seen at the store (recently seen to the node/lane).
+ * Take the recent transactions seen at the store without waiting for new ones to arrive
+ *
+ * Note: The summaries are removed from the store, so there must only be a single consumer (the
+ * transaction feed of the lane)
  *
  * @tparam O The type of the object being stored
- * @param max_to_poll the maximum number we want to return
+ * @param max_to_pop The maximum number of summaries to return
  * @return a vector of the tx summaries
  */
 template <typename O>
-typename TransientObjectStore<O>::TxLayouts TransientObjectStore<O>::GetRecent(uint32_t max_to_poll)
+typename TransientObjectStore<O>::TxLayouts TransientObjectStore<O>::PopRecent(uint32_t max_to_pop)
 {
-  static const std::chrono::milliseconds MAX_WAIT{5};
-
   TxLayouts                 layouts{};
   ledger::TransactionLayout summary;
 
-  for (std::size_t i = 0; i < max_to_poll; ++i)
+  while ((layouts.size() < max_to_pop) &&
+         most_recent_seen_.Pop(summary, std::chrono::milliseconds::zero()))
   {
-    if (most_recent_seen_.Pop(summary, MAX_WAIT))
-    {
-      layouts.push_back(summary);
-    }
-    else
-    {
-      break;
-    }
+    layouts.push_back(summary);
   }
 
   return layouts;
@@ -430,6 +432,11 @@ void TransientObjectStore<O>::Set(ResourceID const &rid, O const &object, bool n
       }
       prev_count = count;
     }
+
+    if (inserted && recent_callback_)
+    {
+      recent_callback_();
+    }
   }
 
   // dispatch the callback if necessary
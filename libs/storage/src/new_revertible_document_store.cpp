@@ -19,6 +19,7 @@
 /* static constexpr char const *LOGGING_NAME = "RevertableStore"; */
 
 #include "storage/new_revertible_document_store.hpp"
+#include "metrics/registry.hpp"
 
 using Hash           = fetch::storage::NewRevertibleDocumentStore::Hash;
 using ByteArray      = fetch::storage::NewRevertibleDocumentStore::ByteArray;
@@ -95,6 +96,11 @@ void NewRevertibleDocumentStore::Set(ResourceID const &rid, ByteArray const &val
 // State-based operations
 Hash NewRevertibleDocumentStore::Commit()
 {
+  static auto &commit_duration = metrics::Registry::Instance().LookupHistogram(
+      "storage_commit_duration_seconds", "The time taken to commit and flush the state database");
+
+  metrics::HistogramTimer const timer{commit_duration};
+
   Hash ret{std::move(storage_.Commit())};
   storage_.Flush(false);
   return ret;
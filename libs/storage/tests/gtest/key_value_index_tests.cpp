@@ -426,6 +426,93 @@ bool LoadSaveVsBulk()
          (bulk_size == batched_size) && (random_batched_size == bulk_size);
 }
 
+template <typename T>
+bool BatchHashConsistency()
+{
+  std::vector<TestData> values;
+  for (std::size_t i = 0; i < 10000; ++i)
+  {
+    byte_array::ByteArray key;
+    key.Resize(256 / 8);
+    for (std::size_t j = 0; j < key.size(); ++j)
+    {
+      key[j] = uint8_t(lfg() >> 9);
+    }
+
+    if (reference.find(key) != reference.end())
+    {
+      continue;
+    }
+
+    reference[key] = lfg();
+    values.push_back({key, reference[key]});
+  }
+
+  // the overwrites of existing keys that will be applied at the end
+  std::vector<TestData> updates;
+  for (std::size_t i = 0; i < values.size(); i += 7)
+  {
+    updates.push_back({values[i].key, lfg()});
+  }
+
+  T index1;
+  index1.New("test1.db");
+  for (auto const &val : values)
+  {
+    index1.Set(val.key, val.value, val.key);
+  }
+  for (auto const &val : updates)
+  {
+    index1.Set(val.key, val.value, val.key);
+  }
+
+  auto const hash1 = index1.Hash();
+  auto const size1 = index1.size();
+
+  // insert the first portion of the keys individually (which for caching stacks leaves pending
+  // updates) and then apply the remainder in a series of batches
+  T index2;
+  index2.New("test2.db");
+
+  std::size_t const num_single = values.size() / 4;
+  for (std::size_t i = 0; i < num_single; ++i)
+  {
+    auto const &val = values[i];
+    index2.Set(val.key, val.value, val.key);
+  }
+
+  typename T::BatchUpdates batch;
+  for (std::size_t i = num_single; i < values.size(); ++i)
+  {
+    auto const &val = values[i];
+    batch.push_back({val.key, val.value, val.key});
+
+    if (batch.size() == 2000)
+    {
+      index2.SetBatch(batch);
+      batch.clear();
+    }
+  }
+  for (auto const &val : updates)
+  {
+    batch.push_back({val.key, val.value, val.key});
+  }
+  index2.SetBatch(batch);
+
+  auto const hash2 = index2.Hash();
+  auto const size2 = index2.size();
+
+  for (auto const &val : updates)
+  {
+    if (index2.Get(val.key) != val.value)
+    {
+      return false;
+    }
+  }
+
+  return (hash1 == hash2) && (size1 == size2);
+}
+
 TEST(storage_key_value_index_gtest, Value_consistency)
 {
 
@@ -442,6 +529,11 @@ TEST(storage_key_value_index_gtest, Hash_consistency)
   EXPECT_TRUE(IntermediateFlushHashConsistency());
   EXPECT_TRUE(DoubleInsertionhConsistency());
 }
+TEST(storage_key_value_index_gtest, Batch_hash_consistency)
+{
+  EXPECT_TRUE(BatchHashConsistency<kvi_type>());
+  EXPECT_TRUE(BatchHashConsistency<cached_kvi_type>());
+}
 TEST(storage_key_value_index_gtest, Load_save_consistency)
 {
   EXPECT_TRUE(LoadSaveVsBulk());
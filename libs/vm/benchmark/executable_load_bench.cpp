@@ -0,0 +1,171 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/serializers/typed_byte_array_buffer.hpp"
+#include "vm/compiler.hpp"
+#include "vm/executable_serializer.hpp"
+#include "vm/module.hpp"
+#include "vm/vm.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::serializers::TypedByteArrayBuffer;
+using fetch::vm::Compiler;
+using fetch::vm::Executable;
+using fetch::vm::IR;
+using fetch::vm::Module;
+using fetch::vm::VM;
+
+// A contract of a representative size with a mixture of annotated entry points and helpers
+char const *const CONTRACT = R"(
+  function clamp(value : Int64, lower : Int64, upper : Int64) : Int64
+    if (value < lower)
+      return lower;
+    elseif (value > upper)
+      return upper;
+    endif
+    return value;
+  endfunction
+
+  function fee(amount : Int64, rate : Int64) : Int64
+    var charge = (amount * rate) / 10000i64;
+    return clamp(charge, 1i64, 1000000i64);
+  endfunction
+
+  function describe(amount : Int64) : String
+    var text = 'amount: ' + 'unknown';
+    if (amount > 1000i64)
+      text = 'amount: large';
+    elseif (amount > 100i64)
+      text = 'amount: medium';
+    else
+      text = 'amount: small';
+    endif
+    return text;
+  endfunction
+
+  @init
+  function setup()
+    var total = 0i64;
+    for (i in 0:100)
+      total = total + fee(toInt64(i) * 1000i64, 25i64);
+    endfor
+  endfunction
+
+  @action
+  function transfer(amount : Int64, rate : Int64) : Int64
+    var remaining = amount - fee(amount, rate);
+    var steps = 0;
+    while (remaining > 0i64)
+      remaining = remaining / 2i64;
+      steps = steps + 1;
+    endwhile
+    return toInt64(steps);
+  endfunction
+
+  @query
+  function summary(amount : Int64) : String
+    return describe(amount);
+  endfunction
+
+  @query
+  function average(a : Float64, b : Float64, c : Float64) : Float64
+    var values = Array<Float64>(3);
+    values[0] = a;
+    values[1] = b;
+    values[2] = c;
+    var total = 0.0;
+    for (i in 0:3)
+      total = total + values[i];
+    endfor
+    return total / 3.0;
+  endfunction
+)";
+
+void Compile(Module &module, Executable &executable)
+{
+  Compiler                 compiler{&module};
+  IR                       ir;
+  VM                       vm{&module};
+  std::vector<std::string> errors;
+
+  if (!compiler.Compile(CONTRACT, "bench", ir, errors) ||
+      !vm.GenerateExecutable(ir, "bench_ir", executable, errors))
+  {
+    throw std::runtime_error("Unable to compile benchmark contract");
+  }
+}
+
+/**
+ * Cold start contract load by compiling the source from scratch
+ */
+void ExecutableLoad_Compile(benchmark::State &state)
+{
+  for (auto _ : state)
+  {
+    Module     module;
+    Executable executable;
+    Compile(module, executable);
+
+    benchmark::DoNotOptimize(executable.functions.data());
+  }
+}
+
+/**
+ * Cold start contract load by deserializing a previously compiled executable. The module still
+ * needs to be prepared by a compiler and the opcode table version computed to validate the entry.
+ */
+void ExecutableLoad_Deserialize(benchmark::State &state)
+{
+  TypedByteArrayBuffer buffer;
+  {
+    Module     module;
+    Executable executable;
+    Compile(module, executable);
+
+    buffer << executable;
+  }
+
+  for (auto _ : state)
+  {
+    Module   module;
+    Compiler compiler{&module};
+    VM       vm{&module};
+
+    benchmark::DoNotOptimize(vm.GetOpcodeTableVersion());
+
+    Executable executable;
+    buffer.seek(0);
+    buffer >> executable;
+
+    benchmark::DoNotOptimize(executable.functions.data());
+  }
+
+  state.SetBytesProcessed(state.iterations() * static_cast<int64_t>(buffer.size()));
+}
+
+}  // namespace
+
+BENCHMARK(ExecutableLoad_Compile);
+BENCHMARK(ExecutableLoad_Deserialize);
@@ -0,0 +1,144 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/compiler.hpp"
+#include "vm/module.hpp"
+#include "vm/vm.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::vm::Compiler;
+using fetch::vm::Executable;
+using fetch::vm::IR;
+using fetch::vm::Module;
+using fetch::vm::Variant;
+using fetch::vm::VM;
+
+// Each script runs a tight loop that is dominated by a particular group of opcodes
+char const *const FOR_RANGE = R"(
+  function main() : Int32
+    var count = 0;
+    for (i in 0:1000)
+    endfor
+    return count;
+  endfunction
+)";
+
+char const *const ADD_CONSTANT = R"(
+  function main() : Int32
+    var total = 0;
+    for (i in 0:1000)
+      total = total + 3;
+    endfor
+    return total;
+  endfunction
+)";
+
+char const *const ADD_VARIABLE = R"(
+  function main() : Int32
+    var total = 0;
+    for (i in 0:1000)
+      total = total + i;
+    endfor
+    return total;
+  endfunction
+)";
+
+char const *const MIXED_ARITHMETIC = R"(
+  function main() : Int64
+    var total = 1i64;
+    var scale = 3i64;
+    for (i in 0:1000)
+      total = total * scale;
+      total = total - 7i64;
+      total = (total % 1000003i64) + 1i64;
+    endfor
+    return total;
+  endfunction
+)";
+
+char const *const WHILE_LOOP = R"(
+  function main() : Int32
+    var i = 0;
+    var total = 0;
+    while (i < 1000)
+      total = total + i;
+      i = i + 1;
+    endwhile
+    return total;
+  endfunction
+)";
+
+char const *const FUNCTION_CALLS = R"(
+  function add(a : Int32, b : Int32) : Int32
+    return a + b;
+  endfunction
+
+  function main() : Int32
+    var total = 0;
+    for (i in 0:1000)
+      total = add(total, i);
+    endfor
+    return total;
+  endfunction
+)";
+
+void RunScript(benchmark::State &state, char const *source)
+{
+  Module                   module;
+  Compiler                 compiler{&module};
+  IR                       ir;
+  Executable               executable;
+  VM                       vm{&module};
+  std::vector<std::string> errors;
+
+  if (!compiler.Compile(source, "bench", ir, errors) ||
+      !vm.GenerateExecutable(ir, "bench_ir", executable, errors))
+  {
+    throw std::runtime_error("Unable to compile benchmark script");
+  }
+
+  for (auto _ : state)
+  {
+    std::string error;
+    Variant     output;
+
+    if (!vm.Execute(executable, "main", error, output))
+    {
+      state.SkipWithError(error.c_str());
+      break;
+    }
+
+    benchmark::DoNotOptimize(output);
+  }
+}
+
+}  // namespace
+
+BENCHMARK_CAPTURE(RunScript, ForRange, FOR_RANGE);
+BENCHMARK_CAPTURE(RunScript, AddConstant, ADD_CONSTANT);
+BENCHMARK_CAPTURE(RunScript, AddVariable, ADD_VARIABLE);
+BENCHMARK_CAPTURE(RunScript, MixedArithmetic, MIXED_ARITHMETIC);
+BENCHMARK_CAPTURE(RunScript, WhileLoop, WHILE_LOOP);
+BENCHMARK_CAPTURE(RunScript, FunctionCalls, FUNCTION_CALLS);
@@ -0,0 +1,114 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/compiler.hpp"
+#include "vm/module.hpp"
+#include "vm/vm.hpp"
+#include "vm/vm_pool.hpp"
+
+#include <benchmark/benchmark.h>
+
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace {
+
+using fetch::vm::Compiler;
+using fetch::vm::Executable;
+using fetch::vm::IR;
+using fetch::vm::Module;
+using fetch::vm::Variant;
+using fetch::vm::VM;
+using fetch::vm::VMPool;
+
+// a short action, typical of contract invocations, which makes use of constant strings
+char const *const SOURCE = R"(
+  function action(amount : Int32) : Int32
+    var from = "balance.from";
+    var to = "balance.to";
+    var total = amount;
+    for (i in 0:8)
+      total = total + i;
+    endfor
+    return total;
+  endfunction
+)";
+
+struct CompiledSource
+{
+  CompiledSource()
+  {
+    Compiler                 compiler{&module};
+    IR                       ir;
+    std::vector<std::string> errors;
+
+    VM vm{&module};
+    if (!compiler.Compile(SOURCE, "bench", ir, errors) ||
+        !vm.GenerateExecutable(ir, "bench_ir", executable, errors))
+    {
+      throw std::runtime_error("Unable to compile benchmark source");
+    }
+  }
+
+  Module     module;
+  Executable executable;
+};
+
+void Invoke(benchmark::State &state, VM &vm, Executable const &executable)
+{
+  std::string error;
+  Variant     output;
+
+  if (!vm.Execute(executable, "action", error, output, int32_t{42}))
+  {
+    state.SkipWithError(error.c_str());
+  }
+
+  benchmark::DoNotOptimize(output);
+}
+
+void VM_InvokeFresh(benchmark::State &state)
+{
+  CompiledSource source{};
+
+  for (auto _ : state)
+  {
+    auto vm = std::make_unique<VM>(&source.module);
+    Invoke(state, *vm, source.executable);
+  }
+}
+
+void VM_InvokePooled(benchmark::State &state)
+{
+  CompiledSource source{};
+  VMPool         pool{&source.module};
+
+  for (auto _ : state)
+  {
+    auto vm = pool.Acquire();
+    Invoke(state, *vm, source.executable);
+  }
+}
+
+}  // namespace
+
+BENCHMARK(VM_InvokeFresh);
+BENCHMARK(VM_InvokePooled);
@@ -0,0 +1,277 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "core/serializers/stl_types.hpp"
+#include "vm/generator.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+
+namespace fetch {
+namespace vm {
+
+/**
+ * The version of the binary layout produced by the executable serializers below. This must be
+ * incremented whenever the layout or the meaning of the serialized fields changes.
+ */
+static constexpr uint16_t EXECUTABLE_FORMAT_VERSION = 1;
+
+template <typename T>
+void Serialize(T &serializer, TypeInfo const &info)
+{
+  serializer << static_cast<uint8_t>(info.type_kind) << info.name << info.parameter_type_ids;
+}
+
+template <typename T>
+void Deserialize(T &serializer, TypeInfo &info)
+{
+  uint8_t type_kind{0};
+  serializer >> type_kind >> info.name >> info.parameter_type_ids;
+  info.type_kind = static_cast<TypeKind>(type_kind);
+}
+
+template <typename T>
+void Serialize(T &serializer, AnnotationLiteral const &literal)
+{
+  serializer << static_cast<uint8_t>(literal.type);
+
+  switch (literal.type)
+  {
+  case AnnotationLiteralType::Boolean:
+    serializer << static_cast<uint8_t>(literal.boolean);
+    break;
+  case AnnotationLiteralType::Integer:
+    serializer << literal.integer;
+    break;
+  case AnnotationLiteralType::Real:
+    serializer << literal.real;
+    break;
+  case AnnotationLiteralType::String:
+  case AnnotationLiteralType::Identifier:
+    serializer << literal.str;
+    break;
+  case AnnotationLiteralType::Unknown:
+    break;
+  }
+}
+
+template <typename T>
+void Deserialize(T &serializer, AnnotationLiteral &literal)
+{
+  uint8_t type{0};
+  serializer >> type;
+
+  switch (static_cast<AnnotationLiteralType>(type))
+  {
+  case AnnotationLiteralType::Boolean:
+  {
+    uint8_t value{0};
+    serializer >> value;
+    literal.SetBoolean(value != 0);
+    break;
+  }
+  case AnnotationLiteralType::Integer:
+  {
+    int64_t value{0};
+    serializer >> value;
+    literal.SetInteger(value);
+    break;
+  }
+  case AnnotationLiteralType::Real:
+  {
+    double value{0};
+    serializer >> value;
+    literal.SetReal(value);
+    break;
+  }
+  case AnnotationLiteralType::String:
+  {
+    std::string value;
+    serializer >> value;
+    literal.SetString(value);
+    break;
+  }
+  case AnnotationLiteralType::Identifier:
+  {
+    std::string value;
+    serializer >> value;
+    literal.SetIdentifier(value);
+    break;
+  }
+  case AnnotationLiteralType::Unknown:
+    literal = AnnotationLiteral{};
+    break;
+  default:
+    throw std::runtime_error("Invalid annotation literal type in serialized executable");
+  }
+}
+
+template <typename T>
+void Serialize(T &serializer, AnnotationElement const &element)
+{
+  serializer << static_cast<uint8_t>(element.type) << element.name << element.value;
+}
+
+template <typename T>
+void Deserialize(T &serializer, AnnotationElement &element)
+{
+  uint8_t type{0};
+  serializer >> type >> element.name >> element.value;
+  element.type = static_cast<AnnotationElementType>(type);
+}
+
+template <typename T>
+void Serialize(T &serializer, Annotation const &annotation)
+{
+  serializer << annotation.name << annotation.elements;
+}
+
+template <typename T>
+void Deserialize(T &serializer, Annotation &annotation)
+{
+  serializer >> annotation.name >> annotation.elements;
+}
+
+/**
+ * Serializer for a compiled executable
+ *
+ * Constants are restricted to primitive values by the generator and so are stored as their raw
+ * 64-bit representation. Type ids and any opcodes registered by modules are only meaningful for
+ * the module configuration that produced the executable, callers are expected to guard persisted
+ * executables with VM::GetOpcodeTableVersion().
+ *
+ * @tparam T The serializer type
+ * @param serializer The reference to the serializer
+ * @param executable The reference to the executable to be serialised
+ */
+template <typename T>
+void Serialize(T &serializer, Executable const &executable)
+{
+  serializer << EXECUTABLE_FORMAT_VERSION << executable.name << executable.strings;
+
+  serializer << static_cast<uint64_t>(executable.constants.size());
+  for (auto const &constant : executable.constants)
+  {
+    serializer << constant.type_id << constant.primitive.ui64;
+  }
+
+  serializer << executable.types;
+
+  serializer << static_cast<uint64_t>(executable.functions.size());
+  for (auto const &function : executable.functions)
+  {
+    serializer << function.name << function.annotations
+               << static_cast<int32_t>(function.num_parameters) << function.return_type_id;
+
+    serializer << static_cast<uint64_t>(function.variables.size());
+    for (auto const &variable : function.variables)
+    {
+      serializer << variable.name << variable.type_id << variable.scope_number;
+    }
+
+    serializer << static_cast<uint64_t>(function.instructions.size());
+    for (auto const &instruction : function.instructions)
+    {
+      serializer << instruction.opcode << instruction.type_id << instruction.index
+                 << instruction.data;
+    }
+
+    serializer << function.pc_to_line_map_;
+  }
+}
+
+/**
+ * Deserializer for a compiled executable
+ *
+ * @tparam T The serializer type
+ * @param serializer The reference to the serializer
+ * @param executable The reference to the output executable to be populated
+ * @throws std::runtime_error if the executable was written with a different format version
+ */
+template <typename T>
+void Deserialize(T &serializer, Executable &executable)
+{
+  uint16_t format_version{0};
+  serializer >> format_version;
+
+  if (format_version != EXECUTABLE_FORMAT_VERSION)
+  {
+    throw std::runtime_error("Unsupported serialized executable format version");
+  }
+
+  executable = Executable{};
+  serializer >> executable.name >> executable.strings;
+
+  uint64_t num_constants{0};
+  serializer >> num_constants;
+  executable.constants.resize(num_constants);
+  for (auto &constant : executable.constants)
+  {
+    TypeId    type_id{0};
+    Primitive primitive{};
+    serializer >> type_id >> primitive.ui64;
+    constant.Construct(primitive, type_id);
+  }
+
+  serializer >> executable.types;
+
+  uint64_t num_functions{0};
+  serializer >> num_functions;
+  for (uint64_t i = 0; i < num_functions; ++i)
+  {
+    std::string     name;
+    AnnotationArray annotations;
+    int32_t         num_parameters{0};
+    TypeId          return_type_id{0};
+    serializer >> name >> annotations >> num_parameters >> return_type_id;
+
+    Executable::Function function{name, annotations, num_parameters, return_type_id};
+
+    uint64_t num_variables{0};
+    serializer >> num_variables;
+    for (uint64_t j = 0; j < num_variables; ++j)
+    {
+      std::string variable_name;
+      TypeId      type_id{0};
+      uint16_t    scope_number{0};
+      serializer >> variable_name >> type_id >> scope_number;
+
+      function.AddVariable(variable_name, type_id, scope_number);
+    }
+
+    uint64_t num_instructions{0};
+    serializer >> num_instructions;
+    function.instructions.reserve(num_instructions);
+    for (uint64_t j = 0; j < num_instructions; ++j)
+    {
+      Executable::Instruction instruction{0};
+      serializer >> instruction.opcode >> instruction.type_id >> instruction.index >>
+          instruction.data;
+
+      function.AddInstruction(instruction);
+    }
+
+    serializer >> function.pc_to_line_map_;
+
+    executable.AddFunction(function);
+  }
+}
+
+}  // namespace vm
+}  // namespace fetch
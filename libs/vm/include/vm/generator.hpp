@@ -109,6 +109,9 @@ struct Executable
   }
   ~Executable() = default;
 
+  // The number of instructions represented by each superinstruction
+  static constexpr uint16_t FUSED_SEQUENCE_LENGTH = 4;
+
   struct Instruction
   {
     Instruction(uint16_t opcode__)
@@ -313,6 +316,7 @@ private:
                                         IRExpressionNodePtr const &operand);
   void     ScopeEnter();
   void     ScopeLeave(IRBlockNodePtr const &block_node);
+  void     Optimise(Executable::Function &function);
   uint16_t AddConstant(Variant const &c);
   uint16_t GetInplaceArithmeticOpcode(bool is_primitive, TypeId lhs_type_id, TypeId rhs_type_id,
                                       uint16_t opcode1, uint16_t opcode2, uint16_t opcode3);
@@ -101,7 +101,14 @@ static const uint16_t VariableObjectInplaceDivide        = 74;
 static const uint16_t VariableObjectInplaceRightDivide   = 75;
 static const uint16_t PrimitiveModulo                    = 76;
 static const uint16_t VariablePrimitiveInplaceModulo     = 77;
-static const uint16_t NumReserved                        = 78;
+// Superinstructions replace the first instruction of a fused sequence (see Generator::Optimise)
+static const uint16_t VariablePrimitiveAddConstant       = 78;
+static const uint16_t VariablePrimitiveSubtractConstant  = 79;
+static const uint16_t VariablePrimitiveMultiplyConstant  = 80;
+static const uint16_t VariablePrimitiveAddVariable       = 81;
+static const uint16_t VariablePrimitiveSubtractVariable  = 82;
+static const uint16_t VariablePrimitiveMultiplyVariable  = 83;
+static const uint16_t NumReserved                        = 84;
 }  // namespace Opcodes
 
 }  // namespace vm
@@ -218,6 +218,17 @@ public:
   bool GenerateExecutable(IR const &ir, std::string const &name, Executable &executable,
                           std::vector<std::string> &errors);
 
+  void Reset();
+
+  /**
+   * Compute a tag which identifies the opcode and type tables of this VM instance. Persisted
+   * executables are only valid for VMs which report the same tag since the extension opcodes and
+   * type ids depend on the module configuration.
+   *
+   * @return The version tag
+   */
+  uint64_t GetOpcodeTableVersion() const;
+
   template <typename... Ts>
   bool Execute(Executable const &executable, std::string const &name, std::string &error,
                Variant &output, Ts const &... parameters)
@@ -463,6 +474,7 @@ private:
   Executable const *             executable_;
   Executable::Function const *   function_;
   std::vector<Ptr<String>>       strings_;
+  std::size_t                    num_module_types_{0};
   Frame                          frame_stack_[FRAME_STACK_SIZE];
   int                            frame_sp_;
   int                            bsp_;
@@ -488,6 +500,9 @@ private:
   }
 
   bool Execute(std::string &error, Variant &output);
+  void Dispatch();
+  void LoadExecutable(Executable const &executable);
+  bool HasLocalTypes(Executable const &executable) const;
   void Destruct(uint16_t scope_number);
 
   TypeId FindType(std::string const &name) const
@@ -1369,6 +1384,30 @@ private:
     DoNumericInplaceOp<Op>(instruction_->type_id, &variable.primitive);
   }
 
+  template <typename Op>
+  void DoVariableNumericConstantOp()
+  {
+    Variant &variable = GetVariable(instruction_->index);
+    Variant  rhsv{executable_->constants[instruction_->data]};
+    ExecuteNumericOp<Op>(instruction_->type_id, variable, rhsv);
+    SkipFusedInstructions();
+  }
+
+  template <typename Op>
+  void DoVariableNumericVariableOp()
+  {
+    Variant &variable = GetVariable(instruction_->index);
+    Variant  rhsv{GetVariable(instruction_->data)};
+    ExecuteNumericOp<Op>(instruction_->type_id, variable, rhsv);
+    SkipFusedInstructions();
+  }
+
+  void SkipFusedInstructions()
+  {
+    // the original instructions of the fused sequence remain in place after the superinstruction
+    pc_ = uint16_t(instruction_pc_ + Executable::FUSED_SEQUENCE_LENGTH);
+  }
+
   template <typename Op>
   void DoVariableObjectInplaceOp()
   {
@@ -1463,6 +1502,12 @@ private:
   void Handler__VariableObjectInplaceRightDivide();
   void Handler__PrimitiveModulo();
   void Handler__VariablePrimitiveInplaceModulo();
+  void Handler__VariablePrimitiveAddConstant();
+  void Handler__VariablePrimitiveSubtractConstant();
+  void Handler__VariablePrimitiveMultiplyConstant();
+  void Handler__VariablePrimitiveAddVariable();
+  void Handler__VariablePrimitiveSubtractVariable();
+  void Handler__VariablePrimitiveMultiplyVariable();
 
   friend class Object;
   friend class Module;
@@ -0,0 +1,90 @@
+#pragma once
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/vm.hpp"
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace fetch {
+namespace vm {
+
+class Module;
+
+/**
+ * A pool of reusable VM instances which are all bound to the same module.
+ *
+ * Constructing a VM is expensive relative to executing a short function, so callers which invoke
+ * functions at a high rate should acquire instances from a pool rather than creating a new VM for
+ * each invocation. Instances are reset when they are returned to the pool. The pool must outlive
+ * all of the instances acquired from it.
+ */
+class VMPool
+{
+public:
+  static constexpr std::size_t DEFAULT_MAX_IDLE = 4;
+
+  /**
+   * Returns a VM instance to the pool from which it was acquired
+   */
+  class Releaser
+  {
+  public:
+    explicit Releaser(VMPool *pool = nullptr)
+      : pool_{pool}
+    {}
+
+    void operator()(VM *vm) const;
+
+  private:
+    VMPool *pool_;
+  };
+
+  using VMPtr = std::unique_ptr<VM, Releaser>;
+
+  // Construction / Destruction
+  explicit VMPool(Module *module, std::size_t max_idle = DEFAULT_MAX_IDLE);
+  VMPool(VMPool const &) = delete;
+  VMPool(VMPool &&)      = delete;
+  ~VMPool()              = default;
+
+  VMPtr       Acquire();
+  std::size_t GetNumIdle() const;
+
+  // Operators
+  VMPool &operator=(VMPool const &) = delete;
+  VMPool &operator=(VMPool &&) = delete;
+
+private:
+  using Mutex  = std::mutex;
+  using VMList = std::vector<std::unique_ptr<VM>>;
+
+  void Release(VM *vm);
+
+  Module *          module_;
+  std::size_t const max_idle_;
+
+  mutable Mutex lock_;
+  VMList        idle_;  ///< The instances available for reuse
+};
+
+}  // namespace vm
+}  // namespace fetch
@@ -72,6 +72,11 @@ bool Generator::GenerateExecutable(IR const &ir, std::string const &name, Execut
   CreateFunctions(ir.root_);
   HandleBlock(ir.root_);
 
+  for (auto &function : executable_.functions)
+  {
+    Optimise(function);
+  }
+
   executable = std::move(executable_);
   scopes_.clear();
   loops_.clear();
@@ -1546,6 +1551,74 @@ void Generator::ScopeLeave(IRBlockNodePtr const &block_node)
   scopes_.pop_back();
 }
 
+namespace {
+
+uint16_t GetSuperinstructionOpcode(uint16_t operand_opcode, uint16_t arithmetic_opcode)
+{
+  bool const is_constant = (operand_opcode == Opcodes::PushConstant);
+
+  switch (arithmetic_opcode)
+  {
+  case Opcodes::PrimitiveAdd:
+    return is_constant ? Opcodes::VariablePrimitiveAddConstant
+                       : Opcodes::VariablePrimitiveAddVariable;
+  case Opcodes::PrimitiveSubtract:
+    return is_constant ? Opcodes::VariablePrimitiveSubtractConstant
+                       : Opcodes::VariablePrimitiveSubtractVariable;
+  case Opcodes::PrimitiveMultiply:
+    return is_constant ? Opcodes::VariablePrimitiveMultiplyConstant
+                       : Opcodes::VariablePrimitiveMultiplyVariable;
+  default:
+    return Opcodes::Unknown;
+  }
+}
+
+}  // namespace
+
+// Peephole pass which fuses the sequence generated for statements of the form `a = a + b` (where b
+// is either a variable or a constant) into a single superinstruction. Only the first instruction of
+// the sequence is replaced: the remaining instructions are left in place (and are skipped by the
+// superinstruction) so that the program counters of all jump targets and line numbers are
+// unchanged. Division and modulo are never fused since they can raise runtime errors.
+void Generator::Optimise(Executable::Function &function)
+{
+  auto &            instructions = function.instructions;
+  std::size_t const length       = Executable::FUSED_SEQUENCE_LENGTH;
+
+  std::size_t pc = 0;
+  while ((pc + length) <= instructions.size())
+  {
+    Executable::Instruction const &push_lhs   = instructions[pc];
+    Executable::Instruction const &push_rhs   = instructions[pc + 1];
+    Executable::Instruction const &arithmetic = instructions[pc + 2];
+    Executable::Instruction const &pop        = instructions[pc + 3];
+
+    bool const rhs_is_operand =
+        (push_rhs.opcode == Opcodes::PushVariable) || (push_rhs.opcode == Opcodes::PushConstant);
+    bool const is_candidate = (push_lhs.opcode == Opcodes::PushVariable) && rhs_is_operand &&
+                              (pop.opcode == Opcodes::PopToVariable) &&
+                              (pop.index == push_lhs.index);
+
+    uint16_t const opcode =
+        is_candidate ? GetSuperinstructionOpcode(push_rhs.opcode, arithmetic.opcode)
+                     : Opcodes::Unknown;
+
+    if (opcode == Opcodes::Unknown)
+    {
+      ++pc;
+      continue;
+    }
+
+    Executable::Instruction superinstruction(opcode);
+    superinstruction.type_id = arithmetic.type_id;
+    superinstruction.index   = push_lhs.index;
+    superinstruction.data    = push_rhs.index;
+
+    instructions[pc] = superinstruction;
+    pc += length;
+  }
+}
+
 uint16_t Generator::AddConstant(Variant const &c)
 {
   uint16_t index;
@@ -17,6 +17,8 @@
 //------------------------------------------------------------------------------
 
 #include "vm/vm.hpp"
+#include "crypto/fnv_detail.hpp"
+#include "vm/executable_serializer.hpp"
 #include "vm/module.hpp"
 
 namespace fetch {
@@ -27,6 +29,7 @@ VM::VM(Module *module)
   FunctionInfoArray function_info_array;
   module->GetDetails(type_info_array_, type_info_map_, registered_types_, function_info_array);
   uint16_t num_types     = uint16_t(type_info_array_.size());
+  num_module_types_      = type_info_array_.size();
   uint16_t num_functions = uint16_t(function_info_array.size());
   uint16_t num_opcodes   = uint16_t(Opcodes::NumReserved + num_functions);
   opcode_info_array_     = OpcodeInfoArray(num_opcodes);
@@ -158,6 +161,18 @@ VM::VM(Module *module)
                 [](VM *vm) { vm->Handler__PrimitiveModulo(); });
   AddOpcodeInfo(Opcodes::VariablePrimitiveInplaceModulo, "VariablePrimitiveInplaceModulo",
                 [](VM *vm) { vm->Handler__VariablePrimitiveInplaceModulo(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveAddConstant, "VariablePrimitiveAddConstant",
+                [](VM *vm) { vm->Handler__VariablePrimitiveAddConstant(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveSubtractConstant, "VariablePrimitiveSubtractConstant",
+                [](VM *vm) { vm->Handler__VariablePrimitiveSubtractConstant(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveMultiplyConstant, "VariablePrimitiveMultiplyConstant",
+                [](VM *vm) { vm->Handler__VariablePrimitiveMultiplyConstant(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveAddVariable, "VariablePrimitiveAddVariable",
+                [](VM *vm) { vm->Handler__VariablePrimitiveAddVariable(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveSubtractVariable, "VariablePrimitiveSubtractVariable",
+                [](VM *vm) { vm->Handler__VariablePrimitiveSubtractVariable(); });
+  AddOpcodeInfo(Opcodes::VariablePrimitiveMultiplyVariable, "VariablePrimitiveMultiplyVariable",
+                [](VM *vm) { vm->Handler__VariablePrimitiveMultiplyVariable(); });
 
   opcode_map_.clear();
   for (uint16_t i = 0; i < num_functions; ++i)
@@ -177,23 +192,51 @@ bool VM::GenerateExecutable(IR const &ir, std::string const &name, Executable &e
   return generator_.GenerateExecutable(ir, name, executable, errors);
 }
 
-bool VM::Execute(std::string &error, Variant &output)
+/**
+ * Reset the VM so that it can be reused for an unrelated invocation
+ *
+ * The attached devices and IO observer are removed. The strings and types of the most recently
+ * executed executable are retained, since these are likely to be used again by the next invocation.
+ */
+void VM::Reset()
+{
+  io_observer_ = nullptr;
+  input_devices_.clear();
+  output_devices_.clear();
+  output_buffer_.str(std::string{});
+  output_buffer_.clear();
+  error_.clear();
+}
+
+uint64_t VM::GetOpcodeTableVersion() const
 {
-  size_t const num_strings = executable_->strings.size();
-  strings_                 = std::vector<Ptr<String>>(num_strings);
-  for (size_t i = 0; i < num_strings; ++i)
+  crypto::detail::FNV1a hash;
+
+  auto const update = [&hash](std::string const &value) {
+    // include the terminator so that adjacent names can not be confused
+    hash.update(reinterpret_cast<uint8_t const *>(value.c_str()), value.size() + 1);
+  };
+
+  uint16_t const format_version = EXECUTABLE_FORMAT_VERSION;
+  hash.update(reinterpret_cast<uint8_t const *>(&format_version), sizeof(format_version));
+
+  for (auto const &info : opcode_info_array_)
   {
-    std::string const &str = executable_->strings[i];
-    strings_[i]            = Ptr<String>(new String(this, str, true));
+    update(info.name);
   }
 
-  size_t const num_local_types = executable_->types.size();
-  for (size_t i = 0; i < num_local_types; ++i)
+  for (std::size_t i = 0; i < num_module_types_; ++i)
   {
-    TypeInfo const &type_info = executable_->types[i];
-    type_info_array_.push_back(type_info);
+    update(type_info_array_[i].name);
   }
 
+  return static_cast<uint64_t>(hash.context());
+}
+
+bool VM::Execute(std::string &error, Variant &output)
+{
+  LoadExecutable(*executable_);
+
   frame_sp_       = -1;
   bsp_            = 0;
   sp_             = function_->num_variables - 1;
@@ -206,33 +249,10 @@ bool VM::Execute(std::string &error, Variant &output)
   error_.clear();
   error.clear();
 
-  do
-  {
-    instruction_pc_  = pc_;
-    instruction_     = &function_->instructions[pc_++];
-    OpcodeInfo &info = opcode_info_array_[instruction_->opcode];
-    if (info.handler)
-    {
-      info.handler(this);
-    }
-    else
-    {
-      RuntimeError("unknown opcode");
-      break;
-    }
-  } while (!stop_);
+  Dispatch();
 
   bool const ok = error_.empty();
 
-  // Remove the executable's strings
-  strings_.clear();
-
-  // Remove the executable's local types
-  for (size_t i = 0; i < num_local_types; ++i)
-  {
-    type_info_array_.pop_back();
-  }
-
   if (ok)
   {
     if (sp_ == 0)
@@ -255,6 +275,68 @@ bool VM::Execute(std::string &error, Variant &output)
   return false;
 }
 
+/**
+ * Prepare the constant strings and local types of an executable
+ *
+ * These are retained between invocations so that repeatedly executing the same executable does not
+ * need to rebuild them. A retained string object is only reused if it is no longer referenced
+ * elsewhere (for example by a value returned from a previous invocation) and it has not been
+ * modified.
+ *
+ * @param executable The executable about to be run
+ */
+void VM::LoadExecutable(Executable const &executable)
+{
+  if (!HasLocalTypes(executable))
+  {
+    type_info_array_.resize(num_module_types_);
+    type_info_array_.insert(type_info_array_.end(), executable.types.begin(),
+                            executable.types.end());
+  }
+
+  std::size_t const num_strings = executable.strings.size();
+  strings_.resize(num_strings);
+  for (std::size_t i = 0; i < num_strings; ++i)
+  {
+    Ptr<String> &     interned = strings_[i];
+    std::string const &str     = executable.strings[i];
+
+    if (!interned || (interned.RefCount() != 1) || (interned->str != str))
+    {
+      interned = Ptr<String>(new String(this, str, true));
+    }
+  }
+}
+
+/**
+ * Determine if the local types of an executable are already loaded
+ *
+ * @param executable The executable to check
+ * @return true if the local types are loaded, otherwise false
+ */
+bool VM::HasLocalTypes(Executable const &executable) const
+{
+  std::size_t const num_local_types = executable.types.size();
+  if (type_info_array_.size() != (num_module_types_ + num_local_types))
+  {
+    return false;
+  }
+
+  for (std::size_t i = 0; i < num_local_types; ++i)
+  {
+    TypeInfo const &loaded = type_info_array_[num_module_types_ + i];
+    TypeInfo const &local  = executable.types[i];
+
+    if ((loaded.type_kind != local.type_kind) || (loaded.name != local.name) ||
+        (loaded.parameter_type_ids != local.parameter_type_ids))
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void VM::RuntimeError(std::string const &message)
 {
   uint16_t const    line = function_->FindLineNumber(instruction_pc_);
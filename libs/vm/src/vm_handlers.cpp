@@ -18,6 +18,98 @@
 
 #include "vm/vm.hpp"
 
+// Computed goto (direct threaded) dispatch is a GNU extension which is supported by both GCC and
+// Clang. Other compilers fall back to dispatching through a switch statement.
+#if defined(__GNUC__)
+#define FETCH_VM_COMPUTED_GOTO
+#endif
+
+// The built-in opcodes along with the name of the handler that implements each of them
+#define FETCH_VM_BUILTIN_OPCODES(OPCODE)                                         \
+  OPCODE(VariableDeclare, VariableDeclare)                                       \
+  OPCODE(VariableDeclareAssign, VariableDeclareAssign)                           \
+  OPCODE(PushNull, PushNull)                                                     \
+  OPCODE(PushFalse, PushFalse)                                                   \
+  OPCODE(PushTrue, PushTrue)                                                     \
+  OPCODE(PushString, PushString)                                                 \
+  OPCODE(PushConstant, PushConstant)                                             \
+  OPCODE(PushVariable, PushVariable)                                             \
+  OPCODE(PopToVariable, PopToVariable)                                           \
+  OPCODE(Inc, Inc)                                                               \
+  OPCODE(Dec, Dec)                                                               \
+  OPCODE(Duplicate, Duplicate)                                                   \
+  OPCODE(DuplicateInsert, DuplicateInsert)                                       \
+  OPCODE(Discard, Discard)                                                       \
+  OPCODE(Destruct, Destruct)                                                     \
+  OPCODE(Break, Break)                                                           \
+  OPCODE(Continue, Continue)                                                     \
+  OPCODE(Jump, Jump)                                                             \
+  OPCODE(JumpIfFalse, JumpIfFalse)                                               \
+  OPCODE(JumpIfTrue, JumpIfTrue)                                                 \
+  OPCODE(Return, Return)                                                         \
+  OPCODE(ReturnValue, Return)                                                    \
+  OPCODE(ForRangeInit, ForRangeInit)                                             \
+  OPCODE(ForRangeIterate, ForRangeIterate)                                       \
+  OPCODE(ForRangeTerminate, ForRangeTerminate)                                   \
+  OPCODE(InvokeUserDefinedFreeFunction, InvokeUserDefinedFreeFunction)           \
+  OPCODE(VariablePrefixInc, VariablePrefixInc)                                   \
+  OPCODE(VariablePrefixDec, VariablePrefixDec)                                   \
+  OPCODE(VariablePostfixInc, VariablePostfixInc)                                 \
+  OPCODE(VariablePostfixDec, VariablePostfixDec)                                 \
+  OPCODE(And, And)                                                               \
+  OPCODE(Or, Or)                                                                 \
+  OPCODE(Not, Not)                                                               \
+  OPCODE(PrimitiveEqual, PrimitiveEqual)                                         \
+  OPCODE(ObjectEqual, ObjectEqual)                                               \
+  OPCODE(PrimitiveNotEqual, PrimitiveNotEqual)                                   \
+  OPCODE(ObjectNotEqual, ObjectNotEqual)                                         \
+  OPCODE(PrimitiveLessThan, PrimitiveLessThan)                                   \
+  OPCODE(ObjectLessThan, ObjectLessThan)                                         \
+  OPCODE(PrimitiveLessThanOrEqual, PrimitiveLessThanOrEqual)                     \
+  OPCODE(ObjectLessThanOrEqual, ObjectLessThanOrEqual)                           \
+  OPCODE(PrimitiveGreaterThan, PrimitiveGreaterThan)                             \
+  OPCODE(ObjectGreaterThan, ObjectGreaterThan)                                   \
+  OPCODE(PrimitiveGreaterThanOrEqual, PrimitiveGreaterThanOrEqual)               \
+  OPCODE(ObjectGreaterThanOrEqual, ObjectGreaterThanOrEqual)                     \
+  OPCODE(PrimitiveNegate, PrimitiveNegate)                                       \
+  OPCODE(ObjectNegate, ObjectNegate)                                             \
+  OPCODE(PrimitiveAdd, PrimitiveAdd)                                             \
+  OPCODE(ObjectAdd, ObjectAdd)                                                   \
+  OPCODE(ObjectLeftAdd, ObjectLeftAdd)                                           \
+  OPCODE(ObjectRightAdd, ObjectRightAdd)                                         \
+  OPCODE(VariablePrimitiveInplaceAdd, VariablePrimitiveInplaceAdd)               \
+  OPCODE(VariableObjectInplaceAdd, VariableObjectInplaceAdd)                     \
+  OPCODE(VariableObjectInplaceRightAdd, VariableObjectInplaceRightAdd)           \
+  OPCODE(PrimitiveSubtract, PrimitiveSubtract)                                   \
+  OPCODE(ObjectSubtract, ObjectSubtract)                                         \
+  OPCODE(ObjectLeftSubtract, ObjectLeftSubtract)                                 \
+  OPCODE(ObjectRightSubtract, ObjectRightSubtract)                               \
+  OPCODE(VariablePrimitiveInplaceSubtract, VariablePrimitiveInplaceSubtract)     \
+  OPCODE(VariableObjectInplaceSubtract, VariableObjectInplaceSubtract)           \
+  OPCODE(VariableObjectInplaceRightSubtract, VariableObjectInplaceRightSubtract) \
+  OPCODE(PrimitiveMultiply, PrimitiveMultiply)                                   \
+  OPCODE(ObjectMultiply, ObjectMultiply)                                         \
+  OPCODE(ObjectLeftMultiply, ObjectLeftMultiply)                                 \
+  OPCODE(ObjectRightMultiply, ObjectRightMultiply)                               \
+  OPCODE(VariablePrimitiveInplaceMultiply, VariablePrimitiveInplaceMultiply)     \
+  OPCODE(VariableObjectInplaceMultiply, VariableObjectInplaceMultiply)           \
+  OPCODE(VariableObjectInplaceRightMultiply, VariableObjectInplaceRightMultiply) \
+  OPCODE(PrimitiveDivide, PrimitiveDivide)                                       \
+  OPCODE(ObjectDivide, ObjectDivide)                                             \
+  OPCODE(ObjectLeftDivide, ObjectLeftDivide)                                     \
+  OPCODE(ObjectRightDivide, ObjectRightDivide)                                   \
+  OPCODE(VariablePrimitiveInplaceDivide, VariablePrimitiveInplaceDivide)         \
+  OPCODE(VariableObjectInplaceDivide, VariableObjectInplaceDivide)               \
+  OPCODE(VariableObjectInplaceRightDivide, VariableObjectInplaceRightDivide)     \
+  OPCODE(PrimitiveModulo, PrimitiveModulo)                                       \
+  OPCODE(VariablePrimitiveInplaceModulo, VariablePrimitiveInplaceModulo)         \
+  OPCODE(VariablePrimitiveAddConstant, VariablePrimitiveAddConstant)             \
+  OPCODE(VariablePrimitiveSubtractConstant, VariablePrimitiveSubtractConstant)   \
+  OPCODE(VariablePrimitiveMultiplyConstant, VariablePrimitiveMultiplyConstant)   \
+  OPCODE(VariablePrimitiveAddVariable, VariablePrimitiveAddVariable)             \
+  OPCODE(VariablePrimitiveSubtractVariable, VariablePrimitiveSubtractVariable)   \
+  OPCODE(VariablePrimitiveMultiplyVariable, VariablePrimitiveMultiplyVariable)
+
 namespace fetch {
 namespace vm {
 
@@ -688,5 +780,156 @@ void VM::Handler__VariablePrimitiveInplaceModulo()
   DoVariableIntegralInplaceOp<PrimitiveModulo>();
 }
 
+void VM::Handler__VariablePrimitiveAddConstant()
+{
+  DoVariableNumericConstantOp<PrimitiveAdd>();
+}
+
+void VM::Handler__VariablePrimitiveSubtractConstant()
+{
+  DoVariableNumericConstantOp<PrimitiveSubtract>();
+}
+
+void VM::Handler__VariablePrimitiveMultiplyConstant()
+{
+  DoVariableNumericConstantOp<PrimitiveMultiply>();
+}
+
+void VM::Handler__VariablePrimitiveAddVariable()
+{
+  DoVariableNumericVariableOp<PrimitiveAdd>();
+}
+
+void VM::Handler__VariablePrimitiveSubtractVariable()
+{
+  DoVariableNumericVariableOp<PrimitiveSubtract>();
+}
+
+void VM::Handler__VariablePrimitiveMultiplyVariable()
+{
+  DoVariableNumericVariableOp<PrimitiveMultiply>();
+}
+
+/**
+ * Execute instructions of the current function until the VM is stopped
+ *
+ * The built-in opcodes are dispatched directly to their handlers, which are defined in this
+ * translation unit so that the compiler is able to inline them. The opcodes of functions that have
+ * been registered with the module are dispatched through the opcode info table.
+ */
+#ifdef FETCH_VM_COMPUTED_GOTO
+namespace {
+
+// The jump table is built from the list of built-in opcodes, so they must be listed in opcode
+// order starting immediately after Unknown
+#define FETCH_VM_OPCODE_VALUE(opcode, handler) Opcodes::opcode,
+constexpr uint16_t BUILTIN_OPCODES[] = {
+    Opcodes::Unknown, FETCH_VM_BUILTIN_OPCODES(FETCH_VM_OPCODE_VALUE)};
+#undef FETCH_VM_OPCODE_VALUE
+
+constexpr bool AreBuiltinOpcodesInOrder()
+{
+  for (uint16_t i = 0; i < Opcodes::NumReserved; ++i)
+  {
+    if (BUILTIN_OPCODES[i] != i)
+    {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+static_assert(sizeof(BUILTIN_OPCODES) / sizeof(BUILTIN_OPCODES[0]) == Opcodes::NumReserved,
+              "Every reserved opcode must be a built-in opcode");
+static_assert(AreBuiltinOpcodesInOrder(), "Built-in opcodes must be listed in opcode order");
+
+}  // namespace
+
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wpedantic"
+
+void VM::Dispatch()
+{
+  // initialised once, since the label addresses are the same for every call
+#define FETCH_VM_JUMP_TARGET(opcode, handler) &&opcode_##opcode,
+  static void *const jump_table[Opcodes::NumReserved] = {
+      &&opcode_Unknown, FETCH_VM_BUILTIN_OPCODES(FETCH_VM_JUMP_TARGET)};
+#undef FETCH_VM_JUMP_TARGET
+
+#define FETCH_VM_DISPATCH()                                \
+  if (stop_)                                               \
+  {                                                        \
+    return;                                                \
+  }                                                        \
+  instruction_pc_ = pc_;                                   \
+  instruction_    = &function_->instructions[pc_++];       \
+  if (instruction_->opcode >= Opcodes::NumReserved)        \
+  {                                                        \
+    goto opcode_Extension;                                 \
+  }                                                        \
+  goto *jump_table[instruction_->opcode]
+
+  FETCH_VM_DISPATCH();
+
+#define FETCH_VM_HANDLER(opcode, handler) \
+  opcode_##opcode : Handler__##handler(); \
+  FETCH_VM_DISPATCH();
+  FETCH_VM_BUILTIN_OPCODES(FETCH_VM_HANDLER)
+#undef FETCH_VM_HANDLER
+
+opcode_Extension:
+{
+  OpcodeInfo &info = opcode_info_array_[instruction_->opcode];
+  if (!info.handler)
+  {
+    goto opcode_Unknown;
+  }
+  info.handler(this);
+}
+  FETCH_VM_DISPATCH();
+
+opcode_Unknown:
+  RuntimeError("unknown opcode");
+
+#undef FETCH_VM_DISPATCH
+}
+
+#pragma GCC diagnostic pop
+#else
+
+void VM::Dispatch()
+{
+  do
+  {
+    instruction_pc_ = pc_;
+    instruction_    = &function_->instructions[pc_++];
+
+    switch (instruction_->opcode)
+    {
+#define FETCH_VM_HANDLER(opcode, handler) \
+  case Opcodes::opcode:                   \
+    Handler__##handler();                 \
+    break;
+      FETCH_VM_BUILTIN_OPCODES(FETCH_VM_HANDLER)
+#undef FETCH_VM_HANDLER
+
+    default:
+    {
+      OpcodeInfo &info = opcode_info_array_[instruction_->opcode];
+      if (!info.handler || (instruction_->opcode < Opcodes::NumReserved))
+      {
+        RuntimeError("unknown opcode");
+        return;
+      }
+      info.handler(this);
+      break;
+    }
+    }  // switch
+  } while (!stop_);
+}
+
+#endif  // FETCH_VM_COMPUTED_GOTO
+
 }  // namespace vm
 }  // namespace fetch
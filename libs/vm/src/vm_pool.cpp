@@ -0,0 +1,106 @@
+//------------------------------------------------------------------------------
+//
+//   Copyright 2018-2019 Fetch.AI Limited
+//
+//   Licensed under the Apache License, Version 2.0 (the "License");
+//   you may not use this file except in compliance with the License.
+//   You may obtain a copy of the License at
+//
+//       http://www.apache.org/licenses/LICENSE-2.0
+//
+//   Unless required by applicable law or agreed to in writing, software
+//   distributed under the License is distributed on an "AS IS" BASIS,
+//   WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+//   See the License for the specific language governing permissions and
+//   limitations under the License.
+//
+//------------------------------------------------------------------------------
+
+#include "vm/vm_pool.hpp"
+#include "core/mutex.hpp"
+#include "vm/module.hpp"
+
+namespace fetch {
+namespace vm {
+
+void VMPool::Releaser::operator()(VM *vm) const
+{
+  if (pool_)
+  {
+    pool_->Release(vm);
+  }
+  else
+  {
+    delete vm;
+  }
+}
+
+/**
+ * Construct a pool of VM instances
+ *
+ * @param module The module to which all the instances are bound
+ * @param max_idle The maximum number of idle instances retained by the pool
+ */
+VMPool::VMPool(Module *module, std::size_t max_idle)
+  : module_{module}
+  , max_idle_{max_idle}
+{}
+
+/**
+ * Acquire a VM instance from the pool, creating a new instance if none are available
+ *
+ * @return The VM instance, which is returned to the pool when it is destroyed
+ */
+VMPool::VMPtr VMPool::Acquire()
+{
+  std::unique_ptr<VM> vm{};
+
+  {
+    FETCH_LOCK(lock_);
+
+    if (!idle_.empty())
+    {
+      vm = std::move(idle_.back());
+      idle_.pop_back();
+    }
+  }
+
+  if (!vm)
+  {
+    vm = std::make_unique<VM>(module_);
+  }
+
+  return VMPtr{vm.release(), Releaser{this}};
+}
+
+/**
+ * Get the number of idle instances currently held by the pool
+ *
+ * @return The number of idle instances
+ */
+std::size_t VMPool::GetNumIdle() const
+{
+  FETCH_LOCK(lock_);
+  return idle_.size();
+}
+
+/**
+ * Reset a VM instance and return it to the pool
+ *
+ * @param vm The instance being returned
+ */
+void VMPool::Release(VM *vm)
+{
+  std::unique_ptr<VM> instance{vm};
+  instance->Reset();
+
+  FETCH_LOCK(lock_);
+
+  if (idle_.size() < max_idle_)
+  {
+    idle_.push_back(std::move(instance));
+  }
+}
+
+}  // namespace vm
+}  // namespace fetch
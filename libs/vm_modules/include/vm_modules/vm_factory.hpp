@@ -68,6 +68,18 @@ public:
     return module;
   }
 
+  /**
+   * Populate the type and function tables of a module without compiling any source. This is
+   * required before a VM can run an executable which was loaded rather than compiled.
+   *
+   * @param: module The module to be prepared
+   */
+  static void PrepareModule(std::shared_ptr<fetch::vm::Module> const &module)
+  {
+    // constructing the compiler runs the setup functions of all the module bindings
+    fetch::vm::Compiler compiler{module.get()};
+  }
+
   /**
    * Compile a source file, returning a executable
    *
@@ -345,4 +345,21 @@ TEST_F(StringTests, substring_fails_if_start_is_greater_than_end)
   ASSERT_FALSE(Run());
 }
 
+TEST_F(StringTests, modified_literals_are_restored_for_subsequent_runs)
+{
+  static char const *TEXT = R"(
+    function main()
+      var text = '   abc';
+      print(text.length());
+      text.trim();
+    endfunction
+  )";
+
+  ASSERT_TRUE(Compile(TEXT));
+  ASSERT_TRUE(Run());
+  ASSERT_TRUE(Run());
+
+  ASSERT_EQ(stdout(), "66");
+}
+
 }  // namespace
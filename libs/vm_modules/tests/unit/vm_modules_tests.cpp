@@ -18,6 +18,8 @@
 
 #include "vm_test_suite.hpp"
 
+#include "core/serializers/byte_array_buffer.hpp"
+#include "vm/executable_serializer.hpp"
 #include "vm/io_observer_interface.hpp"
 #include "vm_modules/vm_factory.hpp"
 
@@ -57,4 +59,72 @@ TEST_F(VMTests, CheckRandom)
 
   ASSERT_TRUE(Compile(TEXT));
   ASSERT_TRUE(Run());
-}
\ No newline at end of file
+}
+
+TEST_F(VMTests, CheckFusedArithmeticMatchesUnfused)
+{
+  static char const *TEXT = R"(
+    function main()
+      var a = 1;
+      var b = 3;
+      for (i in 0:4)
+        a = a + 2;
+        a = a * b;
+        a = a - i;
+        b = 1 + b;
+      endfor
+      print(a);
+      print(' ');
+      print(b);
+    endfunction
+  )";
+
+  ASSERT_TRUE(Compile(TEXT));
+  ASSERT_TRUE(Run());
+
+  EXPECT_EQ(stdout(), "9439 8");
+}
+
+TEST_F(VMTests, CheckSerializedExecutableMatchesCompiled)
+{
+  static char const *TEXT = R"(
+    @query
+    function scale(value : Float64, factor : Int32) : Float64
+      return value * toFloat64(factor);
+    endfunction
+
+    function main()
+      var total = 0.0;
+      for (i in 0:3)
+        total = total + scale(1.5, i);
+      endfor
+      print('total = ' + toString(total));
+    endfunction
+  )";
+
+  ASSERT_TRUE(Compile(TEXT));
+  ASSERT_TRUE(Run());
+
+  std::string const expected = stdout();
+  stdout_.str(std::string{});
+
+  fetch::serializers::ByteArrayBuffer buffer;
+  buffer << *executable_;
+  buffer.seek(0);
+
+  auto loaded = std::make_unique<Executable>();
+  buffer >> *loaded;
+
+  ASSERT_EQ(loaded->functions.size(), executable_->functions.size());
+  EXPECT_EQ(loaded->functions[0].annotations.size(), 1u);
+
+  // a separately prepared module must produce a VM with an identical opcode table
+  auto module = fetch::vm_modules::VMFactory::GetModule();
+  fetch::vm_modules::VMFactory::PrepareModule(module);
+  EXPECT_EQ(fetch::vm::VM{module.get()}.GetOpcodeTableVersion(), vm_->GetOpcodeTableVersion());
+
+  executable_ = std::move(loaded);
+  ASSERT_TRUE(Run());
+
+  EXPECT_EQ(stdout(), expected);
+}